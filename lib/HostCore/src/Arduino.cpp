@@ -0,0 +1,167 @@
+#include "Arduino.h"
+#include "HostRuntime.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <random>
+#include <signal.h>
+
+HostSerial Serial;
+HostEsp ESP;
+
+//============================================================================
+// TIME
+//============================================================================
+
+unsigned long millis() {
+    return (unsigned long)(HostRuntime::nowMicros() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)HostRuntime::nowMicros();
+}
+
+void delay(unsigned long ms) {
+    HostRuntime::advanceMicros((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+    HostRuntime::advanceMicros(us);
+}
+
+uint32_t HostEsp::getCycleCount() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return (uint32_t)(ns * getCpuFreqMHz() / 1000);
+}
+
+static arduino_panic_handler_t panicHandler = nullptr;
+static void* panicArg = nullptr;
+
+static void onFatalSignal(int sig) {
+    signal(sig, SIG_DFL);
+    fflush(stdout);
+    if (panicHandler) {
+        arduino_panic_info_t info = {sig};
+        panicHandler(&info, panicArg);
+    }
+    fflush(stdout);
+    raise(sig);
+}
+
+void set_arduino_panic_handler(arduino_panic_handler_t handler, void* arg) {
+    panicHandler = handler;
+    panicArg = arg;
+    signal(SIGSEGV, onFatalSignal);
+    signal(SIGABRT, onFatalSignal);
+    signal(SIGFPE, onFatalSignal);
+    signal(SIGILL, onFatalSignal);
+}
+
+//============================================================================
+// RANDOM
+//============================================================================
+
+// One engine per thread, so host tools can run game code in parallel with
+// each thread seeding its own stream
+static std::mt19937& randomEngine() {
+    static thread_local std::mt19937 engine(0x5EED);
+    return engine;
+}
+
+long random(long howBig) {
+    if (howBig <= 0) return 0;
+    return (long)(randomEngine()() % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+    if (howSmall >= howBig) return howSmall;
+    return howSmall + random(howBig - howSmall);
+}
+
+uint32_t esp_random() {
+    return (uint32_t)randomEngine()();
+}
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0) {
+        randomEngine().seed((uint32_t)seed);
+    }
+}
+
+//============================================================================
+// GPIO
+//============================================================================
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    // Pull-ups idle high; outputs keep whatever was last written
+    if (mode == INPUT_PULLUP) {
+        HostRuntime::setPin(pin, HIGH);
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    HostRuntime::setPin(pin, value ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin) {
+    HostRuntime::pumpScript();
+    return HostRuntime::getPin(pin);
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+    HostRuntime::setPinInterrupt(pin, handler, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+    HostRuntime::setPinInterrupt(pin, nullptr, 0);
+}
+
+//============================================================================
+// SERIAL
+//============================================================================
+
+int HostSerial::available() {
+    return HostRuntime::serialAvailable();
+}
+
+int HostSerial::read() {
+    return HostRuntime::serialRead();
+}
+
+void HostSerial::flush() {
+    fflush(stdout);
+}
+
+size_t HostSerial::write(uint8_t c) {
+    if (HostRuntime::isQuiet()) return 1;
+    fputc(c, stdout);
+    return 1;
+}
+
+size_t HostSerial::write(const uint8_t* data, size_t size) {
+    if (HostRuntime::isQuiet()) return size;
+    return fwrite(data, 1, size, stdout);
+}
+
+size_t HostSerial::print(const char* text) {
+    if (text == nullptr) return 0;
+    size_t length = strlen(text);
+    return write((const uint8_t*)text, length);
+}
+
+size_t HostSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HostSerial::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length <= 0) return 0;
+    if (length >= (int)sizeof(buffer)) length = sizeof(buffer) - 1;
+    return write((const uint8_t*)buffer, length);
+}
@@ -0,0 +1,133 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host (Linux) replacement for the parts of the Arduino core the game uses.
+// Time is virtual: millis() only advances through delay(), so a headless
+// run is deterministic and runs as fast as the CPU allows.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "WString.h"
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Random numbers (deterministic per run, seed with randomSeed). Each thread
+// has its own generator.
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+// Hardware RNG stand-in; drawn from the same generator, so --seed fixes it
+uint32_t esp_random();
+
+// GPIO - pins live in a simulated pin table driven by HostRuntime
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// Pin interrupts fire synchronously when HostRuntime changes a pin level
+// (i.e. while the key script is pumped). Single-threaded, so masking
+// interrupts is a no-op.
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void detachInterrupt(uint8_t pin);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// Serial port writes to stdout (can be silenced with --quiet)
+class HostSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    // Input comes from the --console and --serial text (see HostRuntime)
+    int available();
+    int read();
+    void flush();
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* data, size_t size);
+    // stdout never pushes back; report a UART-sized FIFO anyway
+    int availableForWrite() { return 128; }
+
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(const char* text);
+    size_t print(char c);
+    size_t print(int value) { return print(String(value)); }
+    size_t print(unsigned int value) { return print(String(value)); }
+    size_t print(long value) { return print(String(value)); }
+    size_t print(unsigned long value) { return print(String(value)); }
+    size_t print(double value, int digits = 2) { return print(String(value, digits)); }
+
+    size_t println() { return print("\n"); }
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+
+// Xtensa cycle counter stand-in: a steady wall clock scaled to the nominal
+// CPU frequency, so cycle-based timing code reads host CPU time
+class HostEsp {
+public:
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern HostEsp ESP;
+
+inline uint32_t getCpuFrequencyMhz() { return ESP.getCpuFreqMHz(); }
+
+// API level of the Arduino-ESP32 core being stood in for (3.x: panic hook)
+#define ESP_ARDUINO_VERSION_MAJOR 3
+
+// "PSRAM" is the normal heap here, and everything runs on core 0
+inline bool psramFound() { return true; }
+inline int xPortGetCoreID() { return 0; }
+
+// Panic hook: a fatal signal (SIGSEGV, SIGABRT, SIGFPE, SIGILL) calls the
+// handler once, then the process dies as it would have
+typedef struct {
+    int signal;
+} arduino_panic_info_t;
+typedef void (*arduino_panic_handler_t)(arduino_panic_info_t* info, void* arg);
+void set_arduino_panic_handler(arduino_panic_handler_t handler, void* arg);
+
+// Sketch entry points, provided by src/main.cpp
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,75 @@
+#include "esp_sleep.h"
+#include "driver/gpio.h"
+#include "Arduino.h"
+#include "HostRuntime.h"
+
+static const int WAKE_PIN_COUNT = 64;
+
+static int wakeLevels[WAKE_PIN_COUNT];  // -1 = not a wakeup source
+static bool wakeLevelsReady = false;
+static bool gpioWakeup = false;
+static uint64_t timerWakeupUs = 0;
+
+static void initWakeLevels() {
+    if (wakeLevelsReady) return;
+    for (int i = 0; i < WAKE_PIN_COUNT; i++) {
+        wakeLevels[i] = -1;
+    }
+    wakeLevelsReady = true;
+}
+
+static bool wakePinActive() {
+    if (!gpioWakeup) return false;
+    for (int i = 0; i < WAKE_PIN_COUNT; i++) {
+        if (wakeLevels[i] >= 0 && HostRuntime::getPin(i) == wakeLevels[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+    initWakeLevels();
+    if (pin < 0 || pin >= WAKE_PIN_COUNT) return ESP_FAIL;
+    if (type != GPIO_INTR_LOW_LEVEL && type != GPIO_INTR_HIGH_LEVEL) return ESP_FAIL;
+    wakeLevels[pin] = (type == GPIO_INTR_LOW_LEVEL) ? LOW : HIGH;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin) {
+    initWakeLevels();
+    if (pin < 0 || pin >= WAKE_PIN_COUNT) return ESP_FAIL;
+    wakeLevels[pin] = -1;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    timerWakeupUs = time_in_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+    initWakeLevels();
+    gpioWakeup = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+    initWakeLevels();
+    uint64_t wakeAt = HostRuntime::nowMicros() + timerWakeupUs;
+
+    // Step from one scripted pin change to the next until a wakeup pin
+    // triggers or the timer runs out
+    HostRuntime::pumpScript();
+    while (!wakePinActive()) {
+        uint64_t now = HostRuntime::nowMicros();
+        uint64_t next = HostRuntime::nextScriptEventMicros();
+        if (next > wakeAt) next = wakeAt;
+        if (next <= now) {
+            if (now >= wakeAt) break;
+            next = now + 1;
+        }
+        HostRuntime::advanceMicros(next - now);
+    }
+    return ESP_OK;
+}
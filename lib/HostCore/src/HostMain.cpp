@@ -0,0 +1,74 @@
+// Default entry point for the native env: plays the part of the Arduino core
+// main loop. Lives in its own file so host tools with their own main() can
+// link the rest of HostCore without pulling this in.
+
+#include "Arduino.h"
+#include "HostRuntime.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void printUsage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--frames N] [--max-ms N] [--keys SCRIPT] [--serial TEXT] [--console TEXT]\n"
+            "       [--fs DIR] [--seed N] [--quiet] [--realtime]\n"
+            "  --frames N     stop after N calls to loop()\n"
+            "  --max-ms N     stop once the virtual clock passes N milliseconds\n"
+            "  --keys SCRIPT  U/D/A/B taps a button, '.' waits one beat\n"
+            "  --serial TEXT  Serial input, readable once the key script is done\n"
+            "  --console TEXT Serial input, readable from the first frame\n"
+            "  --fs DIR       directory behind LittleFS (default: .)\n"
+            "  --seed N       seed for random()\n"
+            "  --quiet        drop Serial output\n"
+            "  --realtime     make delay() actually sleep\n",
+            program);
+}
+
+int main(int argc, char** argv) {
+    const char* keys = nullptr;
+    unsigned long frameLimit = 0;
+    unsigned long seed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--frames") == 0 && hasValue) {
+            frameLimit = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--max-ms") == 0 && hasValue) {
+            HostRuntime::setTimeLimitMs(strtoull(argv[++i], nullptr, 10));
+        } else if (strcmp(arg, "--keys") == 0 && hasValue) {
+            keys = argv[++i];
+        } else if (strcmp(arg, "--serial") == 0 && hasValue) {
+            HostRuntime::loadSerialInput(argv[++i]);
+        } else if (strcmp(arg, "--console") == 0 && hasValue) {
+            HostRuntime::loadConsoleInput(argv[++i]);
+        } else if (strcmp(arg, "--fs") == 0 && hasValue) {
+            HostRuntime::setFsRoot(argv[++i]);
+        } else if (strcmp(arg, "--seed") == 0 && hasValue) {
+            seed = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(arg, "--quiet") == 0) {
+            HostRuntime::setQuiet(true);
+        } else if (strcmp(arg, "--realtime") == 0) {
+            HostRuntime::setRealtime(true);
+        } else {
+            printUsage(argv[0]);
+            return strcmp(arg, "--help") == 0 ? 0 : 2;
+        }
+    }
+
+    randomSeed(seed);
+    setup();
+
+    if (keys != nullptr) {
+        HostRuntime::loadKeyScript(keys);
+    }
+
+    while (frameLimit == 0 || HostRuntime::framesRun() < frameLimit) {
+        loop();
+        HostRuntime::countFrame();
+    }
+
+    HostRuntime::finish();
+    return 0;
+}
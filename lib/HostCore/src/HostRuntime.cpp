@@ -0,0 +1,214 @@
+#include "HostRuntime.h"
+#include "Arduino.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Button pins as wired on the device (see src/input/Input.h)
+static const uint8_t SCRIPT_PIN_UP = 18;
+static const uint8_t SCRIPT_PIN_DOWN = 17;
+static const uint8_t SCRIPT_PIN_A = 21;
+static const uint8_t SCRIPT_PIN_B = 38;
+
+// Scripted taps hold the button long enough to be seen by a 10 ms loop and
+// leave a gap longer than the 50 ms input debounce.
+static const uint64_t SCRIPT_HOLD_US = 40 * 1000;
+static const uint64_t SCRIPT_GAP_US = 160 * 1000;
+
+struct ScriptEvent {
+    uint64_t atMicros;
+    uint8_t pin;
+    int level;
+};
+
+static const int PIN_COUNT = 64;
+
+static int pinLevels[PIN_COUNT];
+static void (*pinHandlers[PIN_COUNT])();
+static int pinHandlerModes[PIN_COUNT];
+static bool pinsInitialized = false;
+static uint64_t virtualMicros = 0;
+
+static std::vector<ScriptEvent> script;
+static size_t scriptPosition = 0;
+
+static std::string serialInput;
+static size_t serialPosition = 0;
+static std::string consoleInput;
+static size_t consolePosition = 0;
+static std::string fsRoot = ".";
+
+static bool quiet = false;
+static bool realtime = false;
+static unsigned long frameCount = 0;
+static uint64_t maxMicros = 0;
+static void (*finishHandler)() = nullptr;
+static std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+
+static void initPins() {
+    if (pinsInitialized) return;
+    for (int i = 0; i < PIN_COUNT; i++) {
+        pinLevels[i] = HIGH;
+    }
+    pinsInitialized = true;
+}
+
+namespace HostRuntime {
+
+void setPin(uint8_t pin, int level) {
+    initPins();
+    if (pin >= PIN_COUNT || pinLevels[pin] == level) return;
+    pinLevels[pin] = level;
+
+    int mode = pinHandlerModes[pin];
+    bool fire = (mode == CHANGE) || (mode == RISING && level == HIGH) || (mode == FALLING && level == LOW);
+    if (pinHandlers[pin] != nullptr && fire) {
+        pinHandlers[pin]();
+    }
+}
+
+void setPinInterrupt(uint8_t pin, void (*handler)(), int mode) {
+    if (pin < PIN_COUNT) {
+        pinHandlers[pin] = handler;
+        pinHandlerModes[pin] = mode;
+    }
+}
+
+int getPin(uint8_t pin) {
+    initPins();
+    return pin < PIN_COUNT ? pinLevels[pin] : HIGH;
+}
+
+uint64_t nowMicros() {
+    return virtualMicros;
+}
+
+void advanceMicros(uint64_t us) {
+    virtualMicros += us;
+    if (realtime) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    }
+    pumpScript();
+
+    // Blocking screens spin on delay(), so the time limit is enforced here too
+    if (maxMicros != 0 && virtualMicros > maxMicros) {
+        finish();
+    }
+}
+
+void loadKeyScript(const char* keys) {
+    uint64_t t = virtualMicros;
+    for (const char* c = keys; *c; c++) {
+        uint8_t pin = 0;
+        switch (*c) {
+            case 'U': case 'u': pin = SCRIPT_PIN_UP; break;
+            case 'D': case 'd': pin = SCRIPT_PIN_DOWN; break;
+            case 'A': case 'a': pin = SCRIPT_PIN_A; break;
+            case 'B': case 'b': pin = SCRIPT_PIN_B; break;
+            case '.':
+                t += SCRIPT_HOLD_US + SCRIPT_GAP_US;
+                continue;
+            default:
+                continue;
+        }
+        script.push_back({t, pin, LOW});
+        script.push_back({t + SCRIPT_HOLD_US, pin, HIGH});
+        t += SCRIPT_HOLD_US + SCRIPT_GAP_US;
+    }
+}
+
+void pumpScript() {
+    // Advance first: setPin() may run an interrupt handler that reads pins
+    // and so re-enters here
+    while (scriptPosition < script.size() && script[scriptPosition].atMicros <= virtualMicros) {
+        const ScriptEvent& event = script[scriptPosition++];
+        setPin(event.pin, event.level);
+    }
+}
+
+bool scriptFinished() {
+    return scriptPosition >= script.size();
+}
+
+uint64_t nextScriptEventMicros() {
+    return scriptFinished() ? UINT64_MAX : script[scriptPosition].atMicros;
+}
+
+void loadSerialInput(const char* text) {
+    serialInput += text;
+}
+
+void loadConsoleInput(const char* text) {
+    consoleInput += text;
+}
+
+int serialAvailable() {
+    int console = (int)(consoleInput.size() - consolePosition);
+    if (!scriptFinished()) return console;
+    return console + (int)(serialInput.size() - serialPosition);
+}
+
+int serialRead() {
+    if (consolePosition < consoleInput.size()) {
+        return (unsigned char)consoleInput[consolePosition++];
+    }
+    if (serialAvailable() == 0) return -1;
+    return (unsigned char)serialInput[serialPosition++];
+}
+
+void setQuiet(bool enabled) {
+    quiet = enabled;
+}
+
+bool isQuiet() {
+    return quiet;
+}
+
+void setRealtime(bool enabled) {
+    realtime = enabled;
+}
+
+void setTimeLimitMs(uint64_t ms) {
+    maxMicros = ms * 1000;
+}
+
+void setFsRoot(const char* path) {
+    fsRoot = path;
+}
+
+const char* getFsRoot() {
+    return fsRoot.c_str();
+}
+
+void countFrame() {
+    frameCount++;
+}
+
+unsigned long framesRun() {
+    return frameCount;
+}
+
+void setFinishHandler(void (*handler)()) {
+    finishHandler = handler;
+}
+
+void finish() {
+    if (finishHandler != nullptr) {
+        finishHandler();
+    }
+    fflush(stdout);
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    fprintf(stderr, "host: %lu frames, %.1f s virtual, %.3f s wall", frameCount,
+            virtualMicros / 1000000.0, wallSeconds);
+    if (wallSeconds > 0) {
+        fprintf(stderr, ", %.0f frames/s", frameCount / wallSeconds);
+    }
+    fprintf(stderr, "\n");
+    exit(0);
+}
+
+} // namespace HostRuntime
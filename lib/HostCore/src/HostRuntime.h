@@ -0,0 +1,60 @@
+#ifndef HOST_RUNTIME_H
+#define HOST_RUNTIME_H
+
+#include <stdint.h>
+
+// Control surface for the headless host build. The default main() in
+// HostMain.cpp parses the command line, runs setup()/loop() against the
+// virtual clock and feeds scripted button presses into the simulated pin
+// table. Host tools that bring their own main() can use the same calls.
+namespace HostRuntime {
+    // Pin levels as seen by digitalRead(); unconfigured pins read HIGH
+    // (matching INPUT_PULLUP buttons at rest).
+    void setPin(uint8_t pin, int level);
+    int getPin(uint8_t pin);
+    // Handler run when setPin() changes the level (mode: RISING/FALLING/CHANGE)
+    void setPinInterrupt(uint8_t pin, void (*handler)(), int mode);
+
+    // Virtual clock in microseconds
+    uint64_t nowMicros();
+    void advanceMicros(uint64_t us);
+
+    // Button script: U D A B tap a button, '.' waits one beat. Taps are
+    // scheduled on the virtual clock starting from "now".
+    void loadKeyScript(const char* keys);
+    void pumpScript();
+    bool scriptFinished();
+    // When the next scripted pin change is due (UINT64_MAX if none)
+    uint64_t nextScriptEventMicros();
+
+    // Text for Serial.read(). It becomes readable once the button script
+    // has played out, i.e. it is "typed" at the end of the scripted run.
+    void loadSerialInput(const char* text);
+    // Text readable from the first loop() on, ahead of the --serial text
+    // (e.g. debug console commands that start an input recording)
+    void loadConsoleInput(const char* text);
+    int serialAvailable();
+    int serialRead();
+
+    // Run options
+    void setQuiet(bool enabled);
+    bool isQuiet();
+    void setRealtime(bool enabled);
+    void setTimeLimitMs(uint64_t ms);
+    // Directory the LittleFS stand-in keeps its files in
+    void setFsRoot(const char* path);
+    const char* getFsRoot();
+
+    // Frame bookkeeping for the run summary
+    void countFrame();
+    unsigned long framesRun();
+
+    // Print the run summary and exit the process
+    void finish();
+    // Run by finish() instead of the summary; must end the process itself.
+    // Lets host tools report when the time limit hits inside a screen that
+    // blocks on input.
+    void setFinishHandler(void (*handler)());
+}
+
+#endif
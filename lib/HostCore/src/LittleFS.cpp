@@ -0,0 +1,75 @@
+#include "LittleFS.h"
+#include "HostRuntime.h"
+
+#include <string>
+
+LittleFSFS LittleFS;
+
+static std::string hostPath(const char* path) {
+    std::string full = HostRuntime::getFsRoot();
+    if (path[0] != '/') full += '/';
+    return full + path;
+}
+
+File::File(FILE* file) {
+    if (file != nullptr) {
+        fp = std::shared_ptr<FILE>(file, fclose);
+    }
+}
+
+size_t File::write(uint8_t value) {
+    return write(&value, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    return fp ? fwrite(buffer, 1, size, fp.get()) : 0;
+}
+
+int File::read() {
+    uint8_t value;
+    return read(&value, 1) == 1 ? value : -1;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    return fp ? fread(buffer, 1, size, fp.get()) : 0;
+}
+
+int File::available() {
+    if (!fp) return 0;
+    long position = ftell(fp.get());
+    return (int)(size() - (size_t)position);
+}
+
+size_t File::size() {
+    if (!fp) return 0;
+    long position = ftell(fp.get());
+    fseek(fp.get(), 0, SEEK_END);
+    long end = ftell(fp.get());
+    fseek(fp.get(), position, SEEK_SET);
+    return (size_t)end;
+}
+
+void File::flush() {
+    if (fp) fflush(fp.get());
+}
+
+void File::close() {
+    fp.reset();
+}
+
+File LittleFSFS::open(const char* path, const char* mode) {
+    // Arduino modes are "r", "w" and "a"; files are always binary
+    std::string hostMode = std::string(mode) + "b";
+    return File(fopen(hostPath(path).c_str(), hostMode.c_str()));
+}
+
+bool LittleFSFS::exists(const char* path) {
+    FILE* file = fopen(hostPath(path).c_str(), "rb");
+    if (file == nullptr) return false;
+    fclose(file);
+    return true;
+}
+
+bool LittleFSFS::remove(const char* path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
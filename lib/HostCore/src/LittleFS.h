@@ -0,0 +1,43 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+// Host version of the ESP32 LittleFS library: plain files under the
+// directory given with --fs (default: the working directory), so
+// LittleFS.open("/input.rec", "w") writes ./input.rec.
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <memory>
+
+class File {
+private:
+    std::shared_ptr<FILE> fp;   // Copies share the handle, like fs::File
+
+public:
+    File() {}
+    explicit File(FILE* file);
+
+    size_t write(uint8_t value);
+    size_t write(const uint8_t* buffer, size_t size);
+    int read();
+    size_t read(uint8_t* buffer, size_t size);
+    int available();
+    size_t size();
+    void flush();
+    void close();
+
+    operator bool() const { return fp != nullptr; }
+};
+
+class LittleFSFS {
+public:
+    bool begin(bool formatOnFail = false) { return true; }
+    void end() {}
+    File open(const char* path, const char* mode = "r");
+    bool exists(const char* path);
+    bool remove(const char* path);
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+// The host build has no SPI bus; TFT_eSPI's host stand-in draws into memory.
+#include "Arduino.h"
+
+#endif
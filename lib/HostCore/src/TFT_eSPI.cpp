@@ -0,0 +1,370 @@
+#include "TFT_eSPI.h"
+#include "glcdfont.h"
+#include "HostRuntime.h"
+
+#include <cstdio>
+
+static inline uint16_t swap16(uint16_t value) {
+    return (uint16_t)((value >> 8) | (value << 8));
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+    nativeWidth = w;
+    nativeHeight = h;
+    _width = w;
+    _height = h;
+    pixels.assign((size_t)w * h, TFT_BLACK);
+    pixelsWritten = 0;
+    storeSwapped = false;
+
+    rotation = 0;
+    swapBytes = false;
+
+    windowX = windowY = 0;
+    windowW = windowH = 0;
+    windowCursor = 0;
+
+    dmaReady = false;
+    dmaActive = false;
+    dmaX = dmaY = dmaW = dmaH = 0;
+    dmaSource = nullptr;
+    dmaDoneAt = 0;
+    dmaSwap = false;
+    dmaTransfers = 0;
+    dmaViolations = 0;
+
+    cursorX = cursorY = 0;
+    textSize = 1;
+    textColor = TFT_WHITE;
+    textBgColor = TFT_WHITE;  // Same as foreground = transparent background
+    textWrapX = true;
+    textWrapY = false;
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+    (void)tc;
+    setRotation(0);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    rotation = r & 3;
+    // Odd rotations are landscape
+    if (rotation & 1) {
+        _width = nativeHeight;
+        _height = nativeWidth;
+    } else {
+        _width = nativeWidth;
+        _height = nativeHeight;
+    }
+    pixels.assign((size_t)_width * _height, TFT_BLACK);
+}
+
+//============================================================================
+// GRAPHICS PRIMITIVES
+//============================================================================
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    writePixel(x, y, (uint16_t)color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    // Avoid drawing corner pixels twice
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    // Clip to the panel
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return;
+
+    for (int32_t row = y; row < y + h; row++) {
+        for (int32_t col = x; col < x + w; col++) {
+            writePixel(col, row, (uint16_t)color);
+        }
+    }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    uint16_t color = pixels[y * _width + x];
+    return storeSwapped ? swap16(color) : color;
+}
+
+//============================================================================
+// BULK PIXEL TRANSFERS
+//============================================================================
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    windowX = x;
+    windowY = y;
+    windowW = w;
+    windowH = h;
+    windowCursor = 0;
+}
+
+void TFT_eSPI::pushColor(uint16_t color) {
+    if (windowW <= 0 || windowH <= 0) return;
+    int32_t x = windowX + windowCursor % windowW;
+    int32_t y = windowY + (windowCursor / windowW) % windowH;
+    windowCursor++;
+    drawPixel(x, y, color);
+}
+
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+    // Pixels go out in memory order; without swapBytes the panel sees the
+    // two bytes of each colour reversed, exactly as on the device.
+    const uint16_t* colors = (const uint16_t*)data;
+    for (uint32_t i = 0; i < len; i++) {
+        pushColor(swapBytes ? colors[i] : swap16(colors[i]));
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t color = data[row * w + col];
+            drawPixel(x + col, y + row, swapBytes ? color : swap16(color));
+        }
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data, uint16_t transparent) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint16_t color = data[row * w + col];
+            if (color == transparent) continue;
+            drawPixel(x + col, y + row, swapBytes ? color : swap16(color));
+        }
+    }
+}
+
+//============================================================================
+// MOCK DMA ENGINE
+//============================================================================
+
+bool TFT_eSPI::initDMA(bool ctrl_cs) {
+    (void)ctrl_cs;
+    dmaReady = true;
+    return true;
+}
+
+void TFT_eSPI::deInitDMA() {
+    dmaWait();
+    dmaReady = false;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* data, uint16_t* buffer) {
+    if (!dmaReady || w <= 0 || h <= 0) return;
+
+    // Like the real driver, a new transfer first waits for the previous one
+    dmaWait();
+
+    size_t length = (size_t)w * h;
+    if (buffer != nullptr) {
+        // Caller's data is copied into the DMA buffer and is free right away
+        memcpy(buffer, data, length * sizeof(uint16_t));
+        data = buffer;
+    }
+
+    dmaActive = true;
+    dmaX = x;
+    dmaY = y;
+    dmaW = w;
+    dmaH = h;
+    dmaSource = data;
+    dmaSnapshot.assign(data, data + length);
+    dmaSwap = swapBytes;
+    dmaTransfers++;
+
+    // 16 bits per pixel at the configured SPI clock
+    uint64_t transferMicros = (uint64_t)length * 16 * 1000000 / SPI_FREQUENCY;
+    dmaDoneAt = HostRuntime::nowMicros() + (transferMicros > 0 ? transferMicros : 1);
+}
+
+bool TFT_eSPI::dmaBusy() {
+    if (dmaActive && HostRuntime::nowMicros() >= dmaDoneAt) {
+        completeDMA();
+    }
+    return dmaActive;
+}
+
+void TFT_eSPI::dmaWait() {
+    if (!dmaActive) return;
+    uint64_t now = HostRuntime::nowMicros();
+    if (dmaDoneAt > now) {
+        HostRuntime::advanceMicros(dmaDoneAt - now);
+    }
+    if (dmaActive) {
+        completeDMA();
+    }
+}
+
+void TFT_eSPI::completeDMA() {
+    // The engine reads the buffer while it streams, so it belongs to the
+    // DMA until completion. Any change in the meantime is an ownership bug.
+    if (memcmp(dmaSource, dmaSnapshot.data(), dmaSnapshot.size() * sizeof(uint16_t)) != 0) {
+        dmaViolations++;
+        fprintf(stderr, "TFT_eSPI mock: DMA source buffer %p modified while in flight (%d,%d %dx%d)\n",
+                (const void*)dmaSource, dmaX, dmaY, dmaW, dmaH);
+    }
+
+    bool oldSwapBytes = swapBytes;
+    swapBytes = dmaSwap;
+    dmaActive = false;
+    pushImage(dmaX, dmaY, dmaW, dmaH, dmaSnapshot.data());
+    swapBytes = oldSwapBytes;
+}
+
+//============================================================================
+// TEXT
+//============================================================================
+
+void TFT_eSPI::setTextColor(uint16_t color) {
+    textColor = color;
+    textBgColor = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill) {
+    (void)bgfill;  // Only used by smooth fonts
+    textColor = fgcolor;
+    textBgColor = bgcolor;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size) {
+    textSize = size > 0 ? size : 1;
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+}
+
+int16_t TFT_eSPI::textWidth(const char* text) const {
+    return (int16_t)(strlen(text) * 6 * textSize);
+}
+
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size) {
+    bool fillBackground = (bg != color);
+    const unsigned char* glyph = nullptr;
+    if (c >= GLCD_FIRST_CHAR && c <= GLCD_LAST_CHAR) {
+        glyph = &glcdFont[(c - GLCD_FIRST_CHAR) * 5];
+    }
+
+    // 5 glyph columns plus one column of spacing, 8 rows
+    for (int col = 0; col < 6; col++) {
+        uint8_t line = (glyph != nullptr && col < 5) ? glyph[col] : 0;
+        if (glyph == nullptr && col < 5) {
+            line = 0x7F;  // Unknown characters show as a solid block
+        }
+        for (int row = 0; row < 8; row++) {
+            bool set = (line >> row) & 1;
+            if (!set && !fillBackground) continue;
+            uint16_t pixel = set ? (uint16_t)color : (uint16_t)bg;
+            if (size == 1) {
+                drawPixel(x + col, y + row, pixel);
+            } else {
+                fillRect(x + col * size, y + row * size, size, size, pixel);
+            }
+        }
+    }
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (c == '\r') return 1;
+    if (c == '\n') {
+        cursorY += 8 * textSize;
+        cursorX = 0;
+        return 1;
+    }
+
+    if (textWrapX && (cursorX + 6 * textSize > _width)) {
+        cursorY += 8 * textSize;
+        cursorX = 0;
+    }
+    if (textWrapY && cursorY >= _height) {
+        cursorY = 0;
+    }
+
+    drawChar(cursorX, cursorY, c, textColor, textBgColor, textSize);
+    cursorX += 6 * textSize;
+    return 1;
+}
+
+size_t TFT_eSPI::print(const char* text) {
+    size_t count = 0;
+    for (const char* c = text; *c; c++) {
+        count += write((uint8_t)*c);
+    }
+    return count;
+}
+
+//============================================================================
+// SPRITES
+//============================================================================
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0) {
+    parent = tft;
+    isCreated = false;
+    storeSwapped = true;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+    (void)frames;
+    if (isCreated) return pixels.data();
+    if (w <= 0 || h <= 0) return nullptr;
+
+    _width = w;
+    _height = h;
+    pixels.assign((size_t)w * h, 0);
+    isCreated = true;
+    return pixels.data();
+}
+
+void TFT_eSprite::deleteSprite() {
+    pixels.clear();
+    pixels.shrink_to_fit();
+    _width = 0;
+    _height = 0;
+    isCreated = false;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    pushSprite(x, y, 0, 0, _width, _height);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+    if (!isCreated || parent == nullptr) return false;
+    if (sx < 0 || sy < 0 || sw <= 0 || sh <= 0 || sx + sw > _width || sy + sh > _height) return false;
+
+    // Stored pixels are already in panel byte order
+    bool oldSwapBytes = parent->getSwapBytes();
+    parent->setSwapBytes(false);
+    if (sx == 0 && sw == _width) {
+        parent->pushImage(tx, ty, sw, sh, pixels.data() + sy * _width);
+    } else {
+        for (int32_t row = 0; row < sh; row++) {
+            parent->pushImage(tx, ty + row, sw, 1, pixels.data() + sx + (sy + row) * _width);
+        }
+    }
+    parent->setSwapBytes(oldSwapBytes);
+    return true;
+}
@@ -0,0 +1,187 @@
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+// Host stand-in for Bodmer's TFT_eSPI. The "panel" is a block of memory in
+// RGB565 so headless runs can inspect what would have been on screen. Only
+// the API surface the game uses is provided, with the same signatures and
+// the same GLCD text layout (6x8 cells, scaled by the text size).
+
+#include "Arduino.h"
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 170
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 20000000
+#endif
+
+// Colour definitions, same values as TFT_eSPI.h
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+#define TFT_TRANSPARENT 0x0120
+
+class TFT_eSPI {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void init(uint8_t tc = 0);
+    void begin(uint8_t tc = 0) { init(tc); }
+    void setRotation(uint8_t r);
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    // Graphics primitives
+    void fillScreen(uint32_t color);
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    uint16_t readPixel(int32_t x, int32_t y) const;
+
+    // Bulk pixel transfers
+    void setSwapBytes(bool swap) { swapBytes = swap; }
+    bool getSwapBytes() const { return swapBytes; }
+    void startWrite() {}
+    void endWrite() {}
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushColor(uint16_t color);
+    void pushPixels(const void* data, uint32_t len);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data, uint16_t transparent);
+
+    // DMA. The host engine is a mock: a transfer completes once the virtual
+    // clock has moved on by the time it would take on the SPI bus, and the
+    // source buffer must not change until then (checked on completion).
+    bool initDMA(bool ctrl_cs = false);
+    void deInitDMA();
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const* data, uint16_t* buffer = nullptr);
+    bool dmaBusy();
+    void dmaWait();
+
+    // Text (GLCD font only)
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+    void setTextSize(uint8_t size);
+    void setTextWrap(bool wrapX, bool wrapY = false) { textWrapX = wrapX; textWrapY = wrapY; }
+    void setCursor(int16_t x, int16_t y);
+    int16_t getCursorX() const { return cursorX; }
+    int16_t getCursorY() const { return cursorY; }
+    int16_t textWidth(const char* text) const;
+    int16_t fontHeight() const { return 8 * textSize; }
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+
+    size_t write(uint8_t c);
+    size_t print(const char* text);
+    size_t print(const String& text) { return print(text.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return print(String(value)); }
+    size_t print(long value) { return print(String(value)); }
+    size_t println(const char* text) { size_t n = print(text); return n + write('\n'); }
+    size_t println(const String& text) { return println(text.c_str()); }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    // Host-only inspection of the panel contents
+    const uint16_t* hostPixels() const { return pixels.data(); }
+    uint64_t hostPixelsWritten() const { return pixelsWritten; }
+    uint32_t hostDmaTransfers() const { return dmaTransfers; }
+    uint32_t hostDmaOwnershipViolations() const { return dmaViolations; }
+
+protected:
+    int16_t _width;
+    int16_t _height;
+    std::vector<uint16_t> pixels;
+    uint64_t pixelsWritten;
+
+    // Sprites keep their pixels byte-swapped (ready to stream to the panel),
+    // like the real library, so code poking getPointer() behaves the same.
+    bool storeSwapped;
+
+    void writePixel(int32_t x, int32_t y, uint16_t color) {
+        pixels[y * _width + x] = storeSwapped ? (uint16_t)((color >> 8) | (color << 8)) : color;
+        pixelsWritten++;
+    }
+
+private:
+    int16_t nativeWidth;
+    int16_t nativeHeight;
+    uint8_t rotation;
+    bool swapBytes;
+
+    // Address window for pushColor/pushPixels
+    int32_t windowX, windowY, windowW, windowH;
+    int32_t windowCursor;
+
+    // Mock DMA engine state
+    bool dmaReady;
+    bool dmaActive;
+    int32_t dmaX, dmaY, dmaW, dmaH;
+    const uint16_t* dmaSource;
+    std::vector<uint16_t> dmaSnapshot;
+    uint64_t dmaDoneAt;
+    bool dmaSwap;
+    uint32_t dmaTransfers;
+    uint32_t dmaViolations;
+    void completeDMA();
+
+    int16_t cursorX, cursorY;
+    uint8_t textSize;
+    uint16_t textColor, textBgColor;
+    bool textWrapX, textWrapY;
+};
+
+// Off-screen 16-bit sprite. Drawing works exactly like on the panel; the
+// pixels live in RAM until pushSprite() copies them to the parent.
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* tft);
+    ~TFT_eSprite() { deleteSprite(); }
+
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() const { return isCreated; }
+    void* getPointer() { return isCreated ? pixels.data() : nullptr; }
+
+    void setColorDepth(int8_t bits) { (void)bits; }  // Only 16-bit is modelled
+    void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void pushSprite(int32_t x, int32_t y);
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+private:
+    TFT_eSPI* parent;
+    bool isCreated;
+};
+
+#endif
@@ -0,0 +1,89 @@
+#include "WString.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+String::String(int value) : buffer(std::to_string(value)) {}
+String::String(unsigned int value) : buffer(std::to_string(value)) {}
+String::String(long value) : buffer(std::to_string(value)) {}
+String::String(unsigned long value) : buffer(std::to_string(value)) {}
+String::String(long long value) : buffer(std::to_string(value)) {}
+String::String(unsigned long long value) : buffer(std::to_string(value)) {}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces) {
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", (int)decimalPlaces, value);
+    buffer = text;
+}
+
+String String::substring(unsigned int from) const {
+    return substring(from, length());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    // Arduino swaps reversed bounds and clamps to the string length
+    if (from > to) {
+        unsigned int temp = from;
+        from = to;
+        to = temp;
+    }
+    if (from >= buffer.length()) return String();
+    if (to > buffer.length()) to = (unsigned int)buffer.length();
+    return String(buffer.substr(from, to - from));
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = buffer.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    size_t pos = buffer.find(text.buffer, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t pos = buffer.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c, unsigned int from) const {
+    size_t pos = buffer.rfind(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+long String::toInt() const {
+    return strtol(buffer.c_str(), nullptr, 10);
+}
+
+bool String::startsWith(const String& prefix) const {
+    return buffer.compare(0, prefix.buffer.length(), prefix.buffer) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    if (suffix.buffer.length() > buffer.length()) return false;
+    return buffer.compare(buffer.length() - suffix.buffer.length(), suffix.buffer.length(), suffix.buffer) == 0;
+}
+
+void String::trim() {
+    size_t start = buffer.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) {
+        buffer.clear();
+        return;
+    }
+    size_t end = buffer.find_last_not_of(" \t\r\n");
+    buffer = buffer.substr(start, end - start + 1);
+}
+
+String operator+(const String& lhs, const String& rhs) { String result(lhs); result += rhs; return result; }
+String operator+(const String& lhs, const char* rhs) { String result(lhs); result += rhs; return result; }
+String operator+(const char* lhs, const String& rhs) { String result(lhs); result += rhs; return result; }
+String operator+(const String& lhs, char rhs) { String result(lhs); result += rhs; return result; }
+String operator+(const String& lhs, int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, float rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, double rhs) { return lhs + String(rhs); }
@@ -0,0 +1,75 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <string>
+#include <cstddef>
+
+// Host version of the Arduino String class. Only the parts of the API the
+// game actually uses are provided; behaviour matches the Arduino core
+// (numbers format in base 10, floats with two decimals).
+class String {
+private:
+    std::string buffer;
+
+public:
+    String() {}
+    String(const char* text) : buffer(text ? text : "") {}
+    String(const std::string& text) : buffer(text) {}
+    explicit String(char c) : buffer(1, c) {}
+    explicit String(int value);
+    explicit String(unsigned int value);
+    explicit String(long value);
+    explicit String(unsigned long value);
+    explicit String(long long value);
+    explicit String(unsigned long long value);
+    explicit String(float value, unsigned int decimalPlaces = 2);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+
+    unsigned int length() const { return (unsigned int)buffer.length(); }
+    const char* c_str() const { return buffer.c_str(); }
+    char charAt(unsigned int index) const { return index < buffer.length() ? buffer[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(char c, unsigned int from) const;
+    long toInt() const;
+    bool startsWith(const String& prefix) const;
+    bool endsWith(const String& suffix) const;
+    void reserve(unsigned int size) { buffer.reserve(size); }
+    void trim();
+    bool isEmpty() const { return buffer.empty(); }
+
+    String& operator+=(const String& other) { buffer += other.buffer; return *this; }
+    String& operator+=(const char* text) { if (text) buffer += text; return *this; }
+    String& operator+=(char c) { buffer += c; return *this; }
+    String& operator+=(int value) { return *this += String(value); }
+    String& operator+=(unsigned int value) { return *this += String(value); }
+    String& operator+=(long value) { return *this += String(value); }
+    String& operator+=(unsigned long value) { return *this += String(value); }
+
+    bool equals(const String& other) const { return buffer == other.buffer; }
+    bool operator==(const String& other) const { return buffer == other.buffer; }
+    bool operator!=(const String& other) const { return buffer != other.buffer; }
+    bool operator==(const char* text) const { return buffer == (text ? text : ""); }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool operator<(const String& other) const { return buffer < other.buffer; }
+
+    const std::string& str() const { return buffer; }
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(const String& lhs, int rhs);
+String operator+(const String& lhs, unsigned int rhs);
+String operator+(const String& lhs, long rhs);
+String operator+(const String& lhs, unsigned long rhs);
+String operator+(const String& lhs, float rhs);
+String operator+(const String& lhs, double rhs);
+
+#endif
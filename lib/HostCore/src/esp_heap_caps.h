@@ -0,0 +1,40 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+// Host version of the ESP-IDF capability allocator: every capability is
+// satisfied by the normal heap.
+#include <stdint.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+inline void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+// Size of the heap block behind ptr, as the allocator rounded it
+inline size_t heap_caps_get_allocated_size(void* ptr) {
+    return malloc_usable_size(ptr);
+}
+
+// The host heap has no fixed size to report: 0 means "unknown"
+inline size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    return 0;
+}
+
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    (void)caps;
+    return 0;
+}
+
+#endif
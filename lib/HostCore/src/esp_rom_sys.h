@@ -0,0 +1,18 @@
+#ifndef HOST_ESP_ROM_SYS_H
+#define HOST_ESP_ROM_SYS_H
+
+// ROM printf: unbuffered console output that works from the panic handler.
+// On the host it goes straight to stdout, even with --quiet.
+#include <stdarg.h>
+#include <stdio.h>
+
+inline int esp_rom_printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = vprintf(format, args);
+    va_end(args);
+    fflush(stdout);
+    return length;
+}
+
+#endif
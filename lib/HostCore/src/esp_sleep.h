@@ -0,0 +1,14 @@
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+// Host version of ESP-IDF light sleep. esp_light_sleep_start() moves the
+// virtual clock forward to whichever comes first: the timer wakeup or the
+// scripted button event that puts a wakeup pin at its trigger level.
+#include <stdint.h>
+#include "esp_err.h"
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_light_sleep_start();
+
+#endif
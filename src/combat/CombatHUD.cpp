@@ -1,184 +1,215 @@
-// src/combat/CombatHUD.cpp - Updated to clear all areas on victory/defeat screens
+// src/combat/CombatHUD.cpp - Combat stats, sprites and result screens
 #include "CombatHUD.h"
 #include "../graphics/VictoryScreen.h"
 #include "../utils/constants.h"
+#include "../utils/FixedString.h"
 
-CombatHUD::CombatHUD(Display* disp) {
+// One line of HUD text
+typedef FixedString<32> HudText;
+
+// Victory image, doubled and centred above the prompt text
+#define VICTORY_SCALE 2
+#define VICTORY_X ((SCREEN_WIDTH - VICTORY_IMAGE_WIDTH * VICTORY_SCALE) / 2)
+#define VICTORY_Y 10  // Small margin from top
+
+CombatHUD::CombatHUD(Display* disp)
+    : spriteLayer(disp, &gameSprites, 0, SPRITE_BAND_Y, Display::WIDTH, SPRITE_BAND_HEIGHT),
+      screen(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      playerName(PLAYER_INFO_X, INFO_START_Y, "WIZARD"),
+      playerHP(PLAYER_INFO_X, INFO_START_Y + LINE_HEIGHT),
+      playerMana(PLAYER_INFO_X, INFO_START_Y + 2 * LINE_HEIGHT),
+      playerDefense(PLAYER_INFO_X, INFO_START_Y + 3 * LINE_HEIGHT),
+      playerEffects(PLAYER_INFO_X, INFO_START_Y + 4 * LINE_HEIGHT),
+      enemyName(ENEMY_INFO_X, INFO_START_Y, "", TFT_RED),
+      enemyHP(ENEMY_INFO_X, INFO_START_Y + LINE_HEIGHT),
+      enemyAttack(ENEMY_INFO_X, INFO_START_Y + 2 * LINE_HEIGHT),
+      enemyDefense(ENEMY_INFO_X, INFO_START_Y + 3 * LINE_HEIGHT),
+      enemyAI(ENEMY_INFO_X, INFO_START_Y + 4 * LINE_HEIGHT, "", 0x8410),  // Gray color for AI type
+      enemyEffects(ENEMY_INFO_X, INFO_START_Y + 5 * LINE_HEIGHT),
+      turnLabel(PLAYER_INFO_X, 180),
+      field(0, SPRITE_BAND_Y, SCREEN_WIDTH, SCREEN_HEIGHT - SPRITE_BAND_Y),
+      victoryPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      victoryArea(VICTORY_X, VICTORY_Y, VICTORY_IMAGE_WIDTH * VICTORY_SCALE, VICTORY_IMAGE_HEIGHT * VICTORY_SCALE),
+      victoryPrompt1(25, 280, "Press any button"),
+      victoryPrompt2(45, 295, "to continue"),
+      defeatPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      defeatTitle(50, 60, "DEFEAT!", TFT_RED, 2),
+      defeatPrompt(10, 175, "Press any button") {
     display = disp;
+    
+    // NEW: Both combatants live on the sprite layer for the life of the HUD
+    playerSprite = spriteLayer.add(gameSprites.find("wizard"), PLAYER_SPRITE_X, SPRITE_BAND_Y, SPRITE_SCALE);
+    enemySprite = spriteLayer.add(gameSprites.find("default"), ENEMY_SPRITE_X, SPRITE_BAND_Y, SPRITE_SCALE);
+    
+    // Field first so the turn counter draws on top of it; enemy stats after
+    // the player's so a long shield line stays underneath them
+    screen.add(&field);
+    screen.add(&playerName);
+    screen.add(&playerHP);
+    screen.add(&playerMana);
+    screen.add(&playerDefense);
+    screen.add(&playerEffects);
+    screen.add(&enemyName);
+    screen.add(&enemyHP);
+    screen.add(&enemyAttack);
+    screen.add(&enemyDefense);
+    screen.add(&enemyAI);
+    screen.add(&enemyEffects);
+    screen.add(&turnLabel);
+    
+    victoryPanel.add(&victoryArea);
+    victoryPanel.add(&victoryPrompt1);
+    victoryPanel.add(&victoryPrompt2);
+    
+    // Explain what happens
+    defeatLines[0].moveTo(20, 100);
+    defeatLines[0].setText("Your magic failed");
+    defeatLines[1].moveTo(20, 115);
+    defeatLines[1].setText("in the dungeon...");
+    defeatLines[2].moveTo(15, 140);
+    defeatLines[2].setText("All progress lost!");
+    defeatLines[3].moveTo(20, 155);
+    defeatLines[3].setText("Spells forgotten!");
+    defeatPanel.add(&defeatTitle);
+    for (int i = 0; i < 4; i++) {
+        defeatPanel.add(&defeatLines[i]);
+    }
+    defeatPanel.add(&defeatPrompt);
 }
 
 void CombatHUD::drawFullCombatScreen(Player* player, Enemy* enemy, int turnCounter) {
-    // Clear the entire screen first to remove ALL door choice remnants
-    clearEntireScreen();
+    updatePlayerInfo(player);
+    updateEnemyInfo(enemy);
+    updateTurnInfo(turnCounter);
     
-    // Draw combat info
-    drawPlayerInfo(player);
-    drawEnemyInfo(enemy);
-    drawTurnInfo(turnCounter);
+    // Takes over from the door choice widgets without a full clear
+    screen.show(display);
+    
+    // NEW: The band was just taken over, so it is redrawn in full
+    updateSprites(enemy);
+    spriteLayer.invalidate();
+    spriteLayer.compose();
     
     // Note: Text box and spell menu will be drawn by their respective systems
 }
 
 void CombatHUD::updateCombatStats(Player* player, Enemy* enemy, int turnCounter) {
-    // Only update the HUD info area, not the whole screen
-    clearHUDInfoArea();
-    drawPlayerInfo(player);
-    drawEnemyInfo(enemy);
-    drawTurnInfo(turnCounter);
+    // Only the stat lines that changed are repainted
+    updatePlayerInfo(player);
+    updateEnemyInfo(enemy);
+    updateTurnInfo(turnCounter);
+    screen.render(display);
+    
+    // NEW: Sprites are left alone unless one of them changed
+    updateSprites(enemy);
+    spriteLayer.compose();
     
     // Note: This preserves both text box and spell menu areas
 }
 
+const SpriteFrame* CombatHUD::findEnemySprite(Enemy* enemy) {
+    // Enemy sprite files are named after the enemy ("enemies/Goblin.bmp")
+    const SpriteFrame* sprite = gameSprites.find(enemy->getSpriteFile());
+    if (sprite == nullptr) {
+        sprite = gameSprites.find("default");
+    }
+    return sprite;
+}
+
+void CombatHUD::updateSprites(Enemy* enemy) {
+    spriteLayer.setSprite(enemySprite, findEnemySprite(enemy));
+    spriteLayer.setVisible(enemySprite, enemy->isAlive());
+}
+
 void CombatHUD::clearSpriteAndHUDArea() {
     // Clear the top area including where floor progress text might be
     // This needs to clear up to y=210 to remove any floor progress text from DoorChoice
     display->fillRect(0, 0, Display::WIDTH, 210, TFT_BLACK);
 }
 
-void CombatHUD::clearHUDInfoArea() {
-    // Clear only the HUD info section, preserving sprites above and text/menu below
-    display->fillRect(0, INFO_START_Y, Display::WIDTH, 120, TFT_BLACK);
-}
-
 void CombatHUD::clearCombatArea() {
     // Legacy method - clear everything except spell menu
     display->fillRect(0, 0, Display::WIDTH, 260, TFT_BLACK);
 }
 
-void CombatHUD::clearEntireScreen() {
-    // NEW: Clear the entire screen including text box and spell menu areas
-    display->fillRect(0, 0, Display::WIDTH, Display::HEIGHT, TFT_BLACK);
-}
-
-void CombatHUD::drawPlayerInfo(Player* player) {
-    int y = INFO_START_Y;
-    
-    // Player name in purple (wizard theme)
-    display->drawText("WIZARD", PLAYER_INFO_X, y, TFT_WHITE);
-    y += LINE_HEIGHT;
-    
+void CombatHUD::updatePlayerInfo(Player* player) {
     // Health with color coding
-    String hpText = "HP: " + String(player->getCurrentHP()) + "/" + String(player->getMaxHP());
     uint16_t hpColor = (player->getCurrentHP() < player->getMaxHP() / 3) ? TFT_RED : TFT_WHITE;
-    display->drawText(hpText.c_str(), PLAYER_INFO_X, y, hpColor);
-    y += LINE_HEIGHT;
+    playerHP.set(HudText::format("HP: %d/%d", player->getCurrentHP(), player->getMaxHP()), hpColor);
     
     // Mana (for wizard)
-    String manaText = "MP: " + String(player->getCurrentMana()) + "/" + String(player->getMaxMana());
     uint16_t manaColor = (player->getCurrentMana() < player->getMaxMana() / 4) ? TFT_RED : TFT_BLUE;
-    display->drawText(manaText.c_str(), PLAYER_INFO_X, y, manaColor);
-    y += LINE_HEIGHT;
+    playerMana.set(HudText::format("MP: %d/%d", player->getCurrentMana(), player->getMaxMana()), manaColor);
     
     // Show magical defense (show total defense including shields)
-    String defText = "DEF: " + String(player->getTotalDefense());
+    HudText defText = HudText::format("DEF: %d", player->getTotalDefense());
     uint16_t defColor = player->getIsDefending() ? TFT_BLUE : TFT_WHITE;
     if (player->getShieldValue() > 0) {
         defColor = TFT_WHITE; // Show shields in cyan
-        defText += " (+" + String(player->getShieldValue()) + " shield)";
+        defText.appendf(" (+%d shield)", player->getShieldValue());
     }
-    display->drawText(defText.c_str(), PLAYER_INFO_X, y, defColor);
-    y += LINE_HEIGHT;
+    playerDefense.set(defText, defColor);
     
     // Show active spell effects count
-    auto activeEffects = player->getActiveEffects();
-    if (!activeEffects.empty()) {
-        display->drawText(("Effects: " + String(activeEffects.size())).c_str(), 
-                         PLAYER_INFO_X, y, TFT_WHITE);
-    }
+    const auto& activeEffects = player->getActiveEffects();
+    playerEffects.setText(HudText::format("Effects: %d", (int)activeEffects.size()));
+    playerEffects.setVisible(!activeEffects.empty());
 }
 
-void CombatHUD::drawEnemyInfo(Enemy* enemy) {
-    int y = INFO_START_Y;
-    
+void CombatHUD::updateEnemyInfo(Enemy* enemy) {
     // Enemy name in red
-    display->drawText(enemy->getName().c_str(), ENEMY_INFO_X, y, TFT_RED);
-    y += LINE_HEIGHT;
+    enemyName.setText(enemy->getName());
     
     // Health with color coding
-    String hpText = "HP: " + String(enemy->getCurrentHP()) + "/" + String(enemy->getMaxHP());
     uint16_t hpColor = (enemy->getCurrentHP() < enemy->getMaxHP() / 3) ? TFT_RED : TFT_WHITE;
-    display->drawText(hpText.c_str(), ENEMY_INFO_X, y, hpColor);
-    y += LINE_HEIGHT;
+    enemyHP.set(HudText::format("HP: %d/%d", enemy->getCurrentHP(), enemy->getMaxHP()), hpColor);
     
-    // Attack stat
-    display->drawText(("ATK: " + String(enemy->getAttack())).c_str(), 
-                     ENEMY_INFO_X, y, TFT_WHITE);
-    y += LINE_HEIGHT;
+    // Attack stat (weakened shows in red)
+    uint16_t atkColor = (enemy->getEffectiveAttack() < enemy->getAttack()) ? TFT_RED : TFT_WHITE;
+    enemyAttack.set(HudText::format("ATK: %d", enemy->getEffectiveAttack()), atkColor);
     
     // Defense stat (show total defense including temporary)
-    String defText = "DEF: " + String(enemy->getTotalDefense());
     uint16_t defColor = enemy->getIsDefending() ? TFT_BLUE : TFT_WHITE;
-    display->drawText(defText.c_str(), ENEMY_INFO_X, y, defColor);
-    y += LINE_HEIGHT;
+    enemyDefense.set(HudText::format("DEF: %d", enemy->getTotalDefense()), defColor);
     
-    // Show AI type
-    String aiText = "AI: ";
+    // Show AI type (no "AI: " prefix, so the longest still fits the column)
+    const char* aiText;
     switch(enemy->getAIType()) {
-        case AI_AGGRESSIVE: aiText += "Aggressive"; break;
-        case AI_DEFENSIVE: aiText += "Defensive"; break;
-        case AI_BERSERKER: aiText += "Berserker"; break;
+        case AI_AGGRESSIVE: aiText = "Aggressive"; break;
+        case AI_DEFENSIVE: aiText = "Defensive"; break;
+        case AI_BERSERKER: aiText = "Berserker"; break;
         case AI_BALANCED: 
-        default: aiText += "Balanced"; break;
+        default: aiText = "Balanced"; break;
     }
-    display->drawText(aiText.c_str(), ENEMY_INFO_X, y, 0x8410); // Gray color for AI type
+    enemyAI.setText(aiText);
+    
+    // Burns and debuffs on it
+    const auto& activeEffects = enemy->getActiveEffects();
+    enemyEffects.setText(HudText::format("Effects: %d", (int)activeEffects.size()));
+    enemyEffects.setVisible(!activeEffects.empty());
 }
 
-void CombatHUD::drawTurnInfo(int turnCounter) {
+void CombatHUD::updateTurnInfo(int turnCounter) {
     // Turn counter in yellow (positioned to not overlap with other info)
-    display->drawText(("Turn: " + String(turnCounter)).c_str(), 
-                     PLAYER_INFO_X, 180, TFT_WHITE);
+    turnLabel.setText(HudText::format("Turn: %d", turnCounter));
 }
 
 void CombatHUD::drawVictoryScreen() {
-    // Clear the entire screen including text box and spell menu
-    clearEntireScreen();
-    
-    // Draw the victory image
+    // Erases the stats, sprites, text box and spell menu; the image fills
+    // the area the panel keeps for it
+    victoryPanel.show(display);
     drawVictoryImage();
-    
-    // Draw "Press any button to continue" at the bottom, below the image
-    display->drawText("Press any button", 25, 280, TFT_WHITE, 1);
-    display->drawText("to continue", 45, 295, TFT_WHITE, 1);
 }
 
-
 void CombatHUD::drawDefeatScreen() {
-    // UPDATED: Clear the entire screen including text box and spell menu
-    clearEntireScreen();
-    
-    // Large defeat text
-    display->drawText("DEFEAT!", 50, 60, TFT_RED, 2);
-    
-    // Explain what happens
-    display->drawText("Your magic failed", 20, 100, TFT_WHITE);
-    display->drawText("in the dungeon...", 20, 115, TFT_WHITE);
-    
-    display->drawText("All progress lost!", 15, 140, TFT_WHITE);
-    display->drawText("Spells forgotten!", 20, 155, TFT_WHITE);
-    
-    // Instructions
-    display->drawText("Press any button", 10, 175, TFT_WHITE);
+    // UPDATED: Takes over from the whole combat screen, text box and spell menu included
+    defeatPanel.show(display);
 }
 
 void CombatHUD::drawVictoryImage() {
-    // Display the victory image from victory_screen.h
-    int imageX = 0;  // Start at left edge (full width)
-    int imageY = 10; // Small margin from top
-    
-    // Method 1: Draw pixel by pixel (if you have RGB565 data)
-    for (int y = 0; y < VICTORY_IMAGE_HEIGHT && y + imageY < 260; y++) {
-        for (int x = 0; x < VICTORY_IMAGE_WIDTH && x < Display::WIDTH; x++) {
-            // Read pixel from PROGMEM 
-            uint16_t pixelColor = pgm_read_word(&victoryImageData[y * VICTORY_IMAGE_WIDTH + x]);
-            
-            // Fix blue tinting issue - check if your image data is in correct RGB565 format
-            // If the image appears blue, your data might be BGR instead of RGB
-            // You can swap the bytes here if needed:
-            // pixelColor = ((pixelColor & 0x00FF) << 8) | ((pixelColor & 0xFF00) >> 8);
-            
-            display->drawPixel(imageX + x, imageY + y, pixelColor);
-        }
-    }
+    // Display the victory image from VictoryScreen.h (RLE asset in flash),
+    // doubled to 120x180 and centred above the prompt text
+    display->drawImage(victoryImage, VICTORY_X, VICTORY_Y, VICTORY_SCALE);
 }
 
 void CombatHUD::drawNewCombatPrompt() {
@@ -5,6 +5,8 @@
 #include "../graphics/Display.h"
 #include "../entities/player.h"
 #include "../entities/enemy.h"
+#include "../graphics/SpriteLayer.h"
+#include "../ui/Widgets.h"
 
 class CombatHUD {
 private:
@@ -17,19 +19,49 @@ private:
     static const int INFO_START_Y = 20;
     static const int LINE_HEIGHT = 15;
     
-    // Drawing helper methods
-    void drawPlayerInfo(Player* player);
-    void drawEnemyInfo(Enemy* enemy);
-    void drawTurnInfo(int turnCounter);
+    // NEW: Combatant sprites (24x24 atlas frames drawn at 3x) between the
+    // stat lines and the turn counter
+    static const int SPRITE_BAND_Y = 104;
+    static const int SPRITE_BAND_HEIGHT = 72;
+    static const int SPRITE_SCALE = 3;
+    static const int PLAYER_SPRITE_X = 10;
+    static const int ENEMY_SPRITE_X = 88;
     
-    // NEW: Victory image drawing methods
-    void drawVictoryImage();         // Draw victory image pixel by pixel
-    void drawVictoryImageFast();     // Alternative faster method using pushImage
+    SpriteLayer spriteLayer;
+    int playerSprite;
+    int enemySprite;
+    
+    // NEW: Combat screen panel. The stat lines are labels; the sprite band,
+    // text box and spell menu below them are painted by their own code and
+    // held as one canvas, so entering combat only erases the door choice
+    // widgets and a turn only repaints the stats that changed.
+    Panel screen;
+    Label playerName, playerHP, playerMana, playerDefense, playerEffects;
+    Label enemyName, enemyHP, enemyAttack, enemyDefense, enemyAI, enemyEffects;
+    Label turnLabel;
+    Canvas field;
+    
+    // Result screens, taken over from the combat screen the same way
+    Panel victoryPanel;
+    Canvas victoryArea;  // The victory image
+    Label victoryPrompt1, victoryPrompt2;
+    
+    Panel defeatPanel;
+    Label defeatTitle, defeatLines[4], defeatPrompt;
+    
+    const SpriteFrame* findEnemySprite(Enemy* enemy);
+    void updateSprites(Enemy* enemy);
+    
+    // Widget updates
+    void updatePlayerInfo(Player* player);
+    void updateEnemyInfo(Enemy* enemy);
+    void updateTurnInfo(int turnCounter);
+    
+    // NEW: Victory image drawing (decoded from the RLE asset in one window)
+    void drawVictoryImage();
     
     // Area-specific clearing methods
     void clearSpriteAndHUDArea();    // Clear y=0 to y=200 (preserve text box + spell menu)
-    void clearHUDInfoArea();         // Clear only HUD info section for updates
-    void clearEntireScreen();        // Clear the entire screen including text box and spell menu
     
 public:
     CombatHUD(Display* disp);
@@ -1,4 +1,5 @@
 #include "CombatTextBox.h"
+#include "../debug/Log.h"
 
 CombatTextBox::CombatTextBox(Display* disp) {
     display = disp;
@@ -8,7 +9,7 @@ CombatTextBox::CombatTextBox(Display* disp) {
     textHeight = 40;
     needsRedraw = true;
     isVisible = true;  // Start visible
-    textLines.clear();
+    lineCount = 0;
 }
 
 void CombatTextBox::setTextArea(int x, int y, int width, int height) {
@@ -19,64 +20,66 @@ void CombatTextBox::setTextArea(int x, int y, int width, int height) {
     needsRedraw = true;
 }
 
-void CombatTextBox::addText(String text) {
+void CombatTextBox::addText(const char* text) {
     addText(text, TFT_WHITE);
 }
 
-void CombatTextBox::addText(String text, uint16_t color) {
+void CombatTextBox::addText(const char* text, uint16_t color) {
     // For now, ignore color (we can enhance this later)
     // Wrap text to fit the display width
-    std::vector<String> wrappedLines;
-    wrapText(text, wrappedLines);
-    
-    // Add wrapped lines to our text buffer
-    for (String line : wrappedLines) {
-        textLines.push_back(line);
-        
-        // If we have too many lines, remove the oldest
-        if (textLines.size() > MAX_LINES) {
-            textLines.erase(textLines.begin());
+    wrapText(text);
+    needsRedraw = true;
+}
+
+// Appends one line, dropping the oldest when the box is full
+void CombatTextBox::pushLine(const char* text, int length) {
+    if (lineCount == MAX_LINES) {
+        for (int i = 1; i < MAX_LINES; i++) {
+            textLines[i - 1] = textLines[i];
         }
+        lineCount--;
     }
-    
-    needsRedraw = true;
+    textLines[lineCount].clear();
+    textLines[lineCount].append(text, length);
+    lineCount++;
 }
 
-void CombatTextBox::wrapText(String text, std::vector<String>& wrappedLines) {
-    if (text.length() <= MAX_CHARS_PER_LINE) {
+void CombatTextBox::wrapText(const char* text) {
+    int length = strlen(text);
+    if (length <= MAX_CHARS_PER_LINE) {
         // Text fits on one line
-        wrappedLines.push_back(text);
+        pushLine(text, length);
         return;
     }
     
     // Text needs to be wrapped
     int start = 0;
-    while (start < text.length()) {
+    while (start < length) {
         int end = start + MAX_CHARS_PER_LINE;
         
-        if (end >= text.length()) {
+        if (end >= length) {
             // Last piece fits
-            wrappedLines.push_back(text.substring(start));
+            pushLine(text + start, length - start);
             break;
         }
         
         // Try to find a good break point (space)
         int breakPoint = end;
         for (int i = end; i > start; i--) {
-            if (text.charAt(i) == ' ') {
+            if (text[i] == ' ') {
                 breakPoint = i;
                 break;
             }
         }
         
         // Add the line and continue
-        wrappedLines.push_back(text.substring(start, breakPoint));
+        pushLine(text + start, breakPoint - start);
         start = (breakPoint == end) ? end : breakPoint + 1; // Skip the space
     }
 }
 
 void CombatTextBox::clearText() {
-    textLines.clear();
+    lineCount = 0;
     needsRedraw = true;
 }
 
@@ -124,7 +127,7 @@ void CombatTextBox::drawTextArea() {
     int lineHeight = 12;  // Height per line
     int padding = 2;      // Padding from border
     
-    for (int i = 0; i < textLines.size(); i++) {
+    for (int i = 0; i < lineCount; i++) {
         int yPos = textY + padding + (i * lineHeight);
         
         // Make sure we don't draw outside the text area
@@ -135,44 +138,44 @@ void CombatTextBox::drawTextArea() {
 }
 
 // Combat-specific convenience methods
-void CombatTextBox::showPlayerAction(String playerName, String action) {
-    addText(playerName + " " + action);
+void CombatTextBox::showPlayerAction(FlashString playerName, const char* action) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("%s %s", playerName.c_str(), action).c_str());
 }
 
-void CombatTextBox::showEnemyAction(String enemyName, String action) {
-    addText(enemyName + " " + action);
+void CombatTextBox::showEnemyAction(FlashString enemyName, const char* action) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("%s %s", enemyName.c_str(), action).c_str());
 }
 
-void CombatTextBox::showDamage(String target, int damage) {
-    addText(target + " takes " + String(damage) + " damage!");
+void CombatTextBox::showDamage(FlashString target, int damage) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("%s takes %d damage!", target.c_str(), damage).c_str());
 }
 
-void CombatTextBox::showHealing(String target, int healing) {
-    addText(target + " heals " + String(healing) + " HP!");
+void CombatTextBox::showHealing(FlashString target, int healing) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("%s heals %d HP!", target.c_str(), healing).c_str());
 }
 
-void CombatTextBox::showSpellCast(String caster, String spellName) {
-    addText(caster + " casts " + spellName + "!");
+void CombatTextBox::showSpellCast(FlashString caster, FlashString spellName) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("%s casts %s!", caster.c_str(), spellName.c_str()).c_str());
 }
 
-void CombatTextBox::showTurnResult(String result) {
-    addText("= " + result + " =");
+void CombatTextBox::showTurnResult(const char* result) {
+    addText(FixedString<COMBAT_TEXT_MAX>::format("= %s =", result).c_str());
 }
 
 // NEW: Show synergy bonus
-void CombatTextBox::showSynergyBonus(String spellName, int bonus) {
-    Serial.println("DEBUG CombatTextBox::showSynergyBonus() CALLED!");
-    Serial.println("DEBUG - spellName: " + spellName);
-    Serial.println("DEBUG - bonus: " + String(bonus));
-    Serial.println("DEBUG - isVisible: " + String(isVisible ? "true" : "false"));
+void CombatTextBox::showSynergyBonus(FlashString spellName, int bonus) {
+    LOG_DEBUG(COMBAT, "CombatTextBox::showSynergyBonus() CALLED!");
+    LOG_DEBUG(COMBAT, "- spellName: %s", spellName.c_str());
+    LOG_DEBUG(COMBAT, "- bonus: %d", bonus);
+    LOG_DEBUG(COMBAT, "- isVisible: %s", isVisible ? "true" : "false");
     
     if (bonus > 0) {
-        String synergyText = "Synergy! +" + String(bonus) + " power!";
-        Serial.println("DEBUG - Adding text: " + synergyText);
-        addText(synergyText);
-        Serial.println("DEBUG - Text added, forcing redraw");
+        FixedString<COMBAT_TEXT_MAX> synergyText = FixedString<COMBAT_TEXT_MAX>::format("Synergy! +%d power!", bonus);
+        LOG_DEBUG(COMBAT, "- Adding text: %s", synergyText.c_str());
+        addText(synergyText.c_str());
+        LOG_DEBUG(COMBAT, "- Text added, forcing redraw");
         forceRedraw();
     } else {
-        Serial.println("DEBUG - No bonus to display (bonus <= 0)");
+        LOG_DEBUG(COMBAT, "- No bonus to display (bonus <= 0)");
     }
 }
\ No newline at end of file
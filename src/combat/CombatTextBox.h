@@ -2,9 +2,12 @@
 #define COMBAT_TEXTBOX_H
 
 #include "../graphics/Display.h"
-#include <vector>
+#include "../utils/FixedString.h"
 #include <Arduino.h>
 
+// Longest message the convenience methods build before wrapping
+#define COMBAT_TEXT_MAX 96
+
 class CombatTextBox {
 private:
     Display* display;
@@ -13,16 +16,18 @@ private:
     int textX, textY, textWidth, textHeight;
     
     // Text storage
-    std::vector<String> textLines;
     static const int MAX_LINES = 3;     // 3 lines fit in the compact text area
     static const int MAX_CHARS_PER_LINE = 30;  // Wider text area can fit more characters
+    FixedString<MAX_CHARS_PER_LINE + 1> textLines[MAX_LINES];  // Oldest first
+    int lineCount;
     
     // Display state
     bool needsRedraw;
     bool isVisible;  // Control visibility
     
     // Helper methods
-    void wrapText(String text, std::vector<String>& wrappedLines);
+    void pushLine(const char* text, int length);
+    void wrapText(const char* text);
     void scrollText();
     void drawTextArea();
     void clearTextArea();  // Method to clear the text area
@@ -34,8 +39,8 @@ public:
     void setTextArea(int x, int y, int width, int height);
     
     // Text management
-    void addText(String text);
-    void addText(String text, uint16_t color);
+    void addText(const char* text);
+    void addText(const char* text, uint16_t color);
     void clearText();
     
     // Display control
@@ -46,15 +51,15 @@ public:
     bool getIsVisible() const { return isVisible; }  // Check visibility
     
     // Combat-specific convenience methods
-    void showPlayerAction(String playerName, String action);
-    void showEnemyAction(String enemyName, String action);
-    void showDamage(String target, int damage);
-    void showHealing(String target, int healing);
-    void showSpellCast(String caster, String spellName);
-    void showTurnResult(String result);
+    void showPlayerAction(FlashString playerName, const char* action);
+    void showEnemyAction(FlashString enemyName, const char* action);
+    void showDamage(FlashString target, int damage);
+    void showHealing(FlashString target, int healing);
+    void showSpellCast(FlashString caster, FlashString spellName);
+    void showTurnResult(const char* result);
     
     // NEW: Synergy display method
-    void showSynergyBonus(String spellName, int bonus);
+    void showSynergyBonus(FlashString spellName, int bonus);
 };
 
 #endif
\ No newline at end of file
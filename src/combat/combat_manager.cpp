@@ -3,7 +3,9 @@
 #include "turn_queue.h"
 #include "../utils/constants.h"
 #include "../spells/spell.h"  // Include spell.h to get SpellLibrary definition
-#include "../combat/CombatTextBox.h"  // NEW: Include text box
+#include "../debug/Log.h"
+#include "../debug/Trace.h"
+#include "../debug/AllocTracker.h"
 
 // Constructor
 CombatManager::CombatManager() {
@@ -14,7 +16,7 @@ CombatManager::CombatManager() {
     actionsChosen = false;
     playerAction = ACTION_CAST_SPELL_1;  // Default to spell casting
     enemyAction = ENEMY_ATTACK;
-    textBox = nullptr;  // NEW: Initialize text box reference
+    lastTurn.clear();
 }
 
 // Start combat
@@ -32,7 +34,7 @@ void CombatManager::startCombat(Player* p, Enemy* e) {
     // Clear spell library recent casts for fresh combat
     player->getSpellLibrary()->clearRecentCasts();
     
-    Serial.println("Combat begins! " + player->getName() + " vs " + currentEnemy->getName());
+    LOG_INFO(COMBAT, "Combat begins! %s vs %s", player->getName().c_str(), currentEnemy->getName().c_str());
 }
 
 // End combat and cleanup
@@ -50,14 +52,23 @@ void CombatManager::endCombat() {
     currentState = COMBAT_CHOOSE_ACTIONS;
     turnCounter = 0;
     actionsChosen = false;
-    textBox = nullptr;  // NEW: Clear text box reference
 }
 
 // Process complete turn: choose actions + execute them
-CombatResult CombatManager::processTurn(PlayerAction action) {
+const TurnResult& CombatManager::processTurn(PlayerAction action) {
+    TurnResult& result = lastTurn;
+    result.clear();
+    result.turn = turnCounter;
+    result.outcome = RESULT_ONGOING;
     if (!player || !currentEnemy || currentState != COMBAT_CHOOSE_ACTIONS) {
-        return RESULT_ONGOING;
+        return result;
     }
+    TRACE_SCOPE(trace, TRACE_COMBAT_TURN, turnCounter, action);
+    ALLOC_FORBID_SCOPE(turnAlloc, "combat turn");
+    
+    int playerHPBefore = player->getCurrentHP();
+    int enemyHPBefore = currentEnemy->getCurrentHP();
+    int manaBefore = player->getCurrentMana();
     
     // Store actions
     playerAction = action;
@@ -65,41 +76,44 @@ CombatResult CombatManager::processTurn(PlayerAction action) {
     actionsChosen = true;
     currentState = COMBAT_EXECUTE_ACTIONS;
     
+    result.playerAction = playerAction;
+    result.enemyAction = enemyAction;
+    if (playerAction != ACTION_DEFEND) {
+        result.spell = player->getEquippedSpell(playerAction - ACTION_CAST_SPELL_1);
+    }
+    
     // Show choices
-    String playerActionName = getPlayerActionName(playerAction);
-    String enemyActionName = (enemyAction == ENEMY_ATTACK) ? "ATTACK" : "DEFEND";
+    const char* playerActionName = getPlayerActionName(playerAction);
+    const char* enemyActionName = (enemyAction == ENEMY_ATTACK) ? "ATTACK" : "DEFEND";
     
-    Serial.println("CHOICES:");
-    Serial.println("  " + player->getName() + " chooses: " + playerActionName);
-    Serial.println("  " + currentEnemy->getName() + " chooses: " + enemyActionName);
-    Serial.println();
+    LOG_INFO(COMBAT, "CHOICES:");
+    LOG_INFO(COMBAT, "  %s chooses: %s", player->getName().c_str(), playerActionName);
+    LOG_INFO(COMBAT, "  %s chooses: %s", currentEnemy->getName().c_str(), enemyActionName);
     
-    // Create turn queue to determine order (local variable)
-    TurnQueue* turnQueue = new TurnQueue(player, currentEnemy, playerAction, enemyAction);
+    // Determine order by current speeds, buffs and debuffs included (the
+    // player is scheduled first, so wins speed ties)
+    result.playerSpeed = player->getEffectiveSpeed();
+    result.enemySpeed = currentEnemy->getEffectiveSpeed();
+    turnQueue.clear();
+    turnQueue.schedule(COMBATANT_PLAYER, TurnQueue::getActionPriority(playerAction), result.playerSpeed);
+    turnQueue.schedule(COMBATANT_ENEMY, TurnQueue::getActionPriority(enemyAction), result.enemySpeed);
     
-    // Show execution order
-    Serial.println("EXECUTION ORDER: " + turnQueue->getTurnOrderReason());
-    Serial.println();
-    Serial.println("ACTIONS:");
+    TurnEntry first = turnQueue.next();
+    result.playerFirst = (first.combatant == COMBATANT_PLAYER);
+    result.orderReason = TurnQueue::getOrderReason(first, turnQueue.peek());
     
-    // Execute actions in order determined by TurnQueue
-    bool playerGoesFirst = turnQueue->doesPlayerGoFirst();
+    // Show execution order
+    LOG_INFO(COMBAT, "EXECUTION ORDER: %s",
+             TurnQueue::describeOrder(first, turnQueue.peek(), result.playerFirst ? "Player" : "Enemy").c_str());
+    LOG_INFO(COMBAT, "ACTIONS:");
     
-    if (playerGoesFirst) {
-        executePlayerAction();
-        if (!isCombatOver()) {
-            executeEnemyAction();
-        }
-    } else {
-        executeEnemyAction();
-        if (!isCombatOver()) {
-            executePlayerAction();
-        }
+    // Execute actions in order determined by TurnQueue, until one side falls
+    executeAction(first);
+    while (!isCombatOver() && !turnQueue.isEmpty()) {
+        executeAction(turnQueue.next());
     }
     
-    // Cleanup and prepare for next turn
-    delete turnQueue;
-    turnQueue = nullptr;
+    // Prepare for next turn
     actionsChosen = false;
     turnCounter++;
     
@@ -107,10 +121,26 @@ CombatResult CombatManager::processTurn(PlayerAction action) {
         currentState = COMBAT_CHOOSE_ACTIONS;
     }
     
-    return getCombatResult();
+    result.playerHPLost = playerHPBefore - player->getCurrentHP();
+    result.enemyHPLost = enemyHPBefore - currentEnemy->getCurrentHP();
+    result.playerManaChange = player->getCurrentMana() - manaBefore;
+    result.activeEffects = player->getActiveEffects().size();
+    result.enemyEffects = currentEnemy->getActiveEffects().size();
+    result.enemyDefending = currentEnemy->getIsDefending();
+    result.outcome = getCombatResult();
+    trace.setResult(result.outcome);
+    return result;
+}
+
+void CombatManager::executeAction(const TurnEntry& actor) {
+    if (actor.combatant == COMBATANT_PLAYER) {
+        executePlayerAction();
+    } else {
+        executeEnemyAction();
+    }
 }
 
-// Execute player action with spell support - UPDATED: Now passes text box to spell casting
+// Execute player action with spell support
 void CombatManager::executePlayerAction() {
     if (!player || !currentEnemy) return;
     
@@ -124,20 +154,17 @@ void CombatManager::executePlayerAction() {
         case ACTION_CAST_SPELL_4:
             {
                 int spellSlot = playerAction - ACTION_CAST_SPELL_1;
-                Serial.print("  " + player->getName() + " casts spell from slot " + String(spellSlot + 1) + ": ");
-                
-                // DEBUG: Check textBox before passing it
-                Serial.println("DEBUG CombatManager::executePlayerAction() - textBox: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
+                LOG_INFO(COMBAT, "  %s casts spell from slot %d", player->getName().c_str(), spellSlot + 1);
                 
-                // FIXED: Pass text box to spell casting for synergy display
-                if (player->performCastSpell(spellSlot, currentEnemy, textBox)) {
+                lastTurn.spellCast = player->performCastSpell(spellSlot, currentEnemy, &lastTurn.synergyBonus);
+                if (lastTurn.spellCast) {
                     // Spell casting is handled in the spell system with proper logging
                     if (!currentEnemy->isAlive()) {
                         currentState = COMBAT_PLAYER_WIN;
-                        Serial.println("  " + currentEnemy->getName() + " is defeated by magic!");
+                        LOG_INFO(COMBAT, "  %s is defeated by magic!", currentEnemy->getName().c_str());
                     }
                 } else {
-                    Serial.println("Spell failed to cast!");
+                    LOG_INFO(COMBAT, "Spell failed to cast!");
                 }
             }
             break;
@@ -145,7 +172,9 @@ void CombatManager::executePlayerAction() {
         case ACTION_DEFEND:
             {
                 int defenseBonus = player->performDefend();
-                Serial.println("  " + player->getName() + " casts a protective ward (+" + String(defenseBonus) + " magical defense)");
+                lastTurn.wardBonus = defenseBonus;
+                LOG_INFO(COMBAT, "  %s casts a protective ward (+%d magical defense)",
+                         player->getName().c_str(), defenseBonus);
             }
             break;
     }
@@ -158,33 +187,46 @@ void CombatManager::executePlayerAction() {
 void CombatManager::executeEnemyAction() {
     if (!player || !currentEnemy) return;
     
+    lastTurn.enemyActed = true;
+    currentEnemy->startTurn();
+    
     if (enemyAction == ENEMY_ATTACK) {
         int baseDamage = DamageCalculator::calculateEnemyAttackDamage(currentEnemy);
         int playerDefense = player->getTotalDefense();
         int finalDamage = DamageCalculator::calculateFinalDamage(baseDamage, playerDefense);
+        lastTurn.enemyDamage = baseDamage;
+        lastTurn.enemyBlocked = playerDefense;
         
-        Serial.print("  " + currentEnemy->getName() + " attacks for " + String(baseDamage) + " damage");
         if (playerDefense > 0) {
-            Serial.print(" (" + String(playerDefense) + " blocked)");
-            Serial.print(" = " + String(finalDamage) + " final damage");
+            LOG_INFO(COMBAT, "  %s attacks for %d damage (%d blocked) = %d final damage",
+                     currentEnemy->getName().c_str(), baseDamage, playerDefense, finalDamage);
+        } else {
+            LOG_INFO(COMBAT, "  %s attacks for %d damage", currentEnemy->getName().c_str(), baseDamage);
         }
-        Serial.println();
         
         player->takeDamage(baseDamage);
         
         if (!player->isAlive()) {
             currentState = COMBAT_PLAYER_LOSE;
-            Serial.println("  " + player->getName() + " is defeated!");
+            LOG_INFO(COMBAT, "  %s is defeated!", player->getName().c_str());
         }
     } else {
         int defenseBonus = DamageCalculator::calculateEnemyDefenseBonus(currentEnemy);
+        lastTurn.enemyDefenseBonus = defenseBonus;
         currentEnemy->performDefend(); // This adds the defense bonus
-        Serial.println("  " + currentEnemy->getName() + " defends for +" + String(defenseBonus) + " defense");
+        LOG_INFO(COMBAT, "  %s defends for +%d defense", currentEnemy->getName().c_str(), defenseBonus);
+    }
+    
+    // Burns tick and debuffs run down at the end of the enemy's turn
+    currentEnemy->endTurn();
+    if (!currentEnemy->isAlive() && currentState != COMBAT_PLAYER_LOSE) {
+        currentState = COMBAT_PLAYER_WIN;
+        LOG_INFO(COMBAT, "  %s succumbs to its wounds!", currentEnemy->getName().c_str());
     }
 }
 
 // Helper method to get player action name for logging
-String CombatManager::getPlayerActionName(PlayerAction action) {
+const char* CombatManager::getPlayerActionName(PlayerAction action) {
     switch(action) {
         case ACTION_CAST_SPELL_1: return "CAST SPELL 1";
         case ACTION_CAST_SPELL_2: return "CAST SPELL 2";
@@ -232,35 +274,20 @@ Enemy* CombatManager::getCurrentEnemy() const {
 void CombatManager::printCombatStatus() const {
     if (!player || !currentEnemy) return;
     
-    Serial.println("=== Combat Status ===");
-    Serial.print(player->getName() + ": ");
-    Serial.print(player->getCurrentHP());
-    Serial.print("/");
-    Serial.print(player->getMaxHP());
-    Serial.print(" HP, ");
-    Serial.print(player->getCurrentMana());
-    Serial.print("/");
-    Serial.print(player->getMaxMana());
-    Serial.println(" Mana");
-    
-    Serial.print(currentEnemy->getName() + ": ");
-    Serial.print(currentEnemy->getCurrentHP());
-    Serial.print("/");
-    Serial.print(currentEnemy->getMaxHP());
-    Serial.println(" HP");
-    
-    Serial.print("Turn: ");
-    Serial.println(turnCounter);
-    Serial.print("Current Turn: ");
-    Serial.println(currentState == COMBAT_CHOOSE_ACTIONS ? "Choose Actions" : "Execute Actions");
+    LOG_INFO(COMBAT, "=== Combat Status ===");
+    LOG_INFO(COMBAT, "%s: %d/%d HP, %d/%d Mana", player->getName().c_str(),
+             player->getCurrentHP(), player->getMaxHP(), player->getCurrentMana(), player->getMaxMana());
+    LOG_INFO(COMBAT, "%s: %d/%d HP", currentEnemy->getName().c_str(),
+             currentEnemy->getCurrentHP(), currentEnemy->getMaxHP());
+    LOG_INFO(COMBAT, "Turn: %d", turnCounter);
+    LOG_INFO(COMBAT, "Current Turn: %s", currentState == COMBAT_CHOOSE_ACTIONS ? "Choose Actions" : "Execute Actions");
     
     // Show active spell effects
-    auto activeEffects = player->getActiveEffects();
+    const auto& activeEffects = player->getActiveEffects();
     if (!activeEffects.empty()) {
-        Serial.println("Active spell effects: " + String(activeEffects.size()));
+        LOG_INFO(COMBAT, "Active spell effects: %d", (int)activeEffects.size());
     }
     
-    Serial.println();
 }
 
 // Destructor
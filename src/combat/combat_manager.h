@@ -3,12 +3,12 @@
 
 #include "../entities/player.h"
 #include "../entities/enemy.h"
+#include "turn_queue.h"
 #include <Arduino.h>
+#include "../debug/Log.h"
 
 // Forward declarations
 class DamageCalculator;
-class TurnQueue;
-class CombatTextBox;  // NEW: Forward declaration for text box
 
 enum CombatState {
     COMBAT_CHOOSE_ACTIONS,    // Both choose actions
@@ -23,6 +23,49 @@ enum CombatResult {
     RESULT_DEFEAT
 };
 
+// Everything one processTurn() resolved, for the combat screen and the
+// simulators to present or tally afterwards. Plain values filled in place,
+// so resolving a turn allocates nothing.
+struct TurnResult {
+    int turn;
+    PlayerAction playerAction;
+    EnemyAction enemyAction;
+    
+    // Order
+    bool playerFirst;
+    TurnOrderReason orderReason;
+    int playerSpeed;
+    int enemySpeed;
+    
+    // Player's action
+    const Spell* spell;         // In the chosen slot; nullptr for an empty slot or defend
+    bool spellCast;             // false: empty slot or not enough mana
+    int synergyBonus;
+    int wardBonus;              // Defend: magical defense gained
+    
+    // Enemy's action (not taken if it fell first)
+    bool enemyActed;
+    int enemyDamage;            // Attack before the player's defense
+    int enemyBlocked;           // Player defense against it
+    int enemyDefenseBonus;
+    bool enemyDefending;        // Still defending at the end; a hit drops the stance
+    
+    // Net change over the whole turn (actions, regen, effect ticks)
+    int playerHPLost;           // Negative when healed
+    int enemyHPLost;
+    int playerManaChange;
+    int activeEffects;          // Player's, at the end of the turn
+    int enemyEffects;           // Enemy's burns and debuffs, at the end of the turn
+    
+    CombatResult outcome;
+    
+    void clear() { memset(this, 0, sizeof(*this)); }
+};
+
+// TurnQueue IDs
+#define COMBATANT_PLAYER 0
+#define COMBATANT_ENEMY  1
+
 class CombatManager {
 private:
     Player* player;
@@ -35,11 +78,12 @@ private:
     EnemyAction enemyAction;
     bool actionsChosen;
     
-    // NEW: Text box reference for synergy display
-    CombatTextBox* textBox;
+    // The turn being resolved, then the last one
+    TurnResult lastTurn;
+    TurnQueue turnQueue;        // Refilled each turn, never reallocated
     
     // Helper methods
-    String getPlayerActionName(PlayerAction action);
+    const char* getPlayerActionName(PlayerAction action);
     
 public:
     // Constructor
@@ -49,17 +93,13 @@ public:
     void startCombat(Player* p, Enemy* e);
     void endCombat();
     
-    // NEW: Set text box for synergy display
-    void setTextBox(CombatTextBox* tb) { 
-    Serial.println("DEBUG CombatManager::setTextBox() - tb: " + String(tb != nullptr ? "NOT NULL" : "NULL"));
-    textBox = tb; 
-    Serial.println("DEBUG CombatManager::setTextBox() - textBox member now: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
-}
-    
-    // Turn processing
-    CombatResult processTurn(PlayerAction action);
+    // Turn processing: resolves both actions and returns the record. No
+    // output of its own beyond logging; the caller presents the result.
+    const TurnResult& processTurn(PlayerAction action);
+    const TurnResult& getLastTurn() const { return lastTurn; }
     
     // Action execution
+    void executeAction(const TurnEntry& actor);
     void executePlayerAction();
     void executeEnemyAction();
     
@@ -11,7 +11,7 @@ int DamageCalculator::calculatePlayerAttackDamage(Player* player) {
 int DamageCalculator::calculateEnemyAttackDamage(Enemy* enemy) {
     if (!enemy) return 0;
     
-    int baseDamage = enemy->getAttack();
+    int baseDamage = enemy->getEffectiveAttack();
     return applyAIAttackModifier(baseDamage, enemy->getAIType());
 }
 
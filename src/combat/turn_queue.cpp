@@ -1,37 +1,77 @@
 #include "turn_queue.h"
 
-// Static helper functions for TurnAction
-ActionPriority TurnAction::getPlayerActionPriority(PlayerAction action) {
-    return TurnQueue::getActionPriority(action);
+void TurnQueue::clear() {
+    count = 0;
+    scheduled = 0;
 }
 
-ActionPriority TurnAction::getEnemyActionPriority(EnemyAction action) {
-    return TurnQueue::getActionPriority(action);
+bool TurnQueue::schedule(int combatant, ActionPriority priority, int speed) {
+    if (count == MAX_COMBATANTS) return false;
+
+    TurnEntry entry;
+    entry.combatant = (uint8_t)combatant;
+    entry.priority = (uint8_t)priority;
+    entry.order = scheduled++;
+    entry.speed = (int16_t)speed;
+    entry.key = makeKey(priority, speed, entry.order);
+    insert(entry);
+    return true;
+}
+
+bool TurnQueue::remove(int combatant) {
+    int index = find(combatant);
+    if (index < 0) return false;
+
+    count--;
+    for (int i = index; i < count; i++) {
+        entries[i] = entries[i + 1];
+    }
+    return true;
 }
 
-// Constructor
-TurnQueue::TurnQueue(Player* player, Enemy* enemy, PlayerAction pAction, EnemyAction eAction)
-    : playerTurn(true, pAction, player->getSpeed()),
-      enemyTurn(false, eAction, enemy->getSpeed()) {
-    calculateTurnOrder();
+bool TurnQueue::setSpeed(int combatant, int speed) {
+    int index = find(combatant);
+    if (index < 0) return false;
+
+    TurnEntry entry = entries[index];
+    entry.speed = (int16_t)speed;
+    entry.key = makeKey(entry.priority, speed, entry.order);
+    remove(combatant);
+    insert(entry);
+    return true;
 }
 
-// Calculate who goes first based on priority and speed
-void TurnQueue::calculateTurnOrder() {
-    // Compare priorities first (lower number = higher priority)
-    if (playerTurn.priority < enemyTurn.priority) {
-        playerGoesFirst = true;
-    } else if (enemyTurn.priority < playerTurn.priority) {
-        playerGoesFirst = false;
-    } else {
-        // Same priority - use speed (higher speed wins, player wins ties)
-        playerGoesFirst = (playerTurn.speed >= enemyTurn.speed);
+// Shifts the entries that act sooner up one
+void TurnQueue::insert(const TurnEntry& entry) {
+    int index = count++;
+    while (index > 0 && entries[index - 1].key < entry.key) {
+        entries[index] = entries[index - 1];
+        index--;
     }
+    entries[index] = entry;
 }
 
-// Check if player goes first
-bool TurnQueue::doesPlayerGoFirst() const {
-    return playerGoesFirst;
+int TurnQueue::find(int combatant) const {
+    for (int i = 0; i < count; i++) {
+        if (entries[i].combatant == combatant) return i;
+    }
+    return -1;
+}
+
+TurnOrderReason TurnQueue::getOrderReason(const TurnEntry& first, const TurnEntry& second) {
+    if (first.priority != second.priority) return ORDER_PRIORITY;
+    return first.speed == second.speed ? ORDER_SPEED_TIE : ORDER_SPEED;
+}
+
+TurnOrderText TurnQueue::describeOrder(const TurnEntry& first, const TurnEntry& second, const char* firstName) {
+    switch (getOrderReason(first, second)) {
+        case ORDER_PRIORITY:
+            return TurnOrderText::format("%s goes first (priority)", firstName);
+        case ORDER_SPEED:
+            return TurnOrderText::format("%s goes first (speed: %d vs %d)", firstName, first.speed, second.speed);
+        default:
+            return TurnOrderText::format("%s goes first (speed tie)", firstName);
+    }
 }
 
 // Get priority for player actions - UPDATED for spell actions
@@ -60,31 +100,3 @@ ActionPriority TurnQueue::getActionPriority(EnemyAction action) {
             return PRIORITY_ATTACK;
     }
 }
-
-// Get explanation for turn order (for display)
-String TurnQueue::getTurnOrderReason() const {
-    if (playerTurn.priority < enemyTurn.priority) {
-        return "Player goes first (priority)";
-    } else if (enemyTurn.priority < playerTurn.priority) {
-        return "Enemy goes first (priority)";
-    } else {
-        // Same priority
-        if (playerTurn.speed > enemyTurn.speed) {
-            return "Player goes first (speed: " + String(playerTurn.speed) + " vs " + String(enemyTurn.speed) + ")";
-        } else if (enemyTurn.speed > playerTurn.speed) {
-            return "Enemy goes first (speed: " + String(enemyTurn.speed) + " vs " + String(playerTurn.speed) + ")";
-        } else {
-            return "Player goes first (speed tie)";
-        }
-    }
-}
-
-// Get the first action to execute
-TurnAction TurnQueue::getFirstAction() const {
-    return playerGoesFirst ? playerTurn : enemyTurn;
-}
-
-// Get the second action to execute
-TurnAction TurnQueue::getSecondAction() const {
-    return playerGoesFirst ? enemyTurn : playerTurn;
-}
\ No newline at end of file
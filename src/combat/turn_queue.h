@@ -3,6 +3,11 @@
 
 #include "../entities/player.h"
 #include "../entities/enemy.h"
+#include "../utils/FixedString.h"
+
+typedef FixedString<48> TurnOrderText;
+
+#define MAX_COMBATANTS 9    // The player plus up to 8 enemies and summons
 
 enum ActionPriority {
     PRIORITY_DEFEND = 0,      // Defend always goes first
@@ -10,48 +15,66 @@ enum ActionPriority {
     PRIORITY_ATTACK = 2       // Attacks go last (speed-based)
 };
 
-struct TurnAction {
-    bool isPlayer;            // true = player action, false = enemy action
-    PlayerAction playerAction;
-    EnemyAction enemyAction;
-    ActionPriority priority;
-    int speed;
-    
-    TurnAction(bool player, PlayerAction pAction, int spd) 
-        : isPlayer(player), playerAction(pAction), priority(getPlayerActionPriority(pAction)), speed(spd) {}
-    
-    TurnAction(bool player, EnemyAction eAction, int spd) 
-        : isPlayer(player), enemyAction(eAction), priority(getEnemyActionPriority(eAction)), speed(spd) {}
-        
-private:
-    static ActionPriority getPlayerActionPriority(PlayerAction action);
-    static ActionPriority getEnemyActionPriority(EnemyAction action);
+// What settled the turn order
+enum TurnOrderReason {
+    ORDER_PRIORITY,     // One side defends, the other attacks
+    ORDER_SPEED,        // Same priority, the faster side goes first
+    ORDER_SPEED_TIE     // Same priority and speed: the player goes first
 };
 
+// One combatant's action for the round
+struct TurnEntry {
+    uint32_t key;             // Sort key: lower acts first, see makeKey()
+    uint8_t combatant;        // Caller's ID (CombatManager: 0 = player, 1+ = enemies)
+    uint8_t priority;         // ActionPriority
+    uint8_t order;            // When it was scheduled; the last tie-break
+    int16_t speed;
+};
+
+// A round's actions for any number of combatants, taken in order of
+// ActionPriority, then speed (faster first), then whoever was scheduled
+// first - the player, by convention, so the player wins speed ties.
+// The three are packed into one integer key, and the entries are kept
+// sorted by it in a fixed array with the next actor at the end: taking it
+// is O(1), scheduling an insertion over at most MAX_COMBATANTS entries, and
+// nothing is allocated. Combatants can join mid-round (summons), drop out
+// (defeated) or change speed (debuffs) before they act.
 class TurnQueue {
 private:
-    TurnAction playerTurn;
-    TurnAction enemyTurn;
-    bool playerGoesFirst;
-    
+    TurnEntry entries[MAX_COMBATANTS];     // Sorted, highest key first
+    uint8_t count;
+    uint8_t scheduled;        // Entries scheduled since clear()
+
+    void insert(const TurnEntry& entry);
+    int find(int combatant) const;
+
 public:
-    // Constructor
-    TurnQueue(Player* player, Enemy* enemy, PlayerAction pAction, EnemyAction eAction);
-    
-    // Turn order calculation
-    void calculateTurnOrder();
-    bool doesPlayerGoFirst() const;
-    
+    TurnQueue() { clear(); }
+
+    // Round management
+    void clear();
+    bool schedule(int combatant, ActionPriority priority, int speed);  // false when full
+    TurnEntry next() { return entries[--count]; }                    // Only when not empty
+    const TurnEntry& peek() const { return entries[count - 1]; }     // Only when not empty
+    bool isEmpty() const { return count == 0; }
+    int size() const { return count; }
+
+    // Mid-round changes; false if the combatant has already acted
+    bool remove(int combatant);
+    bool setSpeed(int combatant, int speed);
+
+    // Ordering
+    static uint32_t makeKey(int priority, int speed, int order) {
+        return ((uint32_t)priority << 24) | ((uint32_t)(0x7FFF - speed) & 0xFFFF) << 8 | (uint32_t)order;
+    }
+    static bool goesBefore(const TurnEntry& a, const TurnEntry& b) { return a.key < b.key; }
+    static TurnOrderReason getOrderReason(const TurnEntry& first, const TurnEntry& second);
+    // Turn order explanation (for display)
+    static TurnOrderText describeOrder(const TurnEntry& first, const TurnEntry& second, const char* firstName);
+
     // Priority helpers
     static ActionPriority getActionPriority(PlayerAction action);
     static ActionPriority getActionPriority(EnemyAction action);
-    
-    // Turn order explanation (for display)
-    String getTurnOrderReason() const;
-    
-    // Getters
-    TurnAction getFirstAction() const;
-    TurnAction getSecondAction() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,273 @@
+#include "AllocTracker.h"
+
+#if ALLOC_TRACKING
+
+#include "Log.h"
+#include <esp_heap_caps.h>
+#include <esp_rom_sys.h>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+// Indexed by StateTransition
+static const char* const stateNames[ALLOC_STATE_SLOTS] = {
+    "none", "mainmenu", "doors", "combat", "library", "shop",
+    "treasure", "gameover", "settings", "credits", "quit"
+};
+
+// The hooks run on whatever task allocates, so shared counters are bumped
+// with relaxed atomics; the report only needs them roughly consistent
+static AllocCounters totals;
+static AllocCounters stateCounters[ALLOC_STATE_SLOTS];
+static int32_t live = 0;
+static int32_t windowPeak = 0;     // High-water mark of the innermost scope
+
+static AllocScopeStats* forbidding = nullptr;   // Outermost forbidding scope
+
+AllocScopeStats* AllocTracker::scopes = nullptr;
+int AllocTracker::currentState = 0;
+bool AllocTracker::assertMode = ALLOC_ASSERT;
+
+static inline void bump(uint32_t& counter, uint32_t amount) {
+    __atomic_fetch_add(&counter, amount, __ATOMIC_RELAXED);
+}
+
+static inline void raiseTo(int32_t& peak, int32_t value) {
+    int32_t seen = __atomic_load_n(&peak, __ATOMIC_RELAXED);
+    while (value > seen &&
+           !__atomic_compare_exchange_n(&peak, &seen, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+//============================================================================
+// HOOKS
+//============================================================================
+
+void AllocTracker::noteAlloc(uint32_t requested, uint32_t size) {
+    AllocCounters& state = stateCounters[currentState];
+    bump(totals.allocs, 1);
+    bump(totals.bytes, requested);
+    bump(state.allocs, 1);
+    bump(state.bytes, requested);
+
+    int32_t now = __atomic_add_fetch(&live, (int32_t)size, __ATOMIC_RELAXED);
+    raiseTo(totals.peakLive, now);
+    raiseTo(state.peakLive, now);
+    raiseTo(windowPeak, now);
+
+    if (forbidding) {
+        bump(forbidding->violations, 1);
+        if (assertMode) {
+            // No logging from inside malloc: straight to the console, then stop
+            esp_rom_printf("ALLOC ASSERT: %lu bytes allocated in \"%s\"\n", (unsigned long)requested,
+                           forbidding->name);
+            abort();
+        }
+    }
+}
+
+void AllocTracker::noteFree(uint32_t size) {
+    bump(totals.frees, 1);
+    bump(stateCounters[currentState].frees, 1);
+    __atomic_sub_fetch(&live, (int32_t)size, __ATOMIC_RELAXED);
+}
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(size_t size) {
+    void* ptr = __real_malloc(size);
+    if (ptr) AllocTracker::noteAlloc(size, heap_caps_get_allocated_size(ptr));
+    return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    void* ptr = __real_calloc(count, size);
+    if (ptr) AllocTracker::noteAlloc(count * size, heap_caps_get_allocated_size(ptr));
+    return ptr;
+}
+
+// A realloc counts as freeing the old block and allocating the new one
+void* __wrap_realloc(void* ptr, size_t size) {
+    uint32_t oldSize = ptr ? heap_caps_get_allocated_size(ptr) : 0;
+    void* result = __real_realloc(ptr, size);
+    if (result) {
+        if (ptr) AllocTracker::noteFree(oldSize);
+        AllocTracker::noteAlloc(size, heap_caps_get_allocated_size(result));
+    } else if (ptr && size == 0) {
+        AllocTracker::noteFree(oldSize);
+    }
+    return result;
+}
+
+void __wrap_free(void* ptr) {
+    if (!ptr) return;
+    AllocTracker::noteFree(heap_caps_get_allocated_size(ptr));
+    __real_free(ptr);
+}
+}
+
+// Route C++ allocation through the wrapped malloc too; the toolchain's own
+// operator new may live in a library the wrap doesn't reach (libstdc++.so)
+static void* allocOrFail(size_t size) {
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) {
+#if __cpp_exceptions
+        throw std::bad_alloc();
+#else
+        abort();
+#endif
+    }
+    return ptr;
+}
+
+void* operator new(size_t size) { return allocOrFail(size); }
+void* operator new[](size_t size) { return allocOrFail(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return malloc(size ? size : 1); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return malloc(size ? size : 1); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+
+//============================================================================
+// SCOPES
+//============================================================================
+
+AllocScopeStats::AllocScopeStats(const char* scopeName, bool forbidAlloc) {
+    name = scopeName;
+    forbid = forbidAlloc;
+    entries = 0;
+    memset(&total, 0, sizeof(total));
+    maxAllocs = 0;
+    maxBytes = 0;
+    violations = 0;
+    next = nullptr;
+    AllocTracker::registerScope(this);
+}
+
+void AllocTracker::registerScope(AllocScopeStats* stats) {
+    stats->next = scopes;
+    scopes = stats;
+}
+
+AllocScope::AllocScope(AllocScopeStats& scopeStats) : stats(scopeStats) {
+    startAllocs = totals.allocs;
+    startFrees = totals.frees;
+    startBytes = totals.bytes;
+    outerPeak = windowPeak;
+    windowPeak = live;
+    if (stats.forbid && !forbidding) forbidding = &stats;
+}
+
+AllocScope::~AllocScope() {
+    uint32_t allocs = totals.allocs - startAllocs;
+    uint32_t bytes = totals.bytes - startBytes;
+
+    stats.entries++;
+    stats.total.allocs += allocs;
+    stats.total.frees += totals.frees - startFrees;
+    stats.total.bytes += bytes;
+    stats.maxAllocs = max(stats.maxAllocs, allocs);
+    stats.maxBytes = max(stats.maxBytes, bytes);
+    stats.total.peakLive = max(stats.total.peakLive, windowPeak);
+
+    windowPeak = max(outerPeak, windowPeak);
+    if (forbidding == &stats) forbidding = nullptr;
+
+    // Reported once the scope is closed, so the log line's own work can't
+    // count against it; only the first offending entry, to keep the log usable
+    if (stats.forbid && allocs > 0 && stats.violations == allocs) {
+        LOG_ERROR(HEAP, "\"%s\" allocated %lu times (%lu bytes); it must not allocate", stats.name,
+                  (unsigned long)allocs, (unsigned long)bytes);
+    }
+}
+
+//============================================================================
+// REPORT
+//============================================================================
+
+int32_t AllocTracker::getLive() {
+    return __atomic_load_n(&live, __ATOMIC_RELAXED);
+}
+
+int32_t AllocTracker::getPeak() {
+    return __atomic_load_n(&totals.peakLive, __ATOMIC_RELAXED);
+}
+
+const AllocCounters& AllocTracker::getStateCounters(int state) {
+    return stateCounters[(state >= 0 && state < ALLOC_STATE_SLOTS) ? state : 0];
+}
+
+const AllocScopeStats* AllocTracker::findScope(const char* name) {
+    for (AllocScopeStats* s = scopes; s; s = s->next) {
+        if (strcmp(s->name, name) == 0) return s;
+    }
+    return nullptr;
+}
+
+bool AllocTracker::handleCommand(char command) {
+    switch (command) {
+        case 'h': printReport(); return true;
+        case 'j': reset(); return true;
+        default: return false;
+    }
+}
+
+// Peaks restart from the current live total; the live total itself is kept
+void AllocTracker::reset() {
+    int32_t now = getLive();
+    memset(&totals, 0, sizeof(totals));
+    memset(stateCounters, 0, sizeof(stateCounters));
+    totals.peakLive = now;
+    windowPeak = now;
+    for (AllocScopeStats* s = scopes; s; s = s->next) {
+        s->entries = 0;
+        memset(&s->total, 0, sizeof(s->total));
+        s->maxAllocs = 0;
+        s->maxBytes = 0;
+        s->violations = 0;
+    }
+}
+
+void AllocTracker::printReport() {
+    // Snapshot first: printing allocates on some cores
+    AllocCounters all = totals;
+    int32_t liveNow = getLive();
+
+    Serial.println("=== HEAP REPORT (bytes) ===");
+    Serial.printf("live %ld, peak %ld, %lu allocs, %lu frees\n", (long)liveNow, (long)all.peakLive,
+                  (unsigned long)all.allocs, (unsigned long)all.frees);
+
+    // Fragmentation: how much of the free internal RAM one allocation can
+    // actually get. Only the device knows its heap size.
+    size_t freeBytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    if (freeBytes > 0) {
+        size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+        Serial.printf("internal free %lu, largest block %lu (%d%% fragmented)\n", (unsigned long)freeBytes,
+                      (unsigned long)largest, 100 - (int)((uint64_t)largest * 100 / freeBytes));
+    }
+    Serial.printf("%-9s %8s %8s %9s %8s\n", "state", "allocs", "frees", "bytes", "peak");
+    for (int s = 0; s < ALLOC_STATE_SLOTS; s++) {
+        const AllocCounters& c = stateCounters[s];
+        if (c.allocs == 0 && c.frees == 0) continue;
+        Serial.printf("%-9s %8lu %8lu %9lu %8ld\n", stateNames[s], (unsigned long)c.allocs,
+                      (unsigned long)c.frees, (unsigned long)c.bytes, (long)c.peakLive);
+    }
+
+    Serial.printf("%-12s %6s %8s %9s %6s %7s %8s %5s\n", "scope", "n", "allocs", "bytes", "max/n", "maxB/n",
+                  "peak", "viol");
+    for (AllocScopeStats* s = scopes; s; s = s->next) {
+        Serial.printf("%-12s %6lu %8lu %9lu %6lu %7lu %8ld %5lu\n", s->name, (unsigned long)s->entries,
+                      (unsigned long)s->total.allocs, (unsigned long)s->total.bytes,
+                      (unsigned long)s->maxAllocs, (unsigned long)s->maxBytes, (long)s->total.peakLive,
+                      (unsigned long)s->violations);
+    }
+}
+
+#endif
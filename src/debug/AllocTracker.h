@@ -0,0 +1,123 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <Arduino.h>
+
+// Heap accounting. The malloc family is wrapped at link time
+// (-Wl,--wrap=malloc etc., see [alloc_tracking] in platformio.ini) and the
+// global operator new/delete go through it, so String buffers, containers
+// and plain new/delete all get counted - on the device and on the host.
+// Every allocation is filed under:
+//   - the active GameState (GameStateManager sets it; "none" before the
+//     first state). Other tasks allocating meanwhile land there too.
+//   - every open AllocScope, e.g. "combat turn" around processTurn()
+// with count, bytes requested and the live-heap high-water mark.
+//
+// A scope can also forbid allocation (ALLOC_FORBID_SCOPE). Each offending
+// allocation counts as a violation, and the first entry that had any is
+// logged when it closes. In assert mode (-D ALLOC_ASSERT=1, or
+// setAssertMode(true) from a host tool) the first violation prints the scope
+// and size and aborts instead, which fails whatever run hit it.
+//
+// Debug console commands (see DebugConsole):
+//   h - print the heap report    j - reset the counters
+//
+// Builds without the wrap flags must leave ALLOC_TRACKING at 0.
+
+#ifndef ALLOC_TRACKING
+#define ALLOC_TRACKING 0
+#endif
+
+#ifndef ALLOC_ASSERT
+#define ALLOC_ASSERT 0
+#endif
+
+// One slot per StateTransition value
+#define ALLOC_STATE_SLOTS 11
+
+// Counters for one state or one scope
+struct AllocCounters {
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t bytes;
+    int32_t peakLive;   // Highest live-heap total seen while it was active
+};
+
+// A named, marked region of code; one static record per ALLOC_SCOPE site
+struct AllocScopeStats {
+    const char* name;
+    bool forbid;
+    uint32_t entries;
+    AllocCounters total;
+    uint32_t maxAllocs;     // Worst single entry
+    uint32_t maxBytes;
+    uint32_t violations;
+    AllocScopeStats* next;
+
+    AllocScopeStats(const char* scopeName, bool forbidAlloc);
+};
+
+class AllocTracker {
+private:
+    static AllocScopeStats* scopes;
+    static int currentState;
+    static bool assertMode;
+
+public:
+    // Allocation hooks (the malloc wrappers); size is the usable block size
+    static void noteAlloc(uint32_t requested, uint32_t size);
+    static void noteFree(uint32_t size);
+
+    // Attribution
+    static void setState(int state) {
+        currentState = (state >= 0 && state < ALLOC_STATE_SLOTS) ? state : 0;
+    }
+    static void registerScope(AllocScopeStats* stats);
+
+    // Current live-heap total and its high-water mark since boot/reset
+    static int32_t getLive();
+    static int32_t getPeak();
+    static const AllocCounters& getStateCounters(int state);
+    static const AllocScopeStats* findScope(const char* name);
+
+    static void setAssertMode(bool enabled) { assertMode = enabled; }
+    static bool isAssertMode() { return assertMode; }
+
+    // Debug console command; false if it isn't one of ours
+    static bool handleCommand(char command);
+    static void printReport();
+    static void reset();
+};
+
+// Counts everything allocated between construction and destruction
+class AllocScope {
+private:
+    AllocScopeStats& stats;
+    uint32_t startAllocs;
+    uint32_t startFrees;
+    uint32_t startBytes;
+    int32_t outerPeak;
+
+public:
+    AllocScope(AllocScopeStats& scopeStats);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+};
+
+#if ALLOC_TRACKING
+#define ALLOC_SCOPE(var, name) \
+    static AllocScopeStats var##Stats(name, false); \
+    AllocScope var(var##Stats)
+#define ALLOC_FORBID_SCOPE(var, name) \
+    static AllocScopeStats var##Stats(name, true); \
+    AllocScope var(var##Stats)
+#define ALLOC_SET_STATE(state) AllocTracker::setState(state)
+#else
+#define ALLOC_SCOPE(var, name) do {} while (0)
+#define ALLOC_FORBID_SCOPE(var, name) do {} while (0)
+#define ALLOC_SET_STATE(state) do {} while (0)
+#endif
+
+#endif
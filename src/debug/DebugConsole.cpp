@@ -0,0 +1,30 @@
+#include "DebugConsole.h"
+#include "FrameProfiler.h"
+#include "Trace.h"
+#include "AllocTracker.h"
+#include "../input/InputRecording.h"
+#include <Arduino.h>
+
+void DebugConsole::poll() {
+    while (Serial.available() > 0) {
+        char command = (char)Serial.read();
+
+#if FRAME_PROFILER
+        if (FrameProfiler::handleCommand(command)) continue;
+#endif
+#if ALLOC_TRACKING
+        if (AllocTracker::handleCommand(command)) continue;
+#endif
+
+        switch (command) {
+            case 'd': Trace::dump(); break;
+            case 'c': Trace::clear(); break;
+            case 'w': InputRecording::startRecording(); break;
+            case 'x': InputRecording::stop(); break;
+            case 'y': InputRecording::startReplay(true); break;
+            case 'f': InputRecording::startReplay(false); break;
+            case 'e': InputRecording::dump(); break;
+            default: break;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef DEBUG_CONSOLE_H
+#define DEBUG_CONSOLE_H
+
+// One-character commands over Serial, read once per loop():
+//   p - profiler report     r - reset profiler      o - toggle overlay
+//   d - dump the trace      c - clear the trace
+//   w - record input        x - stop recording/replay
+//   y - replay (real time)  f - replay (full speed)
+//   e - dump the input recording
+//   h - heap report         j - reset heap counters
+class DebugConsole {
+public:
+    static void poll();
+};
+
+#endif
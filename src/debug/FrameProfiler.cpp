@@ -0,0 +1,193 @@
+#include "FrameProfiler.h"
+
+#if FRAME_PROFILER
+
+#include "../graphics/Display.h"
+
+// Indexed by StateTransition
+static const char* const stateNames[PROFILE_STATE_SLOTS] = {
+    "none", "mainmenu", "doors", "combat", "library", "shop",
+    "treasure", "gameover", "settings", "credits", "quit"
+};
+
+static const char* const metricNames[PROFILE_METRIC_COUNT] = {
+    "update", "draw", "flush", "bytes"
+};
+
+//============================================================================
+// HISTOGRAM
+//============================================================================
+
+ProfileHistogram::ProfileHistogram() {
+    reset();
+}
+
+void ProfileHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    sum = 0;
+    minValue = UINT32_MAX;
+    maxValue = 0;
+}
+
+int ProfileHistogram::bucketFor(uint32_t value) {
+    if (value < 4) return value;
+    int msb = 31 - __builtin_clz(value);
+    int bucket = (msb - 1) * 4 + ((value >> (msb - 2)) & 3);
+    return min(bucket, PROFILE_BUCKETS - 1);
+}
+
+uint32_t ProfileHistogram::bucketFloor(int bucket) {
+    if (bucket < 4) return bucket;
+    int msb = bucket / 4 + 1;
+    return (uint32_t)(4 + bucket % 4) << (msb - 2);
+}
+
+void ProfileHistogram::decay() {
+    // Halve everything so older frames fade out; min/max restart
+    uint32_t kept = 0;
+    for (int i = 0; i < PROFILE_BUCKETS; i++) {
+        buckets[i] /= 2;
+        kept += buckets[i];
+    }
+    sum = count ? sum * kept / count : 0;
+    count = kept;
+    minValue = UINT32_MAX;
+    maxValue = 0;
+}
+
+void ProfileHistogram::add(uint32_t value) {
+    if (count >= PROFILE_WINDOW) {
+        decay();
+    }
+    buckets[bucketFor(value)]++;
+    count++;
+    sum += value;
+    minValue = min(minValue, value);
+    maxValue = max(maxValue, value);
+}
+
+uint32_t ProfileHistogram::getPercentile(int percent) const {
+    if (count == 0) return 0;
+
+    uint32_t target = (count * percent + 99) / 100;
+    uint32_t seen = 0;
+    for (int i = 0; i < PROFILE_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            if (i == PROFILE_BUCKETS - 1) return maxValue;
+            uint32_t upper = bucketFloor(i + 1) - 1;
+            return maxValue ? min(upper, maxValue) : upper;
+        }
+    }
+    return maxValue;
+}
+
+//============================================================================
+// PROFILER
+//============================================================================
+
+ProfileHistogram FrameProfiler::histograms[PROFILE_STATE_SLOTS][PROFILE_METRIC_COUNT];
+uint32_t FrameProfiler::frameStart = 0;
+uint32_t FrameProfiler::updateEnd = 0;
+uint32_t FrameProfiler::drawCycles = 0;
+uint32_t FrameProfiler::updateDrawCycles = 0;
+uint32_t FrameProfiler::drawStart = 0;
+int FrameProfiler::drawDepth = 0;
+uint32_t FrameProfiler::cyclesPerMicro = 1;
+bool FrameProfiler::overlayEnabled = false;
+bool FrameProfiler::overlayDrawn = false;
+uint32_t FrameProfiler::lastMicros[PROFILE_METRIC_COUNT] = {0};
+uint16_t FrameProfiler::loopFpsTenths = 0;
+uint8_t FrameProfiler::loopIdlePercent = 0;
+
+void FrameProfiler::beginFrame() {
+    cyclesPerMicro = max((uint32_t)1, (uint32_t)getCpuFrequencyMhz());
+    drawCycles = 0;
+    updateDrawCycles = 0;
+    frameStart = now();
+}
+
+void FrameProfiler::endUpdate() {
+    updateEnd = now();
+    updateDrawCycles = drawCycles;
+}
+
+void FrameProfiler::endFrame(int state, uint32_t bytesPushed) {
+    uint32_t frameEnd = now();
+    if (state < 0 || state >= PROFILE_STATE_SLOTS) return;
+
+    // Drawing happens inside update(); report the two separately. Anything
+    // drawn after endUpdate() (the overlay) still counts as draw time.
+    uint32_t updateCycles = updateEnd - frameStart;
+    uint32_t drawnAfterUpdate = drawCycles - updateDrawCycles;
+
+    lastMicros[PROFILE_UPDATE] = toMicros(updateCycles - min(updateDrawCycles, updateCycles));
+    lastMicros[PROFILE_DRAW] = toMicros(drawCycles);
+    lastMicros[PROFILE_FLUSH] = toMicros(frameEnd - updateEnd - drawnAfterUpdate);
+    lastMicros[PROFILE_BYTES] = bytesPushed;
+
+    for (int i = 0; i < PROFILE_METRIC_COUNT; i++) {
+        histograms[state][i].add(lastMicros[i]);
+    }
+}
+
+bool FrameProfiler::handleCommand(char command) {
+    switch (command) {
+        case 'p': printReport(); return true;
+        case 'r': reset(); return true;
+        case 'o': overlayEnabled = !overlayEnabled; return true;
+        default: return false;
+    }
+}
+
+void FrameProfiler::reset() {
+    for (int s = 0; s < PROFILE_STATE_SLOTS; s++) {
+        for (int m = 0; m < PROFILE_METRIC_COUNT; m++) {
+            histograms[s][m].reset();
+        }
+    }
+}
+
+void FrameProfiler::printReport() {
+    Serial.println("=== FRAME PROFILE (us, bytes) ===");
+    Serial.printf("loop: %u.%u fps, %u%% idle\n", loopFpsTenths / 10, loopFpsTenths % 10, loopIdlePercent);
+    Serial.printf("%-9s %-6s %5s %7s %7s %7s %7s\n", "state", "metric", "n", "min", "avg", "p99", "max");
+    for (int s = 0; s < PROFILE_STATE_SLOTS; s++) {
+        if (histograms[s][PROFILE_UPDATE].getCount() == 0) continue;
+        for (int m = 0; m < PROFILE_METRIC_COUNT; m++) {
+            const ProfileHistogram& h = histograms[s][m];
+            Serial.printf("%-9s %-6s %5lu %7lu %7lu %7lu %7lu\n",
+                          m == 0 ? stateNames[s] : "", metricNames[m],
+                          (unsigned long)h.getCount(), (unsigned long)h.getMin(),
+                          (unsigned long)h.getAverage(), (unsigned long)h.getPercentile(99),
+                          (unsigned long)h.getMax());
+        }
+    }
+}
+
+void FrameProfiler::drawOverlay(Display* display) {
+    if (!overlayEnabled) {
+        // Leave a clean strip behind when switched off
+        if (overlayDrawn) {
+            display->fillRect(0, 0, Display::WIDTH, GLYPH_CELL_HEIGHT, TFT_BLACK);
+            overlayDrawn = false;
+        }
+        return;
+    }
+
+    // "U1.2 D0.4 F0.8 12K 98f 80%" - times in ms from the previous frame,
+    // then loop rate and idle share
+    char line[64];
+    snprintf(line, sizeof(line), "U%lu.%lu D%lu.%lu F%lu.%lu %luK %uf %u%%",
+             (unsigned long)(lastMicros[PROFILE_UPDATE] / 1000), (unsigned long)(lastMicros[PROFILE_UPDATE] / 100 % 10),
+             (unsigned long)(lastMicros[PROFILE_DRAW] / 1000), (unsigned long)(lastMicros[PROFILE_DRAW] / 100 % 10),
+             (unsigned long)(lastMicros[PROFILE_FLUSH] / 1000), (unsigned long)(lastMicros[PROFILE_FLUSH] / 100 % 10),
+             (unsigned long)(lastMicros[PROFILE_BYTES] / 1024),
+             (unsigned)(loopFpsTenths / 10), (unsigned)loopIdlePercent);
+    display->fillRect(0, 0, Display::WIDTH, GLYPH_CELL_HEIGHT, TFT_BLACK);
+    display->drawTextRun(line, 0, 0, TFT_GREEN, TFT_BLACK, 1);
+    overlayDrawn = true;
+}
+
+#endif
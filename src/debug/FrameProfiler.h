@@ -0,0 +1,138 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+
+// Frame-timing instrumentation. Times come from the CPU cycle counter
+// (ESP.getCycleCount(); HostCore backs it with a steady clock), so a sample
+// costs a register read. Build with -D FRAME_PROFILER=0 to compile it out.
+//
+// Each loop() is split into:
+//   update - input and state logic, excluding time spent in Display drawing
+//   draw   - time inside Display drawing calls (PROFILE_DRAW_SCOPE)
+//   flush  - present(): handing the frame to the panel
+//   bytes  - pixel bytes pushed for the frame
+// Samples are filed under the StateTransition of the state that ran.
+//
+// Debug console commands (see DebugConsole):
+//   p - print the report    r - reset all histograms    o - toggle overlay
+
+#ifndef FRAME_PROFILER
+#define FRAME_PROFILER 1
+#endif
+
+// Four buckets per power of two: values up to 2^17 (131 ms / 128 KB)
+#define PROFILE_BUCKETS 64
+// Histograms halve their counts every this many samples, so the report
+// follows roughly the last PROFILE_WINDOW frames of each state
+#define PROFILE_WINDOW 1024
+// One slot per StateTransition value
+#define PROFILE_STATE_SLOTS 11
+
+class Display;
+
+enum ProfileMetric {
+    PROFILE_UPDATE,
+    PROFILE_DRAW,
+    PROFILE_FLUSH,
+    PROFILE_BYTES,
+    PROFILE_METRIC_COUNT
+};
+
+// Log-bucketed histogram with exact min/max/average
+class ProfileHistogram {
+private:
+    uint16_t buckets[PROFILE_BUCKETS];
+    uint32_t count;
+    uint64_t sum;
+    uint32_t minValue;
+    uint32_t maxValue;
+
+    static int bucketFor(uint32_t value);
+    static uint32_t bucketFloor(int bucket);
+    void decay();
+
+public:
+    ProfileHistogram();
+
+    void reset();
+    void add(uint32_t value);
+
+    uint32_t getCount() const { return count; }
+    uint32_t getMin() const { return count ? minValue : 0; }
+    uint32_t getMax() const { return maxValue; }
+    uint32_t getAverage() const { return count ? (uint32_t)(sum / count) : 0; }
+    // Upper edge of the bucket holding the given percentile (capped at max)
+    uint32_t getPercentile(int percent) const;
+};
+
+class FrameProfiler {
+private:
+    static ProfileHistogram histograms[PROFILE_STATE_SLOTS][PROFILE_METRIC_COUNT];
+    static uint32_t frameStart;
+    static uint32_t updateEnd;
+    static uint32_t drawCycles;
+    static uint32_t updateDrawCycles;   // drawCycles as of endUpdate()
+    static uint32_t drawStart;
+    static int drawDepth;
+    static uint32_t cyclesPerMicro;
+
+    static bool overlayEnabled;
+    static bool overlayDrawn;
+    static uint32_t lastMicros[PROFILE_METRIC_COUNT];
+    static uint16_t loopFpsTenths;
+    static uint8_t loopIdlePercent;
+
+    static uint32_t toMicros(uint32_t cycles) { return cycles / cyclesPerMicro; }
+
+public:
+    static inline uint32_t now() { return ESP.getCycleCount(); }
+
+    // Frame phases, called from loop()
+    static void beginFrame();
+    static void endUpdate();
+    static void endFrame(int state, uint32_t bytesPushed);
+
+    // Nested drawing calls only count once
+    static inline void beginDraw() {
+        if (drawDepth++ == 0) drawStart = now();
+    }
+    static inline void endDraw() {
+        if (--drawDepth == 0) drawCycles += now() - drawStart;
+    }
+
+    // Loop rate as measured by the FrameScheduler
+    static void setLoopStats(uint16_t fpsTenths, uint8_t idlePercent) {
+        loopFpsTenths = fpsTenths;
+        loopIdlePercent = idlePercent;
+    }
+
+    // Debug console command; false if it isn't one of ours
+    static bool handleCommand(char command);
+    static void printReport();
+    static void reset();
+
+    // One-line readout of the last frame along the top of the screen
+    static void setOverlayEnabled(bool enabled) { overlayEnabled = enabled; }
+    static bool isOverlayEnabled() { return overlayEnabled; }
+    static void drawOverlay(Display* display);
+
+    static const ProfileHistogram& getHistogram(int state, ProfileMetric metric) {
+        return histograms[state][metric];
+    }
+};
+
+// Times the enclosing Display drawing call
+class ProfileDrawScope {
+public:
+    ProfileDrawScope() { FrameProfiler::beginDraw(); }
+    ~ProfileDrawScope() { FrameProfiler::endDraw(); }
+};
+
+#if FRAME_PROFILER
+#define PROFILE_DRAW_SCOPE() ProfileDrawScope profileDrawScope
+#else
+#define PROFILE_DRAW_SCOPE() do {} while (0)
+#endif
+
+#endif
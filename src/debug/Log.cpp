@@ -0,0 +1,75 @@
+#include "Log.h"
+#include <stdarg.h>
+
+char Log::ring[LOG_TX_BUFFER];
+uint32_t Log::head = 0;
+uint32_t Log::tail = 0;
+uint32_t Log::droppedLines = 0;
+uint32_t Log::reportedDrops = 0;
+
+static const char levelTags[] = {'-', 'E', 'W', 'I', 'D'};
+
+void Log::queue(const char* text, int length) {
+    for (int i = 0; i < length; i++) {
+        ring[(head + i) & (LOG_TX_BUFFER - 1)] = text[i];
+    }
+    head += length;
+}
+
+void Log::write(int level, const char* module, const char* format, ...) {
+    char line[LOG_LINE_MAX];
+    int length = snprintf(line, sizeof(line), "%c/%s: ", levelTags[constrain(level, 0, 4)], module);
+
+    va_list args;
+    va_start(args, format);
+    int body = vsnprintf(line + length, sizeof(line) - length - 1, format, args);
+    va_end(args);
+    if (body > 0) {
+        length = min(length + body, (int)sizeof(line) - 2);
+    }
+    line[length++] = '\n';
+
+    // Whole lines only; say how many were lost once there is room again
+    uint32_t free = LOG_TX_BUFFER - (head - tail);
+    if (droppedLines != reportedDrops && free >= (uint32_t)length + 32) {
+        char note[32];
+        int noteLength = snprintf(note, sizeof(note), "W/LOG: %lu lines dropped\n",
+                                  (unsigned long)(droppedLines - reportedDrops));
+        queue(note, noteLength);
+        reportedDrops = droppedLines;
+        free -= noteLength;
+    }
+    if ((uint32_t)length > free) {
+        droppedLines++;
+        return;
+    }
+    queue(line, length);
+
+    pump();
+}
+
+void Log::pump() {
+    while (head != tail) {
+        int room = Serial.availableForWrite();
+        if (room <= 0) return;
+
+        // Contiguous part of the ring only; the wrap goes out next pass
+        uint32_t start = tail & (LOG_TX_BUFFER - 1);
+        uint32_t pending = head - tail;
+        uint32_t chunk = min(pending, (uint32_t)(LOG_TX_BUFFER - start));
+        chunk = min(chunk, (uint32_t)room);
+
+        size_t sent = Serial.write((const uint8_t*)ring + start, chunk);
+        if (sent == 0) return;
+        tail += sent;
+    }
+}
+
+void Log::flush() {
+    while (head != tail) {
+        uint32_t start = tail & (LOG_TX_BUFFER - 1);
+        uint32_t chunk = min(head - tail, (uint32_t)(LOG_TX_BUFFER - start));
+        tail += Serial.write((const uint8_t*)ring + start, chunk);
+    }
+    Serial.flush();
+}
@@ -0,0 +1,111 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+
+// Leveled, per-module logging.
+//
+//   LOG_DEBUG(COMBAT, "turn %d: %s", turn, name.c_str());
+//
+// Levels and modules are filtered at compile time: a call above the
+// module's level sits behind a constant-false if, so it compiles to nothing
+// and its arguments are never evaluated. Enabled calls format into a fixed
+// stack buffer (no String, no heap) and queue the line in a TX ring that is
+// drained to Serial without blocking - Log::pump() once per loop() sends
+// whatever the UART can take. Lines that don't fit in the ring are dropped
+// and counted.
+//
+// Global level:  -D LOG_LEVEL=LOG_LEVEL_WARN     (default INFO)
+// Per module:    -D LOG_LEVEL_SPELL=LOG_LEVEL_DEBUG
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Modules default to the global level
+#ifndef LOG_LEVEL_MAIN
+#define LOG_LEVEL_MAIN LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_GAME
+#define LOG_LEVEL_GAME LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_COMBAT
+#define LOG_LEVEL_COMBAT LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_SPELL
+#define LOG_LEVEL_SPELL LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_ENTITY
+#define LOG_LEVEL_ENTITY LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_DUNGEON
+#define LOG_LEVEL_DUNGEON LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_ITEM
+#define LOG_LEVEL_ITEM LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_ROOM
+#define LOG_LEVEL_ROOM LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_MENU
+#define LOG_LEVEL_MENU LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_GFX
+#define LOG_LEVEL_GFX LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_UI
+#define LOG_LEVEL_UI LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_REPLAY
+#define LOG_LEVEL_REPLAY LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_HEAP
+#define LOG_LEVEL_HEAP LOG_LEVEL
+#endif
+
+// Longest line (longer ones are truncated) and TX ring size (power of two)
+#define LOG_LINE_MAX  160
+#define LOG_TX_BUFFER 2048
+
+#define LOG_ENABLED(module, level) ((level) <= LOG_LEVEL_##module)
+
+#define LOG_AT(level, module, ...) \
+    do { \
+        if (LOG_ENABLED(module, level)) Log::write(level, #module, __VA_ARGS__); \
+    } while (0)
+
+#define LOG_ERROR(module, ...) LOG_AT(LOG_LEVEL_ERROR, module, __VA_ARGS__)
+#define LOG_WARN(module, ...)  LOG_AT(LOG_LEVEL_WARN, module, __VA_ARGS__)
+#define LOG_INFO(module, ...)  LOG_AT(LOG_LEVEL_INFO, module, __VA_ARGS__)
+#define LOG_DEBUG(module, ...) LOG_AT(LOG_LEVEL_DEBUG, module, __VA_ARGS__)
+
+class Log {
+private:
+    static char ring[LOG_TX_BUFFER];
+    static uint32_t head;   // Next byte to queue
+    static uint32_t tail;   // Next byte to send
+    static uint32_t droppedLines;
+    static uint32_t reportedDrops;
+
+    static void queue(const char* text, int length);
+
+public:
+    // "I/COMBAT: message\n" into the TX ring
+    static void write(int level, const char* module, const char* format, ...)
+        __attribute__((format(printf, 3, 4)));
+
+    // Send what the UART can take right now (never blocks)
+    static void pump();
+    // Send everything, blocking (before a reset or after a crash)
+    static void flush();
+
+    static uint32_t getDroppedLines() { return droppedLines; }
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "Trace.h"
+#include "Log.h"
+#include <esp_heap_caps.h>
+
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+#include <esp_rom_sys.h>
+#define TRACE_PANIC_HOOK 1
+#else
+#define TRACE_PANIC_HOOK 0
+#endif
+
+TraceRecord* Trace::ring = nullptr;
+uint32_t Trace::capacity = 0;
+std::atomic<uint32_t> Trace::head(0);
+volatile bool Trace::paused = false;
+
+static const char* const eventNames[TRACE_EVENT_COUNT] = {
+    "state_change",
+    "combat_turn",
+    "spell_cast",
+    "door_choices",
+    "display_flush"
+};
+
+#if TRACE_ENABLED && TRACE_PANIC_HOOK
+static void onPanic(arduino_panic_info_t* info, void* arg) {
+    (void)info;
+    (void)arg;
+    Trace::dumpFromPanic();
+}
+#endif
+
+void Trace::init() {
+#if TRACE_ENABLED
+    if (ring) return;
+
+    if (psramFound()) {
+        ring = (TraceRecord*)heap_caps_malloc(TRACE_CAPACITY_PSRAM * sizeof(TraceRecord), MALLOC_CAP_SPIRAM);
+        capacity = TRACE_CAPACITY_PSRAM;
+    }
+    if (!ring) {
+        ring = (TraceRecord*)heap_caps_malloc(TRACE_CAPACITY_INTERNAL * sizeof(TraceRecord), MALLOC_CAP_8BIT);
+        capacity = TRACE_CAPACITY_INTERNAL;
+    }
+    if (!ring) {
+        capacity = 0;
+        return;
+    }
+
+#if TRACE_PANIC_HOOK
+    set_arduino_panic_handler(onPanic, nullptr);
+#endif
+#endif
+}
+
+//============================================================================
+// RECORDING
+//============================================================================
+
+void Trace::record(uint8_t event, uint8_t phase, int argCount, int32_t a0, int32_t a1, int32_t a2) {
+    if (!ring || paused) return;
+
+    // Producers on either core (or in an ISR) each claim their own slot
+    uint32_t slot = head.fetch_add(1, std::memory_order_relaxed) & (capacity - 1);
+    TraceRecord& rec = ring[slot];
+    rec.timeUs = micros();
+    rec.event = event;
+    rec.phase = phase;
+    rec.core = (uint8_t)xPortGetCoreID();
+    rec.argCount = (uint8_t)argCount;
+    rec.args[0] = a0;
+    rec.args[1] = a1;
+    rec.args[2] = a2;
+}
+
+void Trace::clear() {
+    head.store(0, std::memory_order_relaxed);
+}
+
+const char* Trace::eventName(uint8_t event) {
+    return event < TRACE_EVENT_COUNT ? eventNames[event] : "unknown";
+}
+
+//============================================================================
+// DUMP
+//============================================================================
+
+// Format (one line each):
+//   === TRACE BEGIN records=N recorded=R capacity=C ===
+//   N <id> <name>            event names
+//   T <40 hex digits>        one TraceRecord, little endian, oldest first
+//   === TRACE END ===
+void Trace::dumpTo(void (*emit)(const char* line)) {
+    static const char hexDigits[] = "0123456789abcdef";
+    char line[80];
+
+    paused = true;
+    uint32_t recorded = head.load(std::memory_order_acquire);
+    uint32_t count = min(recorded, capacity);
+
+    snprintf(line, sizeof(line), "%s records=%lu recorded=%lu capacity=%lu ===",
+             TRACE_DUMP_BEGIN, (unsigned long)count, (unsigned long)recorded, (unsigned long)capacity);
+    emit(line);
+    for (int i = 0; i < TRACE_EVENT_COUNT; i++) {
+        snprintf(line, sizeof(line), "N %d %s", i, eventNames[i]);
+        emit(line);
+    }
+
+    for (uint32_t n = recorded - count; n != recorded; n++) {
+        const uint8_t* bytes = (const uint8_t*)&ring[n & (capacity - 1)];
+        line[0] = 'T';
+        line[1] = ' ';
+        for (size_t b = 0; b < sizeof(TraceRecord); b++) {
+            line[2 + b * 2] = hexDigits[bytes[b] >> 4];
+            line[3 + b * 2] = hexDigits[bytes[b] & 0x0F];
+        }
+        line[2 + sizeof(TraceRecord) * 2] = '\0';
+        emit(line);
+    }
+
+    emit(TRACE_DUMP_END);
+    paused = false;
+}
+
+static void emitSerial(const char* line) {
+    Serial.println(line);
+}
+
+void Trace::dump() {
+    Log::flush();  // Keep queued log lines ahead of the dump
+    dumpTo(emitSerial);
+    Serial.flush();
+}
+
+#if TRACE_PANIC_HOOK
+static void emitRom(const char* line) {
+    esp_rom_printf("%s\n", line);
+}
+#endif
+
+void Trace::dumpFromPanic() {
+#if TRACE_PANIC_HOOK
+    if (ring) dumpTo(emitRom);
+#endif
+}
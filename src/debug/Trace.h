@@ -0,0 +1,138 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Binary event trace. Each event is a fixed 20-byte record (timestamp,
+// event id, phase, core, up to three int args) claimed with one atomic add
+// in a ring that lives in PSRAM when the board has it. Recording never
+// formats, allocates or touches Serial, so it can stay on under load; old
+// records are overwritten once the ring wraps.
+//
+//   TRACE_SCOPE(scope, TRACE_COMBAT_TURN, turnCounter);   // B ... E
+//   scope.setResult(result);                              // arg on the E
+//   TRACE_INSTANT(TRACE_STATE_CHANGE, from, to);
+//
+// The ring is dumped as hex lines ("d" on the debug console, or from the
+// panic handler) and tools/trace_decode.cpp turns a captured serial log
+// into Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+// Build with -D TRACE_ENABLED=0 to compile all of it out.
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+// Records in the ring (power of two): 160 KB in PSRAM, 10 KB without it
+#define TRACE_CAPACITY_PSRAM    8192
+#define TRACE_CAPACITY_INTERNAL 512
+
+#define TRACE_MAX_ARGS 3
+
+// Dump framing, shared with the decoder
+#define TRACE_DUMP_BEGIN "=== TRACE BEGIN"
+#define TRACE_DUMP_END   "=== TRACE END ==="
+
+enum TraceEvent : uint8_t {
+    TRACE_STATE_CHANGE,     // from, to (StateTransition)
+    TRACE_COMBAT_TURN,      // turn, player action | result
+    TRACE_SPELL_CAST,       // spell ID | synergy bonus (none: not cast)
+    TRACE_DOOR_CHOICES,     // floor, rooms completed | choices (cache misses only)
+    TRACE_DISPLAY_FLUSH,    // rects | bytes (async: from present() to DMA done)
+    TRACE_EVENT_COUNT
+};
+
+enum TracePhase : uint8_t {
+    TRACE_PHASE_BEGIN = 'B',
+    TRACE_PHASE_END = 'E',
+    TRACE_PHASE_INSTANT = 'i',
+    TRACE_PHASE_ASYNC_BEGIN = 'b',  // May overlap other spans (DMA)
+    TRACE_PHASE_ASYNC_END = 'e'
+};
+
+struct TraceRecord {
+    uint32_t timeUs;        // micros(); the decoder unwraps overflow
+    uint8_t event;
+    uint8_t phase;
+    uint8_t core;
+    uint8_t argCount;
+    int32_t args[TRACE_MAX_ARGS];
+};
+
+class Trace {
+private:
+    static TraceRecord* ring;
+    static uint32_t capacity;
+    static std::atomic<uint32_t> head;  // Total records ever claimed
+    static volatile bool paused;        // Set while dumping
+
+    static void dumpTo(void (*emit)(const char* line));
+
+public:
+    // Allocates the ring; records before init() are ignored
+    static void init();
+
+    static void record(uint8_t event, uint8_t phase, int argCount,
+                       int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0);
+
+    // Hex dump over Serial; tracing pauses while it runs
+    static void dump();
+    // Same dump through the ROM printf, for the panic handler
+    static void dumpFromPanic();
+    static void clear();
+
+    static const char* eventName(uint8_t event);
+    static uint32_t getCapacity() { return capacity; }
+    static uint32_t getRecorded() { return head.load(std::memory_order_relaxed); }
+};
+
+#if TRACE_ENABLED
+
+// Begin record now, end record (with the optional result) when it leaves scope
+class TraceScope {
+private:
+    uint8_t event;
+    bool hasResult;
+    int32_t result;
+
+public:
+    TraceScope(uint8_t ev) : event(ev), hasResult(false), result(0) {
+        Trace::record(ev, TRACE_PHASE_BEGIN, 0);
+    }
+    TraceScope(uint8_t ev, int32_t a0) : event(ev), hasResult(false), result(0) {
+        Trace::record(ev, TRACE_PHASE_BEGIN, 1, a0);
+    }
+    TraceScope(uint8_t ev, int32_t a0, int32_t a1) : event(ev), hasResult(false), result(0) {
+        Trace::record(ev, TRACE_PHASE_BEGIN, 2, a0, a1);
+    }
+    ~TraceScope() {
+        Trace::record(event, TRACE_PHASE_END, hasResult ? 1 : 0, result);
+    }
+    void setResult(int32_t value) { hasResult = true; result = value; }
+};
+
+#define TRACE_SCOPE(name, ...) TraceScope name(__VA_ARGS__)
+#define TRACE_INSTANT(event, ...) Trace::record(event, TRACE_PHASE_INSTANT, TRACE_ARG_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+#define TRACE_ASYNC_BEGIN(event, ...) Trace::record(event, TRACE_PHASE_ASYNC_BEGIN, TRACE_ARG_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+#define TRACE_ASYNC_END(event, ...) Trace::record(event, TRACE_PHASE_ASYNC_END, TRACE_ARG_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+
+// Number of macro arguments, 0 to 3
+#define TRACE_ARG_COUNT(...) TRACE_ARG_COUNT_(_, ##__VA_ARGS__, 3, 2, 1, 0)
+#define TRACE_ARG_COUNT_(_, a, b, c, n, ...) n
+
+#else
+
+class TraceScope {
+public:
+    TraceScope(uint8_t, int32_t = 0, int32_t = 0) {}
+    void setResult(int32_t) {}
+};
+
+#define TRACE_SCOPE(name, ...) TraceScope name(__VA_ARGS__)
+#define TRACE_INSTANT(event, ...) do {} while (0)
+#define TRACE_ASYNC_BEGIN(event, ...) do {} while (0)
+#define TRACE_ASYNC_END(event, ...) do {} while (0)
+
+#endif
+
+#endif
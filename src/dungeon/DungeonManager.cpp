@@ -1,5 +1,6 @@
 #include "DungeonManager.h"
 #include "../utils/constants.h"
+#include "../debug/Log.h"
 
 DungeonManager::DungeonManager(Player* p) {
     player = p;
@@ -18,8 +19,8 @@ void DungeonManager::startNewFloor() {
     currentFloor = new Floor(currentFloorNumber);
     currentFloor->generateFloor();
     
-    Serial.println("DungeonManager: Started fresh floor " + String(currentFloorNumber));
-    Serial.println("Rooms completed reset to 0");
+    LOG_INFO(DUNGEON, "DungeonManager: Started fresh floor %d", currentFloorNumber);
+    LOG_INFO(DUNGEON, "Rooms completed reset to 0");
 }
 
 std::vector<DoorChoice> DungeonManager::getAvailableRooms() {
@@ -44,7 +45,7 @@ void DungeonManager::markRoomCompleted() {
         totalRoomsCompleted++;
         
         if (currentFloor->isFloorComplete() && !currentFloor->isBossRoomReady()) {
-            Serial.println("Floor " + String(currentFloorNumber) + " complete!");
+            LOG_INFO(DUNGEON, "Floor %d complete!", currentFloorNumber);
         }
     }
 }
@@ -64,7 +65,7 @@ void DungeonManager::resetToFirstFloor() {
     totalRoomsCompleted = 0;
     
     startNewFloor();
-    Serial.println("DungeonManager: Complete reset to Floor 1");
+    LOG_INFO(DUNGEON, "DungeonManager: Complete reset to Floor 1");
 }
 
 // Getters
@@ -1,6 +1,9 @@
 #include "Floor.h"
 #include "../utils/constants.h"
+#include "../utils/Rng.h"
 #include <Arduino.h>
+#include "../debug/Log.h"
+#include "../debug/Trace.h"
 
 // Enemy spawn data structure and table
 struct EnemySpawnData {
@@ -36,7 +39,7 @@ Floor::Floor(int floorNum) {
 
 // Generate floor with boss room
 void Floor::generateFloor() {
-    Serial.println("Generating Floor " + String(floorNumber) + "...");
+    LOG_INFO(DUNGEON, "Generating Floor %d...", floorNumber);
     
     // Clear existing rooms
     for (Room* room : rooms) {
@@ -50,12 +53,12 @@ void Floor::generateFloor() {
     bossRoom->setEnemyType(3); // Orc boss
     rooms.push_back(bossRoom);
     
-    Serial.println("Floor " + String(floorNumber) + " initialized with boss room.");
+    LOG_INFO(DUNGEON, "Floor %d initialized with boss room.", floorNumber);
 }
 
 // Legacy room type selection (kept for compatibility)
 RoomType Floor::selectRandomRoomType() {
-    int roll = random(1, 101); // 1-100
+    int roll = Rng::roll(RNG_FLOOR, 1, 101); // 1-100
     
     if (roll <= 60) {
         return ROOM_ENEMY;
@@ -70,23 +73,25 @@ RoomType Floor::selectRandomRoomType() {
 RoomType Floor::selectRoomTypeForPosition(int roomPosition) {
     // Convert 0-based position to 1-based room number for clarity
     int roomNumber = roomPosition + 1;
-    Serial.println("DEBUG: Selecting room type for room " + String(roomNumber) + " (position " + String(roomPosition) + ") on floor " + String(floorNumber));
+    LOG_DEBUG(DUNGEON, "Selecting room type for room %d (position %d) on floor %d",
+              roomNumber, roomPosition, floorNumber);
     
     // Room 10 and above should not be generated through this method during regular room generation
     // This method should only handle rooms 1-10 for regular floor progression
     if (roomNumber > ROOMS_PER_FLOOR) {
-        Serial.println("ERROR: selectRoomTypeForPosition called for room " + String(roomNumber) + " which exceeds ROOMS_PER_FLOOR (" + String(ROOMS_PER_FLOOR) + ")");
+        LOG_ERROR(DUNGEON, "selectRoomTypeForPosition called for room %d which exceeds ROOMS_PER_FLOOR (%d)",
+                  roomNumber, ROOMS_PER_FLOOR);
         return ROOM_ENEMY; // Fallback to enemy room
     }
     
     // All rooms: 10% treasure, 90% enemy
-    int roll = random(1, 101); // 1-100
+    int roll = Rng::roll(RNG_FLOOR, 1, 101); // 1-100
     
     if (roll <= 10) {
-        Serial.println("DEBUG: Room " + String(roomNumber) + " - Rolled " + String(roll) + " - TREASURE room");
+        LOG_DEBUG(DUNGEON, "Room %d - Rolled %d - TREASURE room", roomNumber, roll);
         return ROOM_TREASURE;
     } else {
-        Serial.println("DEBUG: Room " + String(roomNumber) + " - Rolled " + String(roll) + " - ENEMY room");
+        LOG_DEBUG(DUNGEON, "Room %d - Rolled %d - ENEMY room", roomNumber, roll);
         return ROOM_ENEMY;
     }
 }
@@ -105,17 +110,19 @@ Room* Floor::getCurrentRoom() const {
 std::vector<DoorChoice> Floor::getAvailableChoices() {
     // If we already have choices generated for this turn, return them
     if (!currentChoices.empty()) {
-        Serial.println("DEBUG: Returning cached choices (" + String(currentChoices.size()) + " choices)");
+        LOG_DEBUG(DUNGEON, "Returning cached choices (%d choices)", (int)currentChoices.size());
         return currentChoices;
     }
+    TRACE_SCOPE(trace, TRACE_DOOR_CHOICES, floorNumber, roomsCompleted);
     
     // Calculate which door selection this is (1-based)
     int doorSelectionNumber = roomsCompleted + 1;
-    Serial.println("Floor " + String(floorNumber) + ": Door selection #" + String(doorSelectionNumber) + ", rooms completed: " + String(roomsCompleted));
+    LOG_INFO(DUNGEON, "Floor %d: Door selection #%d, rooms completed: %d",
+             floorNumber, doorSelectionNumber, roomsCompleted);
     
     // Check if we should show boss room (when counter shows 10/10)  
     if (roomsCompleted >= 10) {
-        Serial.println("Floor complete - offering boss room (rooms completed: " + String(roomsCompleted) + "/10)");
+        LOG_INFO(DUNGEON, "Floor complete - offering boss room (rooms completed: %d/10)", roomsCompleted);
         // Only boss room available
         DoorChoice bossChoice;
         bossChoice.room = getBossRoom();
@@ -123,8 +130,8 @@ std::vector<DoorChoice> Floor::getAvailableChoices() {
         bossChoice.description = "Final challenge awaits";
         currentChoices.push_back(bossChoice);
     } else {
-        Serial.println("Floor incomplete - generating rooms for positions " + String(roomsCompleted) + " and " + String(roomsCompleted + 1) + 
-                      " (rooms " + String(roomsCompleted + 1) + " and " + String(roomsCompleted + 2) + ")");
+        LOG_INFO(DUNGEON, "Floor incomplete - generating rooms for positions %d and %d (rooms %d and %d)",
+                 roomsCompleted, roomsCompleted + 1, roomsCompleted + 1, roomsCompleted + 2);
         
         // Clear any existing temporary rooms (keep only boss room)
         while (rooms.size() > 1) {
@@ -146,18 +153,15 @@ std::vector<DoorChoice> Floor::getAvailableChoices() {
             if (forceShopThisSelection && i == 0 && !shopGenerated) {
                 roomType = ROOM_SHOP;
                 shopGenerated = true;
-                Serial.println("DEBUG: Door selection 5 - forcing SHOP for choice " + String(i));
+                LOG_DEBUG(DUNGEON, "Door selection 5 - forcing SHOP for choice %d", i);
             } else {
                 roomType = selectRoomTypeForPosition(roomPosition);
             }
             
             Room* newRoom = new Room(roomsCompleted * 10 + i, roomType);
             
-            Serial.println("DEBUG: Generated room " + String(i) + " - Room " + String(roomPosition + 1) + 
-                          " - Type: " + String(roomType) + " (" + 
-                          (roomType == ROOM_ENEMY ? "ENEMY" : 
-                           roomType == ROOM_TREASURE ? "TREASURE" : 
-                           roomType == ROOM_SHOP ? "SHOP" : "UNKNOWN") + ")");
+            LOG_DEBUG(DUNGEON, "Generated room %d - Room %d - Type: %d (%s)",
+                      i, roomPosition + 1, roomType, roomType == ROOM_ENEMY ? "ENEMY" : roomType == ROOM_TREASURE ? "TREASURE" : roomType == ROOM_SHOP ? "SHOP" : "UNKNOWN");
             
             // Setup room content based on type
             switch(roomType) {
@@ -165,26 +169,26 @@ std::vector<DoorChoice> Floor::getAvailableChoices() {
                     {
                         int enemyType = selectFloorScaledEnemy(); // Use floor-based enemy selection
                         newRoom->setEnemyType(enemyType);
-                        Serial.println("  -> Enemy type: " + String(enemyType));
+                        LOG_INFO(DUNGEON, "  -> Enemy type: %d", enemyType);
                     }
                     break;
                     
                 case ROOM_TREASURE:
                     {
-                        int treasureType = random(1, 4);
-                        int treasureValue = floorNumber + random(1, 4);
+                        int treasureType = Rng::roll(RNG_LOOT, 1, 4);
+                        int treasureValue = floorNumber + Rng::roll(RNG_LOOT, 1, 4);
                         newRoom->setTreasure(treasureType, treasureValue);
-                        Serial.println("  -> Treasure type: " + String(treasureType) + ", value: " + String(treasureValue));
+                        LOG_INFO(DUNGEON, "  -> Treasure type: %d, value: %d", treasureType, treasureValue);
                     }
                     break;
                     
                 case ROOM_SHOP:
                     // Shop setup handled in room
-                    Serial.println("  -> Shop room ready");
+                    LOG_INFO(DUNGEON, "  -> Shop room ready");
                     break;
                     
                 default:
-                    Serial.println("  -> Unknown room type!");
+                    LOG_INFO(DUNGEON, "  -> Unknown room type!");
                     break;
             }
             
@@ -198,47 +202,46 @@ std::vector<DoorChoice> Floor::getAvailableChoices() {
             choice.description = newRoom->getDescription();
             currentChoices.push_back(choice);
             
-            Serial.println("  -> Added door choice " + String(i) + ": " + choice.description);
-            Serial.println("  -> Door icon: " + String(choice.icon == ICON_SWORD ? "SWORD" : choice.icon == ICON_QUESTION ? "QUESTION" : choice.icon == ICON_SKULL ? "SKULL" : "UNKNOWN"));
-            Serial.println("  -> Room type verification: " + String(newRoom->getType()));
+            LOG_INFO(DUNGEON, "  -> Added door choice %d: %s", i, choice.description.c_str());
+            LOG_INFO(DUNGEON, "  -> Door icon: %s",
+                     choice.icon == ICON_SWORD ? "SWORD" : choice.icon == ICON_QUESTION ? "QUESTION" : choice.icon == ICON_SKULL ? "SKULL" : "UNKNOWN");
+            LOG_INFO(DUNGEON, "  -> Room type verification: %d", newRoom->getType());
         }
     }
     
-    Serial.println("DEBUG: Generated " + String(currentChoices.size()) + " door choices");
+    LOG_DEBUG(DUNGEON, "Generated %d door choices", (int)currentChoices.size());
+    trace.setResult((int)currentChoices.size());
     return currentChoices;
 }
 
 // Room entry logic
 bool Floor::enterRoom(int choice) {
-    Serial.println("DEBUG: enterRoom called with choice " + String(choice));
+    LOG_DEBUG(DUNGEON, "enterRoom called with choice %d", choice);
     
     // Make sure we have current choices
     if (currentChoices.empty()) {
-        Serial.println("DEBUG: No current choices, generating them...");
+        LOG_DEBUG(DUNGEON, "No current choices, generating them...");
         getAvailableChoices();
     }
     
     if (choice < 0 || choice >= currentChoices.size()) {
-        Serial.println("ERROR: Invalid choice index: " + String(choice) + ", available: " + String(currentChoices.size()));
+        LOG_ERROR(DUNGEON, "Invalid choice index: %d, available: %d", choice, (int)currentChoices.size());
         return false;
     }
     
     currentRoom = currentChoices[choice].room;
     
     if (currentRoom) {
-        Serial.println("DEBUG: Successfully entered room - Type: " + String(currentRoom->getType()) + " (" + 
-                      (currentRoom->getType() == ROOM_ENEMY ? "ENEMY" : 
-                       currentRoom->getType() == ROOM_TREASURE ? "TREASURE" : 
-                       currentRoom->getType() == ROOM_SHOP ? "SHOP" : 
-                       currentRoom->getType() == ROOM_BOSS ? "BOSS" : "UNKNOWN") + ")");
+        LOG_DEBUG(DUNGEON, "Successfully entered room - Type: %d (%s)",
+                  currentRoom->getType(), currentRoom->getType() == ROOM_ENEMY ? "ENEMY" : currentRoom->getType() == ROOM_TREASURE ? "TREASURE" : currentRoom->getType() == ROOM_SHOP ? "SHOP" : currentRoom->getType() == ROOM_BOSS ? "BOSS" : "UNKNOWN");
         
         // IMPORTANT: Clear the current choices so new ones will be generated next time
         currentChoices.clear();
-        Serial.println("DEBUG: Cleared current choices for next turn");
+        LOG_DEBUG(DUNGEON, "Cleared current choices for next turn");
         
         return true;
     } else {
-        Serial.println("ERROR: Selected room is null!");
+        LOG_ERROR(DUNGEON, "Selected room is null!");
         return false;
     }
 }
@@ -269,15 +272,19 @@ int Floor::getFloorNumber() const {
 // Increment room completion counter
 void Floor::incrementRoomsCompleted() {
     roomsCompleted++;
-    Serial.println("DEBUG: Rooms completed incremented to: " + String(roomsCompleted));
+    LOG_DEBUG(DUNGEON, "Rooms completed incremented to: %d", roomsCompleted);
     // Clear current choices when a room is completed so new ones are generated
     currentChoices.clear();
-    Serial.println("DEBUG: Cleared choices after room completion");
+    LOG_DEBUG(DUNGEON, "Cleared choices after room completion");
 }
 
-// Floor-based enemy selection system
 int Floor::selectFloorScaledEnemy() {
-    Serial.println("DEBUG: Selecting enemy for floor " + String(floorNumber));
+    return rollEnemyForFloor(floorNumber);
+}
+
+// Floor-based enemy selection system
+int Floor::rollEnemyForFloor(int floorNumber) {
+    LOG_DEBUG(DUNGEON, "Selecting enemy for floor %d", floorNumber);
     
     // Build weighted list for current floor
     struct WeightedEnemy {
@@ -318,31 +325,29 @@ int Floor::selectFloorScaledEnemy() {
         totalWeight += currentWeight;
         availableCount++;
         
-        Serial.println("DEBUG: " + String(enemy.name) + " (ID:" + String(enemy.enemyID) + 
-                      ") weight: " + String(currentWeight));
+        LOG_DEBUG(DUNGEON, "%s (ID:%d) weight: %d", enemy.name, enemy.enemyID, currentWeight);
     }
     
     // Fallback if no enemies available (shouldn't happen)
     if (availableCount == 0 || totalWeight == 0) {
-        Serial.println("WARNING: No enemies available for floor " + String(floorNumber) + ", defaulting to Goblin");
+        LOG_WARN(DUNGEON, "No enemies available for floor %d, defaulting to Goblin", floorNumber);
         return 1; // Default to Goblin
     }
     
     // Select enemy based on weighted random
-    int roll = random(1, totalWeight + 1);
+    int roll = Rng::roll(RNG_FLOOR, 1, totalWeight + 1);
     int currentSum = 0;
     
     for (int i = 0; i < availableCount; i++) {
         currentSum += availableEnemies[i].weight;
         if (roll <= currentSum) {
-            Serial.println("DEBUG: Selected " + String(availableEnemies[i].name) + 
-                          " (rolled " + String(roll) + "/" + String(totalWeight) + ")");
+            LOG_DEBUG(DUNGEON, "Selected %s (rolled %d/%d)", availableEnemies[i].name, roll, totalWeight);
             return availableEnemies[i].enemyID;
         }
     }
     
     // Fallback (shouldn't reach here)
-    Serial.println("WARNING: Enemy selection fallback triggered");
+    LOG_WARN(DUNGEON, "Enemy selection fallback triggered");
     return availableEnemies[0].enemyID;
 }
 
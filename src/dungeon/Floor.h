@@ -8,7 +8,7 @@
 struct DoorChoice {
     Room* room;
     DoorIcon icon;
-    String description;
+    FlashString description;
 };
 
 class Floor {
@@ -45,6 +45,10 @@ public:
     std::vector<DoorChoice> getAvailableChoices();
     bool enterRoom(int choice);
     
+    // NEW: Weighted ENEMY_SPAWN_TABLE roll for a floor (also used by the
+    // host simulators)
+    static int rollEnemyForFloor(int floorNumber);
+    
     // Boss room access
     bool isBossRoomReady() const;
     Room* getBossRoom();
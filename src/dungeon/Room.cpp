@@ -1,5 +1,6 @@
 #include "Room.h"
 #include "../utils/constants.h"
+#include "../debug/Log.h"
 
 // Constructor
 Room::Room(int id, RoomType roomType) {
@@ -21,6 +22,10 @@ int Room::getRoomID() const {
     return roomID;
 }
 
+int Room::getEnemyType() const {
+    return enemyTypeID;
+}
+
 bool Room::isCompleted() const {
     return completed;
 }
@@ -31,22 +36,7 @@ void Room::setCompleted(bool complete) {
 
 // Create enemy based on room's enemy type
 Enemy Room::createEnemy() const {
-    switch(enemyTypeID) {
-        case 1:
-            return Enemy::createGoblin();
-        case 2:
-            return Enemy::createSkeleton();
-        case 3:
-            return Enemy::createOrc();
-        case 4: 
-            return Enemy::createTroll();
-        case 5: 
-            return Enemy::createDragon();
-        case 6: 
-            return Enemy::createBandit();
-        default:
-            return Enemy::createGoblin();
-    }
+    return Enemy::createEnemyByID(enemyTypeID);
 }
 
 // Give treasure to player
@@ -56,19 +46,19 @@ void Room::giveTreasure(Player* player) {
     switch(treasureType) {
         case 1: // Health Potions
             player->addHealthPotions(treasureValue);
-            Serial.println("Found " + String(treasureValue) + " health potions!");
+            LOG_INFO(DUNGEON, "Found %d health potions!", treasureValue);
             break;
         case 2: // Equipment Bonus
             player->addEquipmentBonus(treasureValue, treasureValue, treasureValue, treasureValue);
-            Serial.println("Found magical equipment! (+" + String(treasureValue) + " to all stats)");
+            LOG_INFO(DUNGEON, "Found magical equipment! (+%d to all stats)", treasureValue);
             break;
         case 3: // Large Equipment Bonus
             player->addEquipmentBonus(treasureValue * 2, treasureValue, treasureValue, 0);
-            Serial.println("Found powerful armor! (+" + String(treasureValue * 2) + " HP, +" + String(treasureValue) + " ATK/DEF)");
+            LOG_INFO(DUNGEON, "Found powerful armor! (+%d HP, +%d ATK/DEF)", treasureValue * 2, treasureValue);
             break;
         default:
             player->addHealthPotions(2);
-            Serial.println("Found 2 health potions!");
+            LOG_INFO(DUNGEON, "Found 2 health potions!");
             break;
     }
     
@@ -78,12 +68,12 @@ void Room::giveTreasure(Player* player) {
 // Open shop for player (now represents library access)
 void Room::openShop(Player* player) {
     if (shopVisited) {
-        Serial.println("The library has already been visited!");
+        LOG_INFO(DUNGEON, "The library has already been visited!");
         return;
     }
     
     // Library visit - this is handled by LibraryRoomState now
-    Serial.println("Library: Entering the mystical library...");
+    LOG_INFO(DUNGEON, "Library: Entering the mystical library...");
     
     shopVisited = true;
     setCompleted(true);
@@ -106,7 +96,7 @@ DoorIcon Room::getDoorIcon() const {
 }
 
 // Get room description - UPDATED for library theme
-String Room::getDescription() const {
+FlashString Room::getDescription() const {
     switch(type) {
         case ROOM_ENEMY:
             return "Growling  echoes    within";
@@ -122,7 +112,7 @@ String Room::getDescription() const {
 }
 
 // Get room name - UPDATED for library theme
-String Room::getRoomName() const {
+FlashString Room::getRoomName() const {
     switch(type) {
         case ROOM_ENEMY:
             return "Combat Room";
@@ -46,13 +46,14 @@ public:
     
     // Room content
     Enemy createEnemy() const;
+    int getEnemyType() const;
     void giveTreasure(Player* player);
     void openShop(Player* player);
     
     // Display
     DoorIcon getDoorIcon() const;
-    String getDescription() const;
-    String getRoomName() const;
+    FlashString getDescription() const;
+    FlashString getRoomName() const;
     
     // Room setup
     void setEnemyType(int enemyID);
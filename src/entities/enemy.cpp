@@ -1,5 +1,6 @@
 #include "enemy.h"
 #include "../utils/constants.h"
+#include "../utils/Rng.h"
 
 // Default constructor
 Enemy::Enemy() : Entity("Unknown Enemy", 20, 8, 4, 6) {
@@ -9,24 +10,24 @@ Enemy::Enemy() : Entity("Unknown Enemy", 20, 8, 4, 6) {
 }
 
 // Basic constructor
-Enemy::Enemy(String enemyName, int hp, int atk, int spd) 
+Enemy::Enemy(FlashString enemyName, int hp, int atk, int spd) 
     : Entity(enemyName, hp, atk, 4, spd) {  // Default defense of 4
     aiType = AI_BALANCED;
-    spriteFile = "enemies/" + enemyName + ".bmp";
+    spriteFile.appendf("enemies/%s.bmp", enemyName.c_str());
     experienceValue = (hp + atk + spd) / 3; // Simple exp calculation
 }
 
 // Full constructor with AI type
-Enemy::Enemy(String enemyName, int hp, int atk, int spd, AIType ai) 
+Enemy::Enemy(FlashString enemyName, int hp, int atk, int spd, AIType ai) 
     : Entity(enemyName, hp, atk, 4, spd) {  // Default defense of 4
     aiType = ai;
-    spriteFile = "enemies/" + enemyName + ".bmp";
+    spriteFile.appendf("enemies/%s.bmp", enemyName.c_str());
     experienceValue = (hp + atk + spd) / 3;
 }
 
 // AI Decision Making
 EnemyAction Enemy::chooseAction() {
-    int roll = random(1, 101); // Random number 1-100
+    int roll = Rng::roll(RNG_COMBAT, 1, 101); // Random number 1-100
     
     switch(aiType) {
         case AI_AGGRESSIVE:
@@ -96,12 +97,12 @@ AIType Enemy::getAIType() const {
     return aiType;
 }
 
-void Enemy::setSpriteFile(String filename) {
+void Enemy::setSpriteFile(const char* filename) {
     spriteFile = filename;
 }
 
-String Enemy::getSpriteFile() const {
-    return spriteFile;
+const char* Enemy::getSpriteFile() const {
+    return spriteFile.c_str();
 }
 
 void Enemy::setExperienceValue(int exp) {
@@ -112,6 +113,15 @@ int Enemy::getExperienceValue() const {
     return experienceValue;
 }
 
+// Combat stats with status effects (defense: Entity::getTotalDefense)
+int Enemy::getEffectiveAttack() const {
+    return max(1, attack - activeEffects.penalty(STAT_ATTACK));
+}
+
+int Enemy::getEffectiveSpeed() const {
+    return max(1, speed - activeEffects.penalty(STAT_SPEED));
+}
+
 // Simple Enemy Factory Methods
 Enemy Enemy::createGoblin() {
     Enemy goblin("Goblin", GOBLIN_HP, GOBLIN_ATK, GOBLIN_SPD, AI_AGGRESSIVE);
@@ -162,7 +172,7 @@ Enemy Enemy::createBandit() {
 }
 
 Enemy Enemy::createRandomEnemy() {
-    int enemyType = random(1, 4); // Random 1-3
+    int enemyType = Rng::roll(RNG_FLOOR, 1, 4); // Random 1-3
     
     switch(enemyType) {
         case 1:
@@ -176,6 +186,25 @@ Enemy Enemy::createRandomEnemy() {
     }
 }
 
+Enemy Enemy::createEnemyByID(int enemyID) {
+    switch(enemyID) {
+        case 1:
+            return createGoblin();
+        case 2:
+            return createSkeleton();
+        case 3:
+            return createOrc();
+        case 4:
+            return createTroll();
+        case 5:
+            return createDragon();
+        case 6:
+            return createBandit();
+        default:
+            return createGoblin();
+    }
+}
+
 // Destructor
 Enemy::~Enemy() {
     // Nothing special to clean up
@@ -4,6 +4,9 @@
 #include "entity.h"
 #include <Arduino.h>
 
+// "enemies/<name>.bmp" for the longest enemy name, with room to spare
+#define ENEMY_SPRITE_PATH_MAX 40
+
 enum AIType {
     AI_AGGRESSIVE,   // Always attacks (80% attack, 20% defend)
     AI_DEFENSIVE,    // Prefers to defend (40% attack, 60% defend)
@@ -19,14 +22,14 @@ enum EnemyAction {
 class Enemy : public Entity {
 private:
     AIType aiType;
-    String spriteFile;
+    FixedString<ENEMY_SPRITE_PATH_MAX> spriteFile;
     int experienceValue;
     
 public:
     // Constructors
     Enemy();
-    Enemy(String enemyName, int hp, int atk, int spd);
-    Enemy(String enemyName, int hp, int atk, int spd, AIType ai);
+    Enemy(FlashString enemyName, int hp, int atk, int spd);
+    Enemy(FlashString enemyName, int hp, int atk, int spd, AIType ai);
     
     // AI behavior
     EnemyAction chooseAction();
@@ -34,13 +37,17 @@ public:
     AIType getAIType() const;
     
     // Sprite management
-    void setSpriteFile(String filename);
-    String getSpriteFile() const;
+    void setSpriteFile(const char* filename);
+    const char* getSpriteFile() const;
     
     // Experience/rewards (for future leveling system)
     void setExperienceValue(int exp);
     int getExperienceValue() const;
     
+    // Combat stats with status effects applied
+    int getEffectiveAttack() const;    // Attack less debuffs
+    int getEffectiveSpeed() const;     // Speed less debuffs
+    
     // Combat actions (override parent for AI-specific behavior)
     int performAttack() override;
     int performDefend() override;
@@ -53,6 +60,8 @@ public:
     static Enemy createDragon();      // ID 5
     static Enemy createBandit();      // ID 6
     static Enemy createRandomEnemy();
+    // NEW: By spawn table / room enemy ID (1 Goblin ... 6 Bandit; else Goblin)
+    static Enemy createEnemyByID(int enemyID);
     
     virtual ~Enemy();
 };
@@ -1,5 +1,6 @@
 #include "entity.h"
 #include "../utils/constants.h"
+#include "../debug/Log.h"
 
 // Default constructor
 Entity::Entity() {
@@ -14,7 +15,7 @@ Entity::Entity() {
 }
 
 // Constructor with parameters
-Entity::Entity(String entityName, int hp, int atk, int def, int spd) {
+Entity::Entity(FlashString entityName, int hp, int atk, int def, int spd) {
     name = entityName;
     maxHP = hp;
     currentHP = hp;  // Start at full health
@@ -26,7 +27,7 @@ Entity::Entity(String entityName, int hp, int atk, int def, int spd) {
 }
 
 // Basic getters
-String Entity::getName() const {
+FlashString Entity::getName() const {
     return name;
 }
 
@@ -47,7 +48,7 @@ int Entity::getDefense() const {
 }
 
 // Basic setters
-void Entity::setName(String newName) {
+void Entity::setName(FlashString newName) {
     name = newName;
 }
 
@@ -65,8 +66,8 @@ void Entity::setStats(int hp, int atk, int def, int spd) {
 
 // Health management
 void Entity::takeDamage(int damage) {
-    // Apply base defense + temporary defense
-    int totalDefenseValue = defense + temporaryDefense;
+    // Apply base defense (less debuffs) + temporary defense
+    int totalDefenseValue = getTotalDefense();
     int actualDamage = damage - totalDefenseValue;
     
     // Use constant for minimum damage
@@ -85,6 +86,13 @@ void Entity::takeDamage(int damage) {
     resetDefense();
 }
 
+void Entity::takeDirectDamage(int damage) {
+    currentHP -= damage;
+    if (currentHP < 0) {
+        currentHP = 0;
+    }
+}
+
 void Entity::heal(int amount) {
     currentHP += amount;
     
@@ -131,10 +139,213 @@ void Entity::addTemporaryDefense(int defense) {
 }
 
 int Entity::getTotalDefense() const {
-    return defense + temporaryDefense;
+    int baseDefense = defense - activeEffects.penalty(STAT_DEFENSE);
+    return max(0, baseDefense) + temporaryDefense;
+}
+
+// Status effect management
+void Entity::addSpellEffect(SpellEffect effect, int value, int duration, FlashString sourceName, StatusStat stat) {
+    activeEffects.add(effect, value, duration, sourceName, stat);
+    LOG_INFO(ENTITY, "Applied spell effect: %s (%d turns)", sourceName.c_str(), duration);
+}
+
+void Entity::updateSpellEffects() {
+    // Burns and regeneration act each turn; BUFF/DEBUFF/SHIELD effects are
+    // passive, read through the store's totals
+    if (activeEffects.hasPeriodic()) {
+        for (int i = 0; i < activeEffects.size(); i++) {
+            int value = activeEffects.getValue(i);
+            switch (activeEffects.getEffect(i)) {
+                case EFFECT_DAMAGE_OVER_TIME:
+                    takeDirectDamage(value);
+                    LOG_INFO(ENTITY, "DoT: %d damage from %s", value, activeEffects.getSource(i).c_str());
+                    break;
+                case EFFECT_HEAL:
+                    heal(value);
+                    LOG_INFO(ENTITY, "HoT: %d healing from %s", value, activeEffects.getSource(i).c_str());
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    
+    // Count the turn, dropping whatever ran out
+    activeEffects.advance();
+}
+
+void Entity::clearSpellEffects() {
+    activeEffects.clear();
+    LOG_INFO(ENTITY, "All spell effects cleared");
+}
+
+bool Entity::hasActiveEffect(SpellEffect effect) const {
+    return activeEffects.has(effect);
+}
+
+int Entity::getActiveEffectValue(SpellEffect effect) const {
+    return activeEffects.total(effect);
+}
+
+const ActiveEffectStore& Entity::getActiveEffects() const {
+    return activeEffects;
+}
+
+// Turn management
+void Entity::startTurn() {
+    // Nothing by default; the player clears its ward and regenerates mana
+}
+
+void Entity::endTurn() {
+    updateSpellEffects(); // Process ongoing spell effects
 }
 
 // Virtual destructor
 Entity::~Entity() {
     // Nothing to clean up for basic entity
-}
\ No newline at end of file
+}
+
+//============================================================================
+// ACTIVE EFFECT STORE
+//============================================================================
+
+// What reapplying an effect from the same source does
+enum EffectStacking {
+    STACK_SEPARATE,     // Another entry (shields and buffs add up)
+    STACK_REFRESH       // The existing entry: the stronger value, the later expiry
+};
+
+static const uint8_t effectStacking[SPELL_EFFECT_COUNT] = {
+    STACK_SEPARATE,     // EFFECT_DAMAGE (never stored)
+    STACK_REFRESH,      // EFFECT_DAMAGE_OVER_TIME
+    STACK_SEPARATE,     // EFFECT_HEAL
+    STACK_SEPARATE,     // EFFECT_SHIELD
+    STACK_SEPARATE,     // EFFECT_BUFF
+    STACK_REFRESH       // EFFECT_DEBUFF
+};
+
+void ActiveEffectStore::add(SpellEffect effect, int value, int duration, FlashString source, StatusStat stat) {
+    // Everything lasts at least to the end of the current turn
+    uint16_t until = now + (duration > 0 ? duration : 1);
+    
+    if (effectStacking[effect] == STACK_REFRESH) {
+        int slot = find(effect, stat, source);
+        if (slot >= 0) {
+            if (value > values[slot]) {
+                totals[effect] += value - values[slot];
+                if (effect == EFFECT_DEBUFF) penalties[stat] += value - values[slot];
+                values[slot] = (int16_t)value;
+            }
+            if ((int16_t)(until - expiry[slot]) > 0) {
+                unlink(slot);
+                expiry[slot] = until;
+                link(slot);
+            }
+            return;
+        }
+    }
+    
+    if (count == MAX_SPELL_EFFECTS) {
+        int soonest = 0;
+        for (int i = 1; i < count; i++) {
+            if (getRemaining(i) < getRemaining(soonest)) soonest = i;
+        }
+        LOG_WARN(ENTITY, "Too many spell effects; %s replaces %s", source.c_str(), getSource(soonest).c_str());
+        removeAt(soonest);
+    }
+    
+    int slot = freeHead;
+    freeHead = links[slot];
+    effects[slot] = (uint8_t)effect;
+    stats[slot] = (uint8_t)stat;
+    values[slot] = (int16_t)value;
+    expiry[slot] = until;
+    sources[slot] = source;
+    link(slot);
+    order[count++] = (uint8_t)slot;
+    
+    totals[effect] += value;
+    counts[effect]++;
+    if (effect == EFFECT_DEBUFF) penalties[stat] += value;
+}
+
+void ActiveEffectStore::removeAt(int index) {
+    if (index < 0 || index >= count) return;
+    
+    int slot = order[index];
+    unlink(slot);
+    release(slot);
+}
+
+void ActiveEffectStore::clear() {
+    count = 0;
+    now = 0;
+    for (int i = 0; i < MAX_SPELL_EFFECTS; i++) {
+        links[i] = (int8_t)(i + 1 < MAX_SPELL_EFFECTS ? i + 1 : -1);
+    }
+    freeHead = 0;
+    memset(wheel, -1, sizeof(wheel));
+    memset(totals, 0, sizeof(totals));
+    memset(counts, 0, sizeof(counts));
+    memset(penalties, 0, sizeof(penalties));
+}
+
+int ActiveEffectStore::advance() {
+    now++;
+    
+    // Only this turn's slot; entries in it a lap or more away stay put
+    int expired = 0;
+    int8_t* at = &wheel[now % EFFECT_WHEEL_SLOTS];
+    while (*at >= 0) {
+        int slot = *at;
+        if (expiry[slot] != now) {
+            at = &links[slot];
+            continue;
+        }
+        *at = links[slot];
+        LOG_INFO(ENTITY, "Spell effect expired: %s", sources[slot].c_str());
+        release(slot);
+        expired++;
+    }
+    return expired;
+}
+
+// Onto the front of the wheel slot for its expiry
+void ActiveEffectStore::link(int slot) {
+    int8_t& head = wheel[expiry[slot] % EFFECT_WHEEL_SLOTS];
+    links[slot] = head;
+    head = (int8_t)slot;
+}
+
+void ActiveEffectStore::unlink(int slot) {
+    int8_t* at = &wheel[expiry[slot] % EFFECT_WHEEL_SLOTS];
+    while (*at != slot) {
+        at = &links[*at];
+    }
+    *at = links[slot];
+}
+
+// Out of the order and the totals and back to the free list (once unlinked)
+void ActiveEffectStore::release(int slot) {
+    int index = 0;
+    while (order[index] != slot) index++;
+    for (int i = index; i < count - 1; i++) {
+        order[i] = order[i + 1];
+    }
+    count--;
+    
+    totals[effects[slot]] -= values[slot];
+    counts[effects[slot]]--;
+    if (effects[slot] == EFFECT_DEBUFF) penalties[stats[slot]] -= values[slot];
+    links[slot] = freeHead;
+    freeHead = (int8_t)slot;
+}
+
+// Pool slot of the entry from source with this effect and stat, or -1
+int ActiveEffectStore::find(SpellEffect effect, StatusStat stat, FlashString source) const {
+    for (int i = 0; i < count; i++) {
+        int slot = order[i];
+        if (effects[slot] == effect && stats[slot] == stat && sources[slot] == source) return slot;
+    }
+    return -1;
+}
@@ -2,11 +2,95 @@
 #define ENTITY_H
 
 #include <Arduino.h>
+#include "../spells/spell_types.h"
+#include "../utils/constants.h"
+#include "../utils/FixedString.h"
+
+// Spell effect structure for temporary effects (a copy of one store entry)
+struct ActiveSpellEffect {
+    SpellEffect effect;
+    int value;
+    int remainingDuration;
+    FlashString sourceName;  // The spell's name
+    
+    ActiveSpellEffect(SpellEffect e, int v, int d, FlashString name = FlashString())
+        : effect(e), value(v), remainingDuration(d), sourceName(name) {}
+};
+
+// An entity's status effects (the player's buffs and shields, an enemy's
+// burns and debuffs) in a fixed pool, with a running total and count per
+// SpellEffect and per debuffed stat, so stat reads never scan the list.
+//
+// Expiry runs on a timer wheel: each entry is linked into the slot for the
+// turn it runs out, so advancing a turn visits only that slot instead of
+// counting every entry down. A refresh relinks its entry under the new
+// turn; entries further off than the wheel spans wait out the extra laps.
+//
+// Stacking: the same source reapplying a burn or debuff refreshes it (the
+// stronger value, the later expiry); everything else stacks as a new entry.
+// Also the read-only view handed out by Entity::getActiveEffects(), oldest
+// entry first.
+class ActiveEffectStore {
+private:
+    uint8_t count;
+    uint8_t order[MAX_SPELL_EFFECTS];         // Pool slots, oldest first
+    
+    // Pool, one array per field
+    uint8_t effects[MAX_SPELL_EFFECTS];       // SpellEffect
+    uint8_t stats[MAX_SPELL_EFFECTS];         // StatusStat
+    int16_t values[MAX_SPELL_EFFECTS];
+    uint16_t expiry[MAX_SPELL_EFFECTS];       // Turn it runs out
+    int8_t links[MAX_SPELL_EFFECTS];          // Next in its wheel slot, or the free list
+    FlashString sources[MAX_SPELL_EFFECTS];
+    int8_t freeHead;
+    
+    // Timer wheel
+    int8_t wheel[EFFECT_WHEEL_SLOTS];         // First entry per slot, -1 if none
+    uint16_t now;                             // Turns advanced
+    
+    int16_t totals[SPELL_EFFECT_COUNT];       // Sum of values per effect
+    uint8_t counts[SPELL_EFFECT_COUNT];       // Entries per effect
+    int16_t penalties[STATUS_STAT_COUNT];     // Sum of debuffs per stat
+    
+    void link(int slot);
+    void unlink(int slot);
+    void release(int slot);
+    int find(SpellEffect effect, StatusStat stat, FlashString source) const;
+
+public:
+    ActiveEffectStore() { clear(); }
+    
+    // Applies the stacking rules; full: replaces the entry closest to expiring
+    void add(SpellEffect effect, int value, int duration, FlashString source, StatusStat stat = STAT_ALL);
+    void removeAt(int index);   // Keeps the order of the rest
+    void clear();
+    // Moves on a turn and drops what ran out; returns how many did
+    int advance();
+    
+    // Aggregates
+    int total(SpellEffect effect) const { return totals[effect]; }
+    bool has(SpellEffect effect) const { return counts[effect] > 0; }
+    int penalty(StatusStat stat) const { return penalties[stat]; }
+    // Any burns or regeneration for Entity::updateSpellEffects() to apply
+    bool hasPeriodic() const { return counts[EFFECT_DAMAGE_OVER_TIME] + counts[EFFECT_HEAL] > 0; }
+    
+    // Entries
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    SpellEffect getEffect(int index) const { return (SpellEffect)effects[order[index]]; }
+    StatusStat getStat(int index) const { return (StatusStat)stats[order[index]]; }
+    int getValue(int index) const { return values[order[index]]; }
+    int getRemaining(int index) const { return (uint16_t)(expiry[order[index]] - now); }
+    FlashString getSource(int index) const { return sources[order[index]]; }
+    ActiveSpellEffect operator[](int index) const {
+        return ActiveSpellEffect(getEffect(index), getValue(index), getRemaining(index), getSource(index));
+    }
+};
 
 class Entity {
 protected:
     // Core stats
-    String name;
+    FlashString name;  // Names are literals; no heap copy per entity
     int maxHP;
     int currentHP;
     int attack;
@@ -17,13 +101,16 @@ protected:
     bool isDefending;
     int temporaryDefense;
     
+    // Status effects (buffs, shields, burns, debuffs)
+    ActiveEffectStore activeEffects;
+
 public:
     // Constructors
     Entity();
-    Entity(String entityName, int hp, int atk, int def, int spd);
+    Entity(FlashString entityName, int hp, int atk, int def, int spd);
     
     // Basic getters
-    String getName() const;
+    FlashString getName() const;
     int getCurrentHP() const;
     int getMaxHP() const;
     int getAttack() const;
@@ -31,11 +118,12 @@ public:
     int getSpeed() const;
     
     // Basic setters
-    void setName(String newName);
+    void setName(FlashString newName);
     void setStats(int hp, int atk, int def, int spd);
     
     // Health management
     void takeDamage(int damage);
+    void takeDirectDamage(int damage);  // Past defense, stance kept (burns)
     void heal(int amount);
     bool isAlive() const;
     
@@ -48,10 +136,23 @@ public:
     void setDefending(bool defending);
     bool getIsDefending() const;
     void addTemporaryDefense(int defense);
-    int getTotalDefense() const;
+    int getTotalDefense() const;    // Base defense less any debuff, plus temporary
+    
+    // Status effect management
+    void addSpellEffect(SpellEffect effect, int value, int duration, FlashString sourceName = FlashString(),
+                        StatusStat stat = STAT_ALL);
+    void updateSpellEffects(); // Called each turn
+    void clearSpellEffects();
+    bool hasActiveEffect(SpellEffect effect) const;
+    int getActiveEffectValue(SpellEffect effect) const;
+    const ActiveEffectStore& getActiveEffects() const;
+    
+    // Turn management (the entity's own action in a combat round)
+    virtual void startTurn();  // Called before it acts
+    virtual void endTurn();    // Called after it acts: effects tick and expire
     
     // Virtual destructor for inheritance
     virtual ~Entity();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,6 +1,7 @@
 #include "player.h"
 #include "../utils/constants.h"
 #include "../spells/spell.h"  // Include spell header in the cpp file
+#include "../debug/Log.h"
 
 // Default constructor - creates a starting wizard
 Player::Player() : Entity("Wizard", WIZARD_START_HP, WIZARD_START_ATK, WIZARD_START_DEF, WIZARD_START_SPD) {
@@ -21,12 +22,11 @@ Player::Player() : Entity("Wizard", WIZARD_START_HP, WIZARD_START_ATK, WIZARD_ST
     
     // Initialize spell library with TWO starter spells
     spellLibrary = new SpellLibrary();
-    auto starterSpells = SpellFactory::createStarterSpells();
-    for (int i = 0; i < starterSpells.size(); i++) {
-        Spell* spell = starterSpells[i];
+    for (int i = 0; i < STARTER_SPELL_COUNT; i++) {
+        const Spell* spell = SpellFactory::getStarterSpell(i);
         spellLibrary->learnSpell(spell);
         spellLibrary->equipSpell(spell->getID(), i); // Equip to slot 0 and 1
-        Serial.println("Starting with spell: " + spell->getName() + " equipped to slot " + String(i + 1));
+        LOG_INFO(ENTITY, "Starting with spell: %s equipped to slot %d", spell->getName().c_str(), i + 1);
     }
     
     // Initialize scroll inventory
@@ -40,7 +40,7 @@ Player::Player() : Entity("Wizard", WIZARD_START_HP, WIZARD_START_ATK, WIZARD_ST
 }
 
 // Constructor with name
-Player::Player(String playerName) : Entity(playerName, WIZARD_START_HP, WIZARD_START_ATK, WIZARD_START_DEF, WIZARD_START_SPD) {
+Player::Player(FlashString playerName) : Entity(playerName, WIZARD_START_HP, WIZARD_START_ATK, WIZARD_START_DEF, WIZARD_START_SPD) {
     baseHP = WIZARD_START_HP;
     baseAttack = WIZARD_START_ATK;
     baseDefense = WIZARD_START_DEF;
@@ -58,20 +58,19 @@ Player::Player(String playerName) : Entity(playerName, WIZARD_START_HP, WIZARD_S
     
     // Initialize spell library with TWO starter spells
     spellLibrary = new SpellLibrary();
-    auto starterSpells = SpellFactory::createStarterSpells();
-    for (int i = 0; i < starterSpells.size(); i++) {
-        Spell* spell = starterSpells[i];
+    for (int i = 0; i < STARTER_SPELL_COUNT; i++) {
+        const Spell* spell = SpellFactory::getStarterSpell(i);
         spellLibrary->learnSpell(spell);
         spellLibrary->equipSpell(spell->getID(), i); // Equip to slot 0 and 1
-        Serial.println("Starting with spell: " + spell->getName() + " equipped to slot " + String(i + 1));
+        LOG_INFO(ENTITY, "Starting with spell: %s equipped to slot %d", spell->getName().c_str(), i + 1);
     }
     
     // Initialize scroll inventory
     scrollInventory.clear();
-    Spell* startingScroll = SpellFactory::createSpell(1); // Fireball scroll
+    const Spell* startingScroll = SpellFactory::getSpell(1); // Fireball scroll
     if (startingScroll) {
         scrollInventory.push_back(startingScroll);
-        Serial.println("Player starts with scroll: " + startingScroll->getName());
+        LOG_INFO(ENTITY, "Player starts with scroll: %s", startingScroll->getName().c_str());
     }
     
     healthPotions = STARTING_POTIONS;
@@ -82,7 +81,7 @@ Player::Player(String playerName) : Entity(playerName, WIZARD_START_HP, WIZARD_S
 }
 
 // Constructor with custom stats
-Player::Player(String playerName, int hp, int atk, int def, int spd, int mana) : Entity(playerName, hp, atk, def, spd) {
+Player::Player(FlashString playerName, int hp, int atk, int def, int spd, int mana) : Entity(playerName, hp, atk, def, spd) {
     baseHP = hp;
     baseAttack = atk;
     baseDefense = def;
@@ -119,16 +118,17 @@ Player::~Player() {
 // SCROLL INVENTORY SYSTEM IMPLEMENTATION
 //============================================================================
 
-bool Player::addScroll(Spell* scroll) {
+bool Player::addScroll(const Spell* scroll) {
     if (!scroll) return false;
     
     if (!hasScrollSpace()) {
-        Serial.println("Scroll inventory is full! (Max: " + String(MAX_SCROLLS) + ")");
+        LOG_INFO(ENTITY, "Scroll inventory is full! (Max: %d)", MAX_SCROLLS);
         return false;
     }
     
     scrollInventory.push_back(scroll);
-    Serial.println("Added scroll to inventory: " + scroll->getName() + " (" + String(scrollInventory.size()) + "/" + String(MAX_SCROLLS) + ")");
+    LOG_INFO(ENTITY, "Added scroll to inventory: %s (%d/%d)",
+             scroll->getName().c_str(), (int)scrollInventory.size(), MAX_SCROLLS);
     return true;
 }
 
@@ -137,56 +137,43 @@ bool Player::removeScroll(int scrollIndex) {
         return false;
     }
     
-    Spell* scroll = scrollInventory[scrollIndex];
-    String scrollName = scroll->getName();
+    const Spell* scroll = scrollInventory[scrollIndex];
+    FlashString scrollName = scroll->getName();
     
-    delete scroll;
     scrollInventory.erase(scrollInventory.begin() + scrollIndex);
     
-    Serial.println("Removed scroll from inventory: " + scrollName);
+    LOG_INFO(ENTITY, "Removed scroll from inventory: %s", scrollName.c_str());
     return true;
 }
 
 bool Player::learnSpellFromScroll(int scrollIndex) {
     if (scrollIndex < 0 || scrollIndex >= scrollInventory.size()) {
-        Serial.println("Invalid scroll index: " + String(scrollIndex));
+        LOG_INFO(ENTITY, "Invalid scroll index: %d", scrollIndex);
         return false;
     }
     
-    Spell* scroll = scrollInventory[scrollIndex];
+    const Spell* scroll = scrollInventory[scrollIndex];
     
     // Check if player already knows this spell
     if (spellLibrary->hasSpell(scroll->getID())) {
-        Serial.println("Already know spell: " + scroll->getName());
+        LOG_INFO(ENTITY, "Already know spell: %s", scroll->getName().c_str());
         return false;
     }
     
-    // Create a new spell instance for the spell library
-    Spell* spellCopy = SpellFactory::createSpell(scroll->getID());
-    if (!spellCopy) {
-        Serial.println("Failed to create spell copy for: " + scroll->getName());
-        return false;
-    }
-    
-    // Learn the spell
-    if (spellLibrary->learnSpell(spellCopy)) {
-        String spellName = scroll->getName();
-        
+    // Learn the spell (the scroll and the grimoire share the definition)
+    if (spellLibrary->learnSpell(scroll)) {
         // Remove the scroll from inventory (consume it)
-        delete scroll;
         scrollInventory.erase(scrollInventory.begin() + scrollIndex);
         
-        Serial.println("Learned spell from scroll: " + spellName);
+        LOG_INFO(ENTITY, "Learned spell from scroll: %s", scroll->getName().c_str());
         return true;
     } else {
-        // Failed to learn - clean up the copy
-        delete spellCopy;
-        Serial.println("Failed to learn spell from scroll: " + scroll->getName());
+        LOG_INFO(ENTITY, "Failed to learn spell from scroll: %s", scroll->getName().c_str());
         return false;
     }
 }
 
-std::vector<Spell*> Player::getScrollInventory() const {
+std::vector<const Spell*> Player::getScrollInventory() const {
     return scrollInventory;
 }
 
@@ -203,28 +190,24 @@ bool Player::hasScrollSpace() const {
 }
 
 void Player::clearAllScrolls() {
-    for (Spell* scroll : scrollInventory) {
-        delete scroll;
-    }
     scrollInventory.clear();
-    Serial.println("Cleared all scrolls from inventory");
+    LOG_INFO(ENTITY, "Cleared all scrolls from inventory");
 }
 
 void Player::displayScrollInventory() const {
-    Serial.println("=== SCROLL INVENTORY ===");
-    Serial.println("Scrolls: " + String(scrollInventory.size()) + "/" + String(MAX_SCROLLS));
+    LOG_INFO(ENTITY, "=== SCROLL INVENTORY ===");
+    LOG_INFO(ENTITY, "Scrolls: %d/%d", (int)scrollInventory.size(), MAX_SCROLLS);
     
     if (scrollInventory.empty()) {
-        Serial.println("No scrolls in inventory.");
-        Serial.println("Find them in treasure chests or defeat bosses!");
+        LOG_INFO(ENTITY, "No scrolls in inventory.");
+        LOG_INFO(ENTITY, "Find them in treasure chests or defeat bosses!");
         return;
     }
     
     for (int i = 0; i < scrollInventory.size(); i++) {
-        Spell* scroll = scrollInventory[i];
-        Serial.println(String(i + 1) + ". " + scroll->getName() + 
-                      " (" + scroll->getElementName() + 
-                      ") - Power: " + String(scroll->getBasePower()));
+        const Spell* scroll = scrollInventory[i];
+        LOG_INFO(ENTITY, "%d. %s (%s) - Power: %d",
+                 i + 1, scroll->getName().c_str(), scroll->getElementName(), scroll->getBasePower());
     }
 }
 
@@ -320,107 +303,49 @@ SpellLibrary* Player::getSpellLibrary() const {
     return spellLibrary;
 }
 
-bool Player::learnSpell(Spell* spell) {
+bool Player::learnSpell(const Spell* spell) {
     return spellLibrary->learnSpell(spell);
 }
 
-bool Player::castSpell(int spellSlot, Enemy* target, CombatTextBox* textBox) {
-    Serial.println("DEBUG Player::castSpell() - textBox: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
-    return spellLibrary->castSpell(spellSlot, this, target, textBox);
+bool Player::castSpell(int spellSlot, Enemy* target, int* synergyOut) {
+    return spellLibrary->castSpell(spellSlot, this, target, synergyOut);
 }
 
-std::vector<Spell*> Player::getEquippedSpells() const {
+std::vector<const Spell*> Player::getEquippedSpells() const {
     return spellLibrary->getEquippedSpells();
 }
 
-bool Player::hasSpellEquipped() const {
-    return spellLibrary->getEquippedSpellCount() > 0;
-}
-
-// Spell effect management
-void Player::addSpellEffect(SpellEffect effect, int value, int duration, String sourceName) {
-    activeEffects.push_back(ActiveSpellEffect(effect, value, duration, sourceName));
-    Serial.println("Applied spell effect: " + sourceName + " (" + String(duration) + " turns)");
-}
-
-void Player::updateSpellEffects() {
-    // Process and update all active effects
-    for (int i = activeEffects.size() - 1; i >= 0; i--) {
-        ActiveSpellEffect& effect = activeEffects[i];
-        
-        // Apply effect
-        switch (effect.effect) {
-            case EFFECT_DAMAGE_OVER_TIME:
-                takeDamage(effect.value);
-                Serial.println("DoT: " + String(effect.value) + " damage from " + effect.sourceName);
-                break;
-            case EFFECT_HEAL:
-                heal(effect.value);
-                Serial.println("HoT: " + String(effect.value) + " healing from " + effect.sourceName);
-                break;
-            // BUFF/DEBUFF/SHIELD effects are passive and applied in getEffective* methods
-        }
-        
-        // Decrease duration
-        effect.remainingDuration--;
-        
-        // Remove expired effects
-        if (effect.remainingDuration <= 0) {
-            Serial.println("Spell effect expired: " + effect.sourceName);
-            activeEffects.erase(activeEffects.begin() + i);
-        }
-    }
-}
-
-void Player::clearSpellEffects() {
-    activeEffects.clear();
-    Serial.println("All spell effects cleared");
+const Spell* Player::getEquippedSpell(int slot) const {
+    return spellLibrary->getEquippedSpell(slot);
 }
 
-bool Player::hasActiveEffect(SpellEffect effect) const {
-    for (const ActiveSpellEffect& active : activeEffects) {
-        if (active.effect == effect) return true;
-    }
-    return false;
-}
-
-int Player::getActiveEffectValue(SpellEffect effect) const {
-    int totalValue = 0;
-    for (const ActiveSpellEffect& active : activeEffects) {
-        if (active.effect == effect) {
-            totalValue += active.value;
-        }
-    }
-    return totalValue;
-}
-
-std::vector<ActiveSpellEffect> Player::getActiveEffects() const {
-    return activeEffects;
+bool Player::hasSpellEquipped() const {
+    return spellLibrary->getEquippedSpellCount() > 0;
 }
 
 // Combat stats with spell effects
 int Player::getEffectiveAttack() const {
-    int effectiveAtk = attack + getActiveEffectValue(EFFECT_BUFF);
+    int effectiveAtk = attack + activeEffects.total(EFFECT_BUFF);
     // Debuffs reduce attack
-    effectiveAtk -= getActiveEffectValue(EFFECT_DEBUFF) / 2;
+    effectiveAtk -= activeEffects.total(EFFECT_DEBUFF) / 2;
     return max(1, effectiveAtk);
 }
 
 int Player::getEffectiveDefense() const {
-    int effectiveDef = defense + getActiveEffectValue(EFFECT_BUFF);
+    int effectiveDef = defense + activeEffects.total(EFFECT_BUFF);
     int shieldValue = getShieldValue();
     return effectiveDef + shieldValue;
 }
 
 int Player::getEffectiveSpeed() const {
-    int effectiveSpd = speed + getActiveEffectValue(EFFECT_BUFF);
+    int effectiveSpd = speed + activeEffects.total(EFFECT_BUFF);
     // Debuffs reduce speed
-    effectiveSpd -= getActiveEffectValue(EFFECT_DEBUFF) / 3;
+    effectiveSpd -= activeEffects.total(EFFECT_DEBUFF) / 3;
     return max(1, effectiveSpd);
 }
 
 int Player::getShieldValue() const {
-    return getActiveEffectValue(EFFECT_SHIELD);
+    return activeEffects.total(EFFECT_SHIELD);
 }
 
 // Potion management
@@ -436,7 +361,7 @@ bool Player::useHealthPotion() {
     if (healthPotions > 0) {
         healthPotions--;
         heal(POTION_HEAL_AMOUNT);
-        Serial.println("Used health potion! Restored " + String(POTION_HEAL_AMOUNT) + " HP");
+        LOG_INFO(ENTITY, "Used health potion! Restored %d HP", POTION_HEAL_AMOUNT);
         return true;
     }
     return false;
@@ -446,7 +371,7 @@ bool Player::useManaPotion() {
     if (manaPotions > 0) {
         manaPotions--;
         restoreMana(MANA_POTION_RESTORE);
-        Serial.println("Used mana potion! Restored " + String(MANA_POTION_RESTORE) + " mana");
+        LOG_INFO(ENTITY, "Used mana potion! Restored %d mana", MANA_POTION_RESTORE);
         return true;
     }
     return false;
@@ -519,13 +444,12 @@ bool Player::performUseItem() {
         return useManaPotion();
     }
     
-    Serial.println("No usable items available!");
+    LOG_INFO(ENTITY, "No usable items available!");
     return false;
 }
 
-bool Player::performCastSpell(int slot, Enemy* target, CombatTextBox* textBox) {
-    Serial.println("DEBUG Player::performCastSpell() - textBox: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
-    return castSpell(slot, target, textBox);
+bool Player::performCastSpell(int slot, Enemy* target, int* synergyOut) {
+    return castSpell(slot, target, synergyOut);
 }
 // Turn management
 void Player::startTurn() {
@@ -536,11 +460,6 @@ void Player::startTurn() {
     restoreMana(MANA_REGEN_PER_TURN);
 }
 
-void Player::endTurn() {
-    // Called at the end of each combat turn
-    updateSpellEffects(); // Process ongoing spell effects
-}
-
 // Reset methods
 void Player::resetToBaseStats() {
     // Reset equipment bonuses
@@ -559,9 +478,8 @@ void Player::resetToBaseStats() {
     // Reset spell library to TWO starter spells
     delete spellLibrary;
     spellLibrary = new SpellLibrary();
-    auto starterSpells = SpellFactory::createStarterSpells();
-    for (int i = 0; i < starterSpells.size(); i++) {
-        Spell* spell = starterSpells[i];
+    for (int i = 0; i < STARTER_SPELL_COUNT; i++) {
+        const Spell* spell = SpellFactory::getStarterSpell(i);
         spellLibrary->learnSpell(spell);
         spellLibrary->equipSpell(spell->getID(), i); // Equip to slot 0 and 1
     }
@@ -571,7 +489,7 @@ void Player::resetToBaseStats() {
     
     updateStatsFromEquipment();
     
-    Serial.println("Player stats reset to base wizard values (including both starting spells)");
+    LOG_INFO(ENTITY, "Player stats reset to base wizard values (including both starting spells)");
 }
 
 void Player::resetMana() {
@@ -594,31 +512,31 @@ int Player::getEquipmentMana() const { return equipmentMana; }
 
 // Display helpers
 void Player::displaySpellStatus() const {
-    Serial.println("=== WIZARD STATUS ===");
-    Serial.println("HP: " + String(currentHP) + "/" + String(maxHP));
-    Serial.println("Mana: " + String(currentMana) + "/" + String(maxMana));
-    Serial.println("Gold: " + String(gold));
-    Serial.println("Health Potions: " + String(healthPotions));
-    Serial.println("Mana Potions: " + String(manaPotions));
-    Serial.println("Scrolls: " + String(scrollInventory.size()) + "/" + String(MAX_SCROLLS));
-    
-    Serial.println("\n=== EQUIPPED SPELLS ===");
+    LOG_INFO(ENTITY, "=== WIZARD STATUS ===");
+    LOG_INFO(ENTITY, "HP: %d/%d", currentHP, maxHP);
+    LOG_INFO(ENTITY, "Mana: %d/%d", currentMana, maxMana);
+    LOG_INFO(ENTITY, "Gold: %d", gold);
+    LOG_INFO(ENTITY, "Health Potions: %d", healthPotions);
+    LOG_INFO(ENTITY, "Mana Potions: %d", manaPotions);
+    LOG_INFO(ENTITY, "Scrolls: %d/%d", (int)scrollInventory.size(), MAX_SCROLLS);
+    
+    LOG_INFO(ENTITY, "=== EQUIPPED SPELLS ===");
     spellLibrary->displayEquippedSpells();
     
     if (!activeEffects.empty()) {
-        Serial.println("\n=== ACTIVE EFFECTS ===");
+        LOG_INFO(ENTITY, "=== ACTIVE EFFECTS ===");
         displayActiveEffects();
     }
     
     if (!scrollInventory.empty()) {
-        Serial.println();
         displayScrollInventory();
     }
 }
 
 void Player::displayActiveEffects() const {
-    for (const ActiveSpellEffect& effect : activeEffects) {
-        String effectName = "";
+    for (int i = 0; i < activeEffects.size(); i++) {
+        ActiveSpellEffect effect = activeEffects[i];
+        const char* effectName = "";
         switch (effect.effect) {
             case EFFECT_SHIELD: effectName = "Shield"; break;
             case EFFECT_BUFF: effectName = "Buff"; break;
@@ -628,7 +546,7 @@ void Player::displayActiveEffects() const {
             default: effectName = "Unknown"; break;
         }
         
-        Serial.println(effect.sourceName + " (" + effectName + "): " + 
-                      String(effect.value) + " for " + String(effect.remainingDuration) + " turns");
+        LOG_INFO(ENTITY, "%s (%s): %d for %d turns",
+                 effect.sourceName.c_str(), effectName, effect.value, effect.remainingDuration);
     }
-}
\ No newline at end of file
+}
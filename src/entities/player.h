@@ -10,7 +10,6 @@
 class Spell;
 class SpellLibrary;
 class Enemy;
-class CombatTextBox;  // NEW: Forward declaration for text box
 
 // Updated PlayerAction enum for spell casting
 enum PlayerAction {
@@ -21,17 +20,6 @@ enum PlayerAction {
     ACTION_DEFEND = 4         // Magical defense
 };
 
-// Spell effect structure for temporary effects
-struct ActiveSpellEffect {
-    SpellEffect effect;
-    int value;
-    int remainingDuration;
-    String sourceName;
-    
-    ActiveSpellEffect(SpellEffect e, int v, int d, String name = "") 
-        : effect(e), value(v), remainingDuration(d), sourceName(name) {}
-};
-
 class Player : public Entity {
 private:
     // Base wizard stats (without equipment/spells)
@@ -56,12 +44,9 @@ private:
     SpellLibrary* spellLibrary;
     
     // Scroll inventory system
-    std::vector<Spell*> scrollInventory;
+    std::vector<const Spell*> scrollInventory;  // Points into the spell table
     static const int MAX_SCROLLS = 20;  // Maximum scrolls player can carry
     
-    // Active spell effects (buffs/debuffs)
-    std::vector<ActiveSpellEffect> activeEffects;
-    
     // Simple inventory (potions only now)
     int healthPotions;
     int manaPotions;
@@ -72,8 +57,8 @@ private:
 public:
     // Constructors
     Player();
-    Player(String playerName);
-    Player(String playerName, int hp, int atk, int def, int spd, int mana);
+    Player(FlashString playerName);
+    Player(FlashString playerName, int hp, int atk, int def, int spd, int mana);
     
     // Equipment system (magical items)
     void addEquipmentBonus(int hpBonus, int atkBonus, int defBonus, int spdBonus, int manaBonus = 0);
@@ -104,29 +89,22 @@ public:
     
     // Spell system
     SpellLibrary* getSpellLibrary() const;
-    bool learnSpell(Spell* spell);
-    bool castSpell(int spellSlot, Enemy* target, CombatTextBox* textBox = nullptr);  // UPDATED: Now takes text box parameter
-    std::vector<Spell*> getEquippedSpells() const;
+    bool learnSpell(const Spell* spell);
+    bool castSpell(int spellSlot, Enemy* target, int* synergyOut = nullptr);  // synergyOut: bonus applied
+    std::vector<const Spell*> getEquippedSpells() const;
+    const Spell* getEquippedSpell(int slot) const;  // nullptr for an empty slot; no copy
     bool hasSpellEquipped() const;
     
     // Scroll inventory management
-    bool addScroll(Spell* scroll);              // Add scroll to inventory
+    bool addScroll(const Spell* scroll);             // Add scroll to inventory
     bool removeScroll(int scrollIndex);         // Remove scroll by index
     bool learnSpellFromScroll(int scrollIndex); // Learn spell and consume scroll
-    std::vector<Spell*> getScrollInventory() const;  // Get all scrolls
+    std::vector<const Spell*> getScrollInventory() const;  // Get all scrolls
     int getScrollCount() const;                 // Get number of scrolls
     bool hasScrolls() const;                    // Check if player has any scrolls
     bool hasScrollSpace() const;                // Check if can carry more scrolls
     void clearAllScrolls();                     // Clear all scrolls (for game reset)
     
-    // Spell effect management
-    void addSpellEffect(SpellEffect effect, int value, int duration, String sourceName = "");
-    void updateSpellEffects(); // Called each turn
-    void clearSpellEffects();
-    bool hasActiveEffect(SpellEffect effect) const;
-    int getActiveEffectValue(SpellEffect effect) const;
-    std::vector<ActiveSpellEffect> getActiveEffects() const;
-    
     // Combat stats with spell effects applied
     int getEffectiveAttack() const;    // Base attack + spell buffs
     int getEffectiveDefense() const;   // Base defense + spell shields
@@ -151,11 +129,10 @@ public:
     int performAttack() override;      // Magical melee attack (weak)
     int performDefend() override;      // Magical defense
     bool performUseItem();            // Use potion
-    bool performCastSpell(int slot, Enemy* target, CombatTextBox* textBox = nullptr); // UPDATED: Cast equipped spell with text box
+    bool performCastSpell(int slot, Enemy* target, int* synergyOut = nullptr); // Cast equipped spell
     
     // Turn management
-    void startTurn();  // Called at start of each combat turn
-    void endTurn();    // Called at end of each combat turn
+    void startTurn() override;  // Clears last turn's ward, regenerates mana
     
     // Reset methods
     void resetToBaseStats();
@@ -1,48 +1,116 @@
-// src/game/DoorChoiceState.cpp - Fixed version to prevent multiple redraws
+// src/game/DoorChoiceState.cpp - Door choice screen built from retained widgets
 #include "DoorChoiceState.h"
 #include "../utils/constants.h"
+#include "../debug/Log.h"
 
-DoorChoiceState::DoorChoiceState(Display* disp, Input* inp, DungeonManager* dm) : GameState(disp, inp) {
+// Layout: Two doors side by side (no library)
+#define DOOR_WIDTH 70
+#define DOOR_HEIGHT 100
+#define DOOR_SPACING 20
+#define DOOR_Y 60
+#define DOOR_DESC_CHARS 10   // More chars per line with wider doors
+#define DOOR_DESC_LINE_HEIGHT 12
+#define FLOOR_PROGRESS_Y 250  // Bottom of screen, above controls
+
+DoorChoiceState::DoorView::DoorView()
+    : frame(0, 0, DOOR_WIDTH, DOOR_HEIGHT),
+      icon(0, 0, "", TFT_WHITE, 2) {
+    // Door border (always white - no selection highlighting)
+    frame.setFilled(true);
+    frame.setBorder(TFT_WHITE);
+    frame.add(&label);
+    frame.add(&icon);
+    for (int i = 0; i < 3; i++) {
+        frame.add(&desc[i]);
+    }
+}
+
+void DoorChoiceState::DoorView::place(int x, int y) {
+    frame.moveTo(x, y);
+    label.moveTo(x + 10, y + 8);
+    icon.moveTo(x + 10, y + 25);
+    for (int i = 0; i < 3; i++) {
+        desc[i].moveTo(x + 2, y + 55 + i * DOOR_DESC_LINE_HEIGHT);
+    }
+}
+
+void DoorChoiceState::DoorView::setContent(FlashString iconText, FlashString description) {
+    icon.setText(iconText);
+    
+    // Break description into lines (three fit above the bottom of the door)
+    int length = description.length();
+    for (int i = 0; i < 3; i++) {
+        int from = i * DOOR_DESC_CHARS;
+        WidgetText line;
+        if (from < length) line.append(description.c_str() + from, DOOR_DESC_CHARS);
+        desc[i].setText(line);
+    }
+}
+
+DoorChoiceState::DoorChoiceState(Display* disp, Input* inp, DungeonManager* dm)
+    : GameState(disp, inp),
+      screen(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      headerTop(22, 15, "Choose Your", TFT_WHITE, 2),
+      headerBottom(60, 35, "Path", TFT_WHITE, 2),
+      cursor("^", TFT_WHITE, 2),
+      floorLabel(10, FLOOR_PROGRESS_Y),
+      roomLabel(10, FLOOR_PROGRESS_Y + 12),
+      progressBar(10, FLOOR_PROGRESS_Y + 24, 150, 6) {
     dungeonManager = dm;
     selectedOption = 0;
     maxOptions = 2;  // Only left door and right door
-    screenDrawn = false;
-    lastSelectedOption = -1;
     needsFullRedraw = true;
+    
+    int leftDoorX = (SCREEN_WIDTH / 2) - DOOR_WIDTH - (DOOR_SPACING / 2);
+    int rightDoorX = (SCREEN_WIDTH / 2) + (DOOR_SPACING / 2);
+    doors[0].place(leftDoorX, DOOR_Y);
+    doors[0].label.setText("LEFT");
+    doors[1].place(rightDoorX, DOOR_Y);
+    doors[1].label.setText("RIGHT");
+    
+    // Cursor centered below each door
+    int cursorY = DOOR_Y + DOOR_HEIGHT + 8;
+    cursor.setStop(0, leftDoorX + (DOOR_WIDTH / 2) - 6, cursorY);
+    cursor.setStop(1, rightDoorX + (DOOR_WIDTH / 2) - 6, cursorY);
+    
+    screen.add(&headerTop);
+    screen.add(&headerBottom);
+    screen.add(&doors[0].frame);
+    screen.add(&doors[1].frame);
+    screen.add(&cursor);
+    screen.add(&floorLabel);
+    screen.add(&roomLabel);
+    screen.add(&progressBar);
 }
 
 void DoorChoiceState::enter() {
-    Serial.println("Entering Door Choice State");
+    LOG_INFO(GAME, "Entering Door Choice State");
     selectedOption = 0;
-    screenDrawn = false;
-    lastSelectedOption = -1;
-    needsFullRedraw = true;
     
     generateDoorChoices();
-    drawFullScreen();
+    updateDoors();
+    updateFloorProgress();
+    cursor.select(selectedOption);
     
-    // FIXED: Set flags to prevent immediate redraw in update()
+    // Takes over from the previous widget screen without a full clear
+    screen.show(display);
     needsFullRedraw = false;
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
 }
 
 void DoorChoiceState::update() {
     handleInput();
     
-    // FIXED: Only update if selection actually changed and we're not doing a full redraw
+    cursor.select(selectedOption);
     if (needsFullRedraw) {
-        drawFullScreen();
+        screen.show(display);
         needsFullRedraw = false;
-        screenDrawn = true;
-        lastSelectedOption = selectedOption;
-    } else if (lastSelectedOption != selectedOption) {
-        updateDoorSelection();
+    } else {
+        screen.render(display);  // Only the cursor moves here
     }
 }
 
 void DoorChoiceState::exit() {
-    Serial.println("Exiting Door Choice State");
+    LOG_INFO(GAME, "Exiting Door Choice State");
 }
 
 void DoorChoiceState::generateDoorChoices() {
@@ -63,187 +131,38 @@ void DoorChoiceState::generateDoorChoices() {
     }
 }
 
-void DoorChoiceState::drawFullScreen() {
-    display->clear();
-    
-    // Draw static elements
-    drawHeader();
-    drawDoors();
-    drawFloorProgress();
-    drawControls();
-    
-    // Draw initial cursors
-    drawDoorCursors();
-}
-
-void DoorChoiceState::drawHeader() {
-    // Header
-    display->drawText("Choose Your", 22, 15, TFT_WHITE, 2);
-    display->drawText("Path", 60, 35, TFT_WHITE, 2);
+void DoorChoiceState::updateDoors() {
+    doors[0].setContent(leftDoorIcon, leftDoorDesc);
+    doors[1].setContent(rightDoorIcon, rightDoorDesc);
 }
 
-void DoorChoiceState::drawDoors() {
-    // Layout: Two doors side by side (no library)
-    int doorWidth = 70;
-    int doorHeight = 100;
-    int doorSpacing = 20;
-    int leftDoorX = (170/2) - doorWidth - (doorSpacing/2);
-    int rightDoorX = (170/2) + (doorSpacing/2);
-    int doorY = 60;
-    
-    // Store door positions for cursor drawing
-    this->leftDoorX = leftDoorX;
-    this->rightDoorX = rightDoorX;
-    this->doorY = doorY;
-    this->doorWidth = doorWidth;
-    this->doorHeight = doorHeight;
-    
-    // Draw doors (without selection highlighting)
-    drawDoorContent(0, leftDoorX, doorY, doorWidth, doorHeight);
-    drawDoorContent(1, rightDoorX, doorY, doorWidth, doorHeight);
-}
-
-void DoorChoiceState::drawDoorContent(int doorIndex, int x, int y, int width, int height) {
-    // Door border (always white - no selection highlighting)
-    display->drawRect(x, y, width, height, TFT_WHITE);
-    display->fillRect(x+1, y+1, width-2, height-2, TFT_BLACK);
-    
-    // Door label
-    String doorLabel = (doorIndex == 0) ? "LEFT" : "RIGHT";
-    display->drawText(doorLabel.c_str(), x + 10, y + 8, TFT_WHITE);
-    
-    // Icon
-    String icon = (doorIndex == 0) ? leftDoorIcon : rightDoorIcon;
-    display->drawText(icon.c_str(), x + 10, y + 25, TFT_WHITE, 2);
-    
-    // Description (more space now with taller doors)
-    String desc = (doorIndex == 0) ? leftDoorDesc : rightDoorDesc;
-    
-    // Break into multiple lines
-    int startY = y + 55;
-    int lineHeight = 12;
-    int maxChars = 10; // More chars per line with wider doors
-    
-    String currentLine = "";
-    int currentY = startY;
-    
-    for (int i = 0; i < desc.length(); i++) {
-        currentLine += desc.charAt(i);
-        
-        if (currentLine.length() >= maxChars || i == desc.length() - 1) {
-            display->drawText(currentLine.c_str(), x + 2, currentY, TFT_WHITE, 1);
-            currentY += lineHeight;
-            currentLine = "";
-            
-            if (currentY > y + height - 15) break; // Don't overflow door
-        }
-    }
-}
-
-void DoorChoiceState::drawDoorCursors() {
-    // Draw cursor for selected door
-    if (selectedOption == 0) {
-        drawLeftDoorCursor();
-    } else if (selectedOption == 1) {
-        drawRightDoorCursor();
-    }
-}
-
-void DoorChoiceState::drawLeftDoorCursor() {
-    int cursorY = doorY + doorHeight + 8; // Below the door
-    int cursorX = leftDoorX + (doorWidth / 2) - 6; // Centered under door
-    display->drawText("^", cursorX, cursorY, TFT_WHITE, 2);
-}
-
-void DoorChoiceState::drawRightDoorCursor() {
-    int cursorY = doorY + doorHeight + 8; // Below the door
-    int cursorX = rightDoorX + (doorWidth / 2) - 6; // Centered under door
-    display->drawText("^", cursorX, cursorY, TFT_WHITE, 2);
-}
-
-void DoorChoiceState::clearLeftDoorCursor() {
-    int cursorY = doorY + doorHeight + 8;
-    int cursorX = leftDoorX + (doorWidth / 2) - 6;
-    // Clear cursor area underneath door
-    display->fillRect(cursorX, cursorY, 12, 16, TFT_BLACK);
-}
-
-void DoorChoiceState::clearRightDoorCursor() {
-    int cursorY = doorY + doorHeight + 8;
-    int cursorX = rightDoorX + (doorWidth / 2) - 6;
-    // Clear cursor area underneath door
-    display->fillRect(cursorX, cursorY, 12, 16, TFT_BLACK);
-}
-
-void DoorChoiceState::updateDoorSelection() {
-    // Clear old cursor
-    if (lastSelectedOption == 0) {
-        clearLeftDoorCursor();
-    } else if (lastSelectedOption == 1) {
-        clearRightDoorCursor();
-    }
+void DoorChoiceState::updateFloorProgress() {
+    Floor* currentFloor = dungeonManager->getCurrentFloor();
+    floorLabel.setVisible(currentFloor != nullptr);
+    roomLabel.setVisible(currentFloor != nullptr);
+    progressBar.setVisible(currentFloor != nullptr);
+    if (!currentFloor) return;
     
-    // Draw new cursor
-    if (selectedOption == 0) {
-        drawLeftDoorCursor();
-    } else if (selectedOption == 1) {
-        drawRightDoorCursor();
-    }
+    // Floor number
+    floorLabel.setText(WidgetText::format("Floor %d", dungeonManager->getCurrentFloorNumber()));
     
-    lastSelectedOption = selectedOption;
-}
-
-void DoorChoiceState::drawFloorProgress() {
-    Floor* currentFloor = dungeonManager->getCurrentFloor();
-    if (currentFloor) {
-        // Position at bottom of screen, above controls
-        int progressY = 250;
-        
-        // Floor number
-        String floorText = "Floor " + String(dungeonManager->getCurrentFloorNumber());
-        display->drawText(floorText.c_str(), 10, progressY, TFT_WHITE, 1);
-        
-        // Room progress - START FROM 0
-        int roomsCompleted = currentFloor->getRoomsCompleted();
-        String roomText;
-        
-        if (currentFloor->isFloorComplete()) {
-            roomText = "Boss Room Available!";
-            display->drawText(roomText.c_str(), 10, progressY + 12, TFT_RED, 1);
-        } else {
-            // Show current room number starting from 0
-            roomText = "Room " + String(roomsCompleted) + "/" + String(ROOMS_PER_FLOOR);
-            display->drawText(roomText.c_str(), 10, progressY + 12, TFT_WHITE, 1);
-        }
-        
-        // Progress bar now shows correct progress
-        drawProgressBar(10, progressY + 24, 150, 6, roomsCompleted, ROOMS_PER_FLOOR);
+    // Room progress - START FROM 0
+    int roomsCompleted = currentFloor->getRoomsCompleted();
+    if (currentFloor->isFloorComplete()) {
+        roomLabel.set("Boss Room Available!", TFT_RED);
+    } else {
+        roomLabel.set(WidgetText::format("Room %d/%d", roomsCompleted, ROOMS_PER_FLOOR), TFT_WHITE);
     }
-}
-
-void DoorChoiceState::drawProgressBar(int x, int y, int width, int height, int current, int max) {
-    // Draw progress bar background
-    display->drawRect(x, y, width, height, TFT_WHITE);
     
-    // Draw progress fill
-    if (current > 0 && max > 0) {
-        int fillWidth = (width * current) / max;
-        uint16_t fillColor = TFT_GREEN;
-        
-        // Change color based on progress
-        if (current >= max) {
-            fillColor = TFT_RED; // Boss ready
-        } else if (current >= max * 0.7) {
-            fillColor = TFT_WHITE; // Getting close
-        }
-        
-        display->fillRect(x + 1, y + 1, fillWidth - 2, height - 2, fillColor);
+    // Change color based on progress
+    uint16_t fillColor = TFT_GREEN;
+    if (roomsCompleted >= ROOMS_PER_FLOOR) {
+        fillColor = TFT_RED; // Boss ready
+    } else if (roomsCompleted >= ROOMS_PER_FLOOR * 0.7) {
+        fillColor = TFT_WHITE; // Getting close
     }
-}
-
-void DoorChoiceState::drawControls() {
-    int controlY = 280;
-
+    progressBar.setFillColor(fillColor);
+    progressBar.setValue(roomsCompleted, ROOMS_PER_FLOOR);
 }
 
 void DoorChoiceState::handleInput() {
@@ -268,63 +187,65 @@ void DoorChoiceState::handleInput() {
             // Left door
             Room* selectedRoom = dungeonManager->selectRoom(0);
             if (selectedRoom) {
-                Serial.println("Selected LEFT door - " + selectedRoom->getRoomName() + " (Type: " + String(selectedRoom->getType()) + ")");
+                LOG_INFO(GAME, "Selected LEFT door - %s (Type: %d)",
+                         selectedRoom->getRoomName().c_str(), selectedRoom->getType());
                 
                 switch (selectedRoom->getType()) {
                     case ROOM_ENEMY:
-                        Serial.println("-> Going to Combat (Enemy Room)");
+                        LOG_INFO(GAME, "-> Going to Combat (Enemy Room)");
                         requestStateChange(StateTransition::COMBAT);
                         break;
                     case ROOM_BOSS:
-                        Serial.println("-> Going to Combat (Boss Room)");
+                        LOG_INFO(GAME, "-> Going to Combat (Boss Room)");
                         requestStateChange(StateTransition::COMBAT);
                         break;
                     case ROOM_SHOP:
-                        Serial.println("-> Going to Library (Shop Room converted to Library)");
+                        LOG_INFO(GAME, "-> Going to Library (Shop Room converted to Library)");
                         requestStateChange(StateTransition::LIBRARY);
                         break;
                     case ROOM_TREASURE:
-                        Serial.println("-> Going to Treasure Room");
+                        LOG_INFO(GAME, "-> Going to Treasure Room");
                         requestStateChange(StateTransition::TREASURE);
                         break;
                     default:
-                        Serial.println("-> Unknown room type, going to main menu");
+                        LOG_INFO(GAME, "-> Unknown room type, going to main menu");
                         requestStateChange(StateTransition::MAIN_MENU);
                         break;
                 }
             } else {
-                Serial.println("ERROR: Failed to select left door room");
+                LOG_ERROR(GAME, "Failed to select left door room");
             }
         } else if (selectedOption == 1 && availableChoices.size() > 1) {
             // Right door (only if available)
             Room* selectedRoom = dungeonManager->selectRoom(1);
             if (selectedRoom) {
-                Serial.println("Selected RIGHT door - " + selectedRoom->getRoomName() + " (Type: " + String(selectedRoom->getType()) + ")");
+                LOG_INFO(GAME, "Selected RIGHT door - %s (Type: %d)",
+                         selectedRoom->getRoomName().c_str(), selectedRoom->getType());
                 
                 switch (selectedRoom->getType()) {
                     case ROOM_ENEMY:
-                        Serial.println("-> Going to Combat (Enemy Room)");
+                        LOG_INFO(GAME, "-> Going to Combat (Enemy Room)");
                         requestStateChange(StateTransition::COMBAT);
                         break;
                     case ROOM_BOSS:
-                        Serial.println("-> Going to Combat (Boss Room)");
+                        LOG_INFO(GAME, "-> Going to Combat (Boss Room)");
                         requestStateChange(StateTransition::COMBAT);
                         break;
                     case ROOM_SHOP:
-                        Serial.println("-> Going to Library (Shop Room converted to Library)");
+                        LOG_INFO(GAME, "-> Going to Library (Shop Room converted to Library)");
                         requestStateChange(StateTransition::LIBRARY);
                         break;
                     case ROOM_TREASURE:
-                        Serial.println("-> Going to Treasure Room");
+                        LOG_INFO(GAME, "-> Going to Treasure Room");
                         requestStateChange(StateTransition::TREASURE);
                         break;
                     default:
-                        Serial.println("-> Unknown room type, going to main menu");
+                        LOG_INFO(GAME, "-> Unknown room type, going to main menu");
                         requestStateChange(StateTransition::MAIN_MENU);
                         break;
                 }
             } else {
-                Serial.println("ERROR: Failed to select right door room");
+                LOG_ERROR(GAME, "Failed to select right door room");
             }
         }
     }
@@ -335,7 +256,7 @@ void DoorChoiceState::handleInput() {
     }
 }
 
-String DoorChoiceState::getDoorIconText(DoorIcon icon) {
+FlashString DoorChoiceState::getDoorIconText(DoorIcon icon) {
     switch(icon) {
         case ICON_SWORD: return "<=|-";
         case ICON_QUESTION: return "???";
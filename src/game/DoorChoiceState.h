@@ -1,9 +1,10 @@
-// src/game/DoorChoiceState.h - Updated header with partial update methods
+// src/game/DoorChoiceState.h - Door choice screen built from retained widgets
 #ifndef DOOR_CHOICE_STATE_H
 #define DOOR_CHOICE_STATE_H
 
 #include "GameState.h"
 #include "../dungeon/DungeonManager.h"
+#include "../ui/Widgets.h"
 
 class DoorChoiceState : public GameState {
 private:
@@ -13,39 +14,42 @@ private:
     std::vector<DoorChoice> availableChoices;
     int selectedOption;  // 0=left door, 1=right door (no library option)
     int maxOptions;      // Will be 2 (left, right only)
-    bool screenDrawn;
-    int lastSelectedOption;
     bool needsFullRedraw;  // NEW: Flag for full screen redraw
     
     // Door content
-    String leftDoorIcon, rightDoorIcon;
-    String leftDoorDesc, rightDoorDesc;
-    
-    // Door layout (stored for cursor positioning)
-    int leftDoorX, rightDoorX, doorY, doorWidth, doorHeight;
-    
-    // Full screen drawing methods
-    void drawFullScreen();
-    void drawHeader();
-    void drawDoors();
-    void drawFloorProgress();
-    void drawControls();
-    
-    // Door drawing helper
-    void drawDoorContent(int doorIndex, int x, int y, int width, int height);
-    
-    // NEW: Partial update drawing methods
-    void drawDoorCursors();
-    void drawLeftDoorCursor();
-    void drawRightDoorCursor();
-    void clearLeftDoorCursor();
-    void clearRightDoorCursor();
-    void updateDoorSelection();
+    FlashString leftDoorIcon, rightDoorIcon;
+    FlashString leftDoorDesc, rightDoorDesc;
+    
+    // NEW: Widgets for one door: bordered box with label, icon and up to
+    // three lines of description
+    struct DoorView {
+        Panel frame;
+        Label label;
+        Label icon;
+        Label desc[3];
+        
+        DoorView();
+        void place(int x, int y);
+        void setContent(FlashString iconText, FlashString description);
+    };
+    
+    // NEW: Retained screen - built once, update() only changes widget state
+    Panel screen;
+    Label headerTop;
+    Label headerBottom;
+    DoorView doors[2];
+    Cursor cursor;
+    Label floorLabel;
+    Label roomLabel;
+    ProgressBar progressBar;
+    
+    // Widget updates
+    void updateDoors();
+    void updateFloorProgress();
     
     // Helper methods
     void generateDoorChoices();
-    void drawProgressBar(int x, int y, int width, int height, int current, int max);
-    String getDoorIconText(DoorIcon icon);
+    FlashString getDoorIconText(DoorIcon icon);
     
 public:
     DoorChoiceState(Display* disp, Input* inp, DungeonManager* dm);
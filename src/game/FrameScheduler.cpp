@@ -0,0 +1,117 @@
+#include "FrameScheduler.h"
+#include "../utils/constants.h"
+#include "../debug/FrameProfiler.h"
+#include "../debug/Log.h"
+#include "../input/InputRecording.h"
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+
+static const int wakePins[] = {BUTTON_UP, BUTTON_DOWN, BUTTON_A, BUTTON_B};
+
+FrameScheduler::FrameScheduler(Display* disp, Input* inp) {
+    display = disp;
+    input = inp;
+    framePeriodUs = FRAME_PERIOD_MS * 1000UL;
+    idleTickMs = FRAME_IDLE_TICK_MS;
+    idleAfterMs = FRAME_IDLE_AFTER_MS;
+    lightSleep = FRAME_LIGHT_SLEEP;
+
+    frameStartUs = 0;
+    lastActiveMs = 0;
+    idle = false;
+
+    windowStartUs = 0;
+    windowFrames = 0;
+    windowSleptUs = 0;
+    fpsTenths = 0;
+    idlePercent = 0;
+}
+
+void FrameScheduler::init() {
+    lastActiveMs = millis();
+    windowStartUs = micros();
+}
+
+void FrameScheduler::beginFrame() {
+    frameStartUs = micros();
+}
+
+void FrameScheduler::endFrame() {
+    // A full-speed replay runs frames back to back, idle or not
+    if (InputRecording::isFullSpeed()) {
+        idle = false;
+        updateStats(0);
+        return;
+    }
+
+    unsigned long now = millis();
+    if (display->getBytesFlushedLastFrame() > 0 || input->anyHeld()) {
+        lastActiveMs = now;
+    }
+
+    // A transfer still on the bus keeps us in normal frames until it lands
+    idle = (now - lastActiveMs >= idleAfterMs) && !display->isPresenting();
+
+    unsigned long sleepStart = micros();
+    if (idle) {
+        sleepUntilWake(idleTickMs);
+    } else {
+        unsigned long elapsed = sleepStart - frameStartUs;
+        if (elapsed < framePeriodUs) {
+            waitFor(framePeriodUs - elapsed);
+        }
+    }
+    updateStats(micros() - sleepStart);
+}
+
+void FrameScheduler::waitFor(unsigned long us) {
+    // delay() yields to the RTOS; whole milliseconds only, so a frame ends
+    // up to 1 ms short rather than busy-waiting the remainder
+    display->serviceDelay(us / 1000);
+}
+
+void FrameScheduler::sleepUntilWake(unsigned long ms) {
+    if (!lightSleep) {
+        delay(ms);  // Long tick
+        return;
+    }
+
+    // The UART stops in light sleep; don't leave log lines half sent
+    Log::flush();
+
+    // The wakeup level trigger replaces the buttons' edge interrupts while
+    // we sleep. Buttons are active low (INPUT_PULLUP), so any press wakes us.
+    input->suspendInterrupts();
+    for (int pin : wakePins) {
+        gpio_wakeup_enable((gpio_num_t)pin, GPIO_INTR_LOW_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+
+    esp_light_sleep_start();
+
+    for (int pin : wakePins) {
+        gpio_wakeup_disable((gpio_num_t)pin);
+    }
+    input->resumeInterrupts();
+}
+
+void FrameScheduler::updateStats(unsigned long sleptUs) {
+    windowFrames++;
+    windowSleptUs += sleptUs;
+
+    unsigned long windowUs = micros() - windowStartUs;
+    if (windowUs < 1000000UL) return;
+
+    uint64_t fps = (uint64_t)windowFrames * 10000000 / windowUs;
+    uint64_t idleShare = (uint64_t)windowSleptUs * 100 / windowUs;
+    fpsTenths = (uint16_t)(fps < UINT16_MAX ? fps : UINT16_MAX);
+    idlePercent = (uint8_t)(idleShare < 100 ? idleShare : 100);
+#if FRAME_PROFILER
+    FrameProfiler::setLoopStats(fpsTenths, idlePercent);
+#endif
+
+    windowStartUs = micros();
+    windowFrames = 0;
+    windowSleptUs = 0;
+}
@@ -0,0 +1,58 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "../input/Input.h"
+#include "../graphics/Display.h"
+
+// Paces loop(). Each frame gets FRAME_PERIOD_MS in total; the scheduler only
+// sleeps what the frame left of that budget (and nothing after a long
+// frame). Once nothing has been pushed to the panel and no button has been
+// held for FRAME_IDLE_AFTER_MS, frames stretch to FRAME_IDLE_TICK_MS. With
+// FRAME_LIGHT_SLEEP (release builds) that wait happens in light sleep, with
+// any button pulling the chip straight out of it; otherwise it's a delay, so
+// the USB serial console stays up. Achieved FPS and idle time are passed to
+// the FrameProfiler.
+// Full-speed input replays skip the pacing altogether.
+class FrameScheduler {
+private:
+    Display* display;
+    Input* input;
+
+    unsigned long framePeriodUs;
+    unsigned long idleTickMs;
+    unsigned long idleAfterMs;
+    bool lightSleep;
+
+    unsigned long frameStartUs;
+    unsigned long lastActiveMs;
+    bool idle;
+
+    // One-second measurement window
+    unsigned long windowStartUs;
+    unsigned long windowFrames;
+    unsigned long windowSleptUs;
+    uint16_t fpsTenths;
+    uint8_t idlePercent;
+
+    void waitFor(unsigned long us);
+    void sleepUntilWake(unsigned long ms);
+    void updateStats(unsigned long sleptUs);
+
+public:
+    FrameScheduler(Display* disp, Input* inp);
+    void init();
+
+    void setFramePeriodMs(unsigned long ms) { framePeriodUs = ms * 1000; }
+    void setIdleTickMs(unsigned long ms) { idleTickMs = ms; }
+    void setLightSleepEnabled(bool enabled) { lightSleep = enabled; }
+
+    // Bracket each loop(): beginFrame() first, endFrame() after present()
+    void beginFrame();
+    void endFrame();
+
+    bool isIdle() const { return idle; }
+    uint16_t getFpsTenths() const { return fpsTenths; }
+    uint8_t getIdlePercent() const { return idlePercent; }
+};
+
+#endif
@@ -1,7 +1,19 @@
 #include "GameStateManager.h"
 #include "../spells/spell.h"
+#include "../debug/Log.h"
+#include "../debug/Trace.h"
+#include "../debug/AllocTracker.h"
+#include "../utils/Rng.h"
+#include "../input/InputRecording.h"
 
-GameStateManager::GameStateManager(Display* disp, Input* inp) {
+GameStateManager::GameStateManager(Display* disp, Input* inp)
+    : gameOverPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      gameOverTitle(30, 60, "GAME OVER", TFT_RED, 2),
+      gameOverPrompt1(10, 180, "Press any button"),
+      gameOverPrompt2(10, 195, "to return to town"),
+      placeholderPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      placeholderTitle(50, 80, "", TFT_WHITE, 2),
+      placeholderPrompt(10, 0, "Press A to return") {
     display = disp;
     input = inp;
     
@@ -14,14 +26,14 @@ GameStateManager::GameStateManager(Display* disp, Input* inp) {
     availableScrolls.clear();
     
     // ADDED: Give player a starting scroll for testing the library feature
-    Serial.println("DEBUG: Creating starting scroll...");
-    Spell* startingScroll = SpellFactory::createSpell(1); // Fireball scroll
+    LOG_DEBUG(GAME, "Creating starting scroll...");
+    const Spell* startingScroll = SpellFactory::getSpell(1); // Fireball scroll
     if (startingScroll) {
         availableScrolls.push_back(startingScroll);
-        Serial.println("DEBUG: Added starting scroll for testing: " + startingScroll->getName());
-        Serial.println("DEBUG: Total scrolls in GameStateManager: " + String(availableScrolls.size()));
+        LOG_DEBUG(GAME, "Added starting scroll for testing: %s", startingScroll->getName().c_str());
+        LOG_DEBUG(GAME, "Total scrolls in GameStateManager: %d", (int)availableScrolls.size());
     } else {
-        Serial.println("ERROR: Failed to create starting scroll!");
+        LOG_ERROR(GAME, "Failed to create starting scroll!");
     }
     
     // Initialize states with GameStateManager reference
@@ -41,6 +53,28 @@ GameStateManager::GameStateManager(Display* disp, Input* inp) {
     // Start with main menu
     currentState = mainMenuState;
     handlingGameOver = false;
+    
+    // Explain what happens (wizard theme)
+    gameOverLines[0].moveTo(20, 100);
+    gameOverLines[0].setText("Your magic failed");
+    gameOverLines[1].moveTo(20, 115);
+    gameOverLines[1].setText("in the dungeon...");
+    gameOverLines[2].moveTo(15, 140);
+    gameOverLines[2].setText("All progress lost!");
+    gameOverLines[3].moveTo(20, 155);
+    gameOverLines[3].setText("Spells forgotten!");  // CHANGED: Spells instead of equipment
+    gameOverPanel.add(&gameOverTitle);
+    for (int i = 0; i < 4; i++) {
+        gameOverPanel.add(&gameOverLines[i]);
+    }
+    gameOverPanel.add(&gameOverPrompt1);
+    gameOverPanel.add(&gameOverPrompt2);
+    
+    placeholderPanel.add(&placeholderTitle);
+    for (int i = 0; i < 3; i++) {
+        placeholderPanel.add(&placeholderLines[i]);
+    }
+    placeholderPanel.add(&placeholderPrompt);
 }
 
 GameStateManager::~GameStateManager() {
@@ -59,37 +93,41 @@ GameStateManager::~GameStateManager() {
 }
 
 void GameStateManager::initialize() {
-    Serial.println("=== ESP32 Wizard Dungeon Crawler ===");  // CHANGED: Updated title
-    Serial.println("Game State Manager Initialized");
+    LOG_INFO(GAME, "=== ESP32 Wizard Dungeon Crawler ===");  // CHANGED: Updated title
+    LOG_INFO(GAME, "Game State Manager Initialized");
     
     // Check if all states are properly initialized
-    Serial.println("DEBUG: Checking state initialization:");
-    Serial.println("  mainMenuState: " + String(mainMenuState ? "OK" : "NULL"));
-    Serial.println("  doorChoiceState: " + String(doorChoiceState ? "OK" : "NULL"));
-    Serial.println("  combatRoomState: " + String(combatRoomState ? "OK" : "NULL"));
-    Serial.println("  libraryRoomState: " + String(libraryRoomState ? "OK" : "NULL"));  // CHANGED: Library instead of campfire
-    Serial.println("  shopRoomState: " + String(shopRoomState ? "OK" : "NULL"));
-    Serial.println("  treasureRoomState: " + String(treasureRoomState ? "OK" : "NULL"));
+    LOG_DEBUG(GAME, "Checking state initialization:");
+    LOG_INFO(GAME, "  mainMenuState: %s", mainMenuState ? "OK" : "NULL");
+    LOG_INFO(GAME, "  doorChoiceState: %s", doorChoiceState ? "OK" : "NULL");
+    LOG_INFO(GAME, "  combatRoomState: %s", combatRoomState ? "OK" : "NULL");
+    LOG_INFO(GAME, "  libraryRoomState: %s", libraryRoomState ? "OK" : "NULL");  // CHANGED: Library instead of campfire
+    LOG_INFO(GAME, "  shopRoomState: %s", shopRoomState ? "OK" : "NULL");
+    LOG_INFO(GAME, "  treasureRoomState: %s", treasureRoomState ? "OK" : "NULL");
     
     // DEBUG: Check scroll inventory status
-    Serial.println("DEBUG: Initial scroll inventory check:");
-    Serial.println("DEBUG: Available scrolls: " + String(availableScrolls.size()));
-    for (Spell* scroll : availableScrolls) {
+    LOG_DEBUG(GAME, "Initial scroll inventory check:");
+    LOG_DEBUG(GAME, "Available scrolls: %d", (int)availableScrolls.size());
+    for (const Spell* scroll : availableScrolls) {
         if (scroll) {
-            Serial.println("DEBUG: - " + scroll->getName());
+            LOG_DEBUG(GAME, "- %s", scroll->getName().c_str());
         }
     }
     
     // Enter initial state
     if (currentState) {
-        Serial.println("DEBUG: Entering initial state (Main Menu)");
+        LOG_DEBUG(GAME, "Entering initial state (Main Menu)");
+        ALLOC_SET_STATE((int)getCurrentStateId());
         currentState->enter();
     } else {
-        Serial.println("ERROR: currentState is NULL during initialization!");
+        LOG_ERROR(GAME, "currentState is NULL during initialization!");
     }
 }
 
 void GameStateManager::update() {
+    // NEW: Heap use is filed under the state that runs
+    ALLOC_SET_STATE((int)getCurrentStateId());
+
     // Handle game over screen specially
     if (handlingGameOver) {
         handleGameOverScreen();
@@ -103,7 +141,7 @@ void GameStateManager::update() {
     StateTransition nextState = currentState->getNextState();
     if (nextState != StateTransition::NONE) {
         // DEBUG: Log what type of state is requesting the transition
-        String currentStateName = "Unknown";
+        const char* currentStateName = "Unknown";
         if (currentState == mainMenuState) currentStateName = "MainMenu";
         else if (currentState == doorChoiceState) currentStateName = "DoorChoice";
         else if (currentState == combatRoomState) currentStateName = "Combat";
@@ -111,7 +149,7 @@ void GameStateManager::update() {
         else if (currentState == shopRoomState) currentStateName = "Shop";
         else if (currentState == treasureRoomState) currentStateName = "Treasure";
         
-        Serial.println("DEBUG: State transition requested by: " + currentStateName + " -> " + String((int)nextState));
+        LOG_DEBUG(GAME, "State transition requested by: %s -> %d", currentStateName, (int)nextState);
         
         // FIXED: Clear the transition immediately to prevent multiple triggers
         currentState->clearTransition();
@@ -120,12 +158,25 @@ void GameStateManager::update() {
     }
 }
 
+StateTransition GameStateManager::getCurrentStateId() const {
+    if (handlingGameOver) return StateTransition::GAME_OVER;
+    if (currentState == mainMenuState) return StateTransition::MAIN_MENU;
+    if (currentState == doorChoiceState) return StateTransition::DOOR_CHOICE;
+    if (currentState == combatRoomState) return StateTransition::COMBAT;
+    if (currentState == libraryRoomState) return StateTransition::LIBRARY;
+    if (currentState == shopRoomState) return StateTransition::SHOP;
+    if (currentState == treasureRoomState) return StateTransition::TREASURE;
+    return StateTransition::NONE;
+}
+
 void GameStateManager::changeState(StateTransition newState) {
-    Serial.println("DEBUG: Changing to state: " + String((int)newState));
+    TRACE_SCOPE(trace, TRACE_STATE_CHANGE, (int)getCurrentStateId(), (int)newState);
+    LOG_DEBUG(GAME, "Changing to state: %d", (int)newState);
     
     // Handle game over specially - DON'T exit current state yet
     if (newState == StateTransition::GAME_OVER) {
-        Serial.println("DEBUG: Game over triggered - showing game over screen");
+        LOG_DEBUG(GAME, "Game over triggered - showing game over screen");
+        ALLOC_SET_STATE((int)StateTransition::GAME_OVER);
         showGameOverScreen();
         handlingGameOver = true;
         return;
@@ -135,7 +186,7 @@ void GameStateManager::changeState(StateTransition newState) {
     GameState* previousState = currentState;
     
     // Exit current state
-    Serial.println("DEBUG: Exiting current state");
+    LOG_DEBUG(GAME, "Exiting current state");
     if (previousState) {
         previousState->exit();
         // FIXED: Ensure transition is cleared after exit
@@ -145,43 +196,49 @@ void GameStateManager::changeState(StateTransition newState) {
     // Change to new state
     switch (newState) {
         case StateTransition::MAIN_MENU:
-            Serial.println("DEBUG: Switching to Main Menu");
+            LOG_DEBUG(GAME, "Switching to Main Menu");
             currentState = mainMenuState;
             break;
             
         case StateTransition::DOOR_CHOICE:
-            Serial.println("DEBUG: Switching to Door Choice");
+            LOG_DEBUG(GAME, "Switching to Door Choice");
+            if (previousState == mainMenuState) {
+                // NEW: Leaving the menu starts a run; the seed replays it
+                uint32_t runSeed = Rng::startRun();
+                InputRecording::noteRunSeed(runSeed);
+                LOG_INFO(GAME, "Run seed: %lu", (unsigned long)runSeed);
+            }
             currentState = doorChoiceState;
             break;
             
         case StateTransition::COMBAT:
-            Serial.println("DEBUG: Switching to Combat");
+            LOG_DEBUG(GAME, "Switching to Combat");
             currentState = combatRoomState;
             break;
             
         case StateTransition::LIBRARY:  // CHANGED: Library instead of campfire
-            Serial.println("DEBUG: Switching to Library - START");
+            LOG_DEBUG(GAME, "Switching to Library - START");
             if (!libraryRoomState) {
-                Serial.println("ERROR: libraryRoomState is NULL!");
+                LOG_ERROR(GAME, "libraryRoomState is NULL!");
                 currentState = mainMenuState;
                 break;
             }
             // DEBUG: Show scroll count before transfer
-            Serial.println("DEBUG: Available scrolls before transfer: " + String(availableScrolls.size()));
-            for (Spell* scroll : availableScrolls) {
-                if (scroll) Serial.println("DEBUG: - " + scroll->getName());
+            LOG_DEBUG(GAME, "Available scrolls before transfer: %d", (int)availableScrolls.size());
+            for (const Spell* scroll : availableScrolls) {
+                if (scroll) LOG_DEBUG(GAME, "- %s", scroll->getName().c_str());
             }
             
             // Transfer scrolls to library before entering
             transferScrollsToLibrary();
             currentState = libraryRoomState;
-            Serial.println("DEBUG: Switching to Library - ASSIGNED");
+            LOG_DEBUG(GAME, "Switching to Library - ASSIGNED");
             break;
             
         case StateTransition::SHOP:
-            Serial.println("DEBUG: Switching to Shop");
+            LOG_DEBUG(GAME, "Switching to Shop");
             if (!shopRoomState) {
-                Serial.println("ERROR: shopRoomState is NULL!");
+                LOG_ERROR(GAME, "shopRoomState is NULL!");
                 currentState = mainMenuState;
                 break;
             }
@@ -189,9 +246,9 @@ void GameStateManager::changeState(StateTransition newState) {
             break;
             
         case StateTransition::TREASURE:
-            Serial.println("DEBUG: Switching to Treasure Room");
+            LOG_DEBUG(GAME, "Switching to Treasure Room");
             if (!treasureRoomState) {
-                Serial.println("ERROR: treasureRoomState is NULL!");
+                LOG_ERROR(GAME, "treasureRoomState is NULL!");
                 currentState = mainMenuState;
                 break;
             }
@@ -204,7 +261,7 @@ void GameStateManager::changeState(StateTransition newState) {
             return; // Don't change state, just show screen
             
         default:
-            Serial.println("DEBUG: Unknown state transition, going to main menu");
+            LOG_DEBUG(GAME, "Unknown state transition, going to main menu");
             currentState = mainMenuState;
             break;
     }
@@ -212,49 +269,31 @@ void GameStateManager::changeState(StateTransition newState) {
     // FIXED: Ensure new state starts clean
     if (currentState) {
         currentState->clearTransition();
-        Serial.println("DEBUG: About to enter new state");
+        LOG_DEBUG(GAME, "About to enter new state");
+        ALLOC_SET_STATE((int)getCurrentStateId());
         currentState->enter();
-        Serial.println("DEBUG: State change complete");
+        LOG_DEBUG(GAME, "State change complete");
     } else {
-        Serial.println("ERROR: currentState is NULL after assignment!");
+        LOG_ERROR(GAME, "currentState is NULL after assignment!");
     }
 }
 
 void GameStateManager::showGameOverScreen() {
-    Serial.println("DEBUG: Drawing game over screen");
+    LOG_DEBUG(GAME, "Drawing game over screen");
     
-    // Force clear screen and redraw
-    display->clear();
-    delay(50); // Small delay to ensure clear completes
+    gameOverPanel.show(display);
     
-    // Large game over text
-    display->drawText("GAME OVER", 30, 60, TFT_RED, 2);
-    
-    // Explain what happens (wizard theme)
-    display->drawText("Your magic failed", 20, 100, TFT_WHITE);
-    display->drawText("in the dungeon...", 20, 115, TFT_WHITE);
-    
-    display->drawText("All progress lost!", 15, 140, TFT_WHITE);
-    display->drawText("Spells forgotten!", 20, 155, TFT_WHITE);  // CHANGED: Spells instead of equipment
-    
-    // Instructions
-    display->drawText("Press any button", 10, 180, TFT_WHITE);
-    display->drawText("to return to town", 10, 195, TFT_WHITE);
-    
-    Serial.println("DEBUG: Game over screen drawn");
-    Serial.println("=== GAME OVER ===");
-    Serial.println("Wizard died - all progress will be reset");
+    LOG_DEBUG(GAME, "Game over screen drawn");
+    LOG_INFO(GAME, "=== GAME OVER ===");
+    LOG_INFO(GAME, "Wizard died - all progress will be reset");
 }
 
 void GameStateManager::handleGameOverScreen() {
     // Check for any button press
-    bool anyButtonPressed = input->wasPressed(Button::UP) || 
-                           input->wasPressed(Button::DOWN) ||
-                           input->wasPressed(Button::A) || 
-                           input->wasPressed(Button::B);
+    bool anyButtonPressed = input->wasAnyPressed();
     
     if (anyButtonPressed) {
-        Serial.println("DEBUG: Button pressed on game over screen - resetting game");
+        LOG_DEBUG(GAME, "Button pressed on game over screen - resetting game");
         handlingGameOver = false;
         
         // AGGRESSIVE CLEANUP: Clear all possible state transitions
@@ -269,36 +308,39 @@ void GameStateManager::handleGameOverScreen() {
         if (shopRoomState) shopRoomState->clearTransition();
         if (treasureRoomState) treasureRoomState->clearTransition();
         
-        Serial.println("DEBUG: All state transitions cleared");
+        LOG_DEBUG(GAME, "All state transitions cleared");
         
         fullGameReset();  // Reset all progress on death
         currentState = mainMenuState;
         
         // Make sure main menu starts clean
         currentState->clearTransition();
+        ALLOC_SET_STATE((int)StateTransition::MAIN_MENU);
         currentState->enter();
         
-        Serial.println("DEBUG: Game reset complete, returned to main menu");
+        LOG_DEBUG(GAME, "Game reset complete, returned to main menu");
         return;
     }
     
     // Only show "waiting" message occasionally to reduce spam
     static unsigned long lastWaitingMessage = 0;
     if (millis() - lastWaitingMessage > 2000) { // Every 2 seconds instead of 1
-        Serial.println("DEBUG: Waiting for button press on game over screen...");
+        LOG_DEBUG(GAME, "Waiting for button press on game over screen...");
         lastWaitingMessage = millis();
     }
 }
 
 void GameStateManager::handlePlaceholderState(StateTransition state) {
     // Handle simple placeholder screens that return to main menu
-    display->clear();
-    
     switch (state) {
         case StateTransition::SETTINGS:
-            display->drawText("Settings", 50, 80, TFT_WHITE, 2);
-            display->drawText("Coming Soon!", 30, 120, TFT_WHITE);
-            display->drawText("Press A to return", 10, 160, TFT_WHITE);
+            placeholderTitle.setText("Settings");
+            placeholderLines[0].moveTo(30, 120);
+            placeholderLines[0].set("Coming Soon!", TFT_WHITE);
+            placeholderLines[1].setVisible(false);
+            placeholderLines[2].setVisible(false);
+            placeholderPrompt.moveTo(10, 160);
+            placeholderPanel.show(display);
             
             if (input->wasPressed(Button::A)) {
                 currentState = mainMenuState;
@@ -307,11 +349,17 @@ void GameStateManager::handlePlaceholderState(StateTransition state) {
             break;
             
         case StateTransition::CREDITS:
-            display->drawText("Credits", 50, 80, TFT_WHITE, 2);
-            display->drawText("Wizard Dungeon", 20, 120, TFT_WHITE);  // CHANGED: Updated credits
-            display->drawText("Crawler v0.2", 30, 135, TFT_WHITE);
-            display->drawText("Made with ESP32", 20, 150, TFT_GREEN);
-            display->drawText("Press A to return", 10, 180, TFT_WHITE);
+            placeholderTitle.setText("Credits");
+            placeholderLines[0].moveTo(20, 120);
+            placeholderLines[0].set("Wizard Dungeon", TFT_WHITE);  // CHANGED: Updated credits
+            placeholderLines[1].moveTo(30, 135);
+            placeholderLines[1].set("Crawler v0.2", TFT_WHITE);
+            placeholderLines[1].setVisible(true);
+            placeholderLines[2].moveTo(20, 150);
+            placeholderLines[2].set("Made with ESP32", TFT_GREEN);
+            placeholderLines[2].setVisible(true);
+            placeholderPrompt.moveTo(10, 180);
+            placeholderPanel.show(display);
             
             if (input->wasPressed(Button::A)) {
                 currentState = mainMenuState;
@@ -330,17 +378,17 @@ void GameStateManager::resetPlayer() {
     player->restoreAllMana();  // CHANGED: Also restore mana
     player->addHealthPotions(3);
     player->addManaPotions(2);  // CHANGED: Also give mana potions
-    Serial.println("Player health and mana restored");
+    LOG_INFO(GAME, "Player health and mana restored");
 }
 
 void GameStateManager::resetDungeonProgress() {
     // Use the proper reset method instead of recreating
     dungeonManager->resetToFirstFloor();
-    Serial.println("Dungeon progress reset - starting from Floor 1");
+    LOG_INFO(GAME, "Dungeon progress reset - starting from Floor 1");
 }
 
 void GameStateManager::fullGameReset() {
-    Serial.println("DEBUG: Starting full game reset");
+    LOG_DEBUG(GAME, "Starting full game reset");
     
     // Clear all scrolls
     clearAllScrolls();
@@ -355,58 +403,51 @@ void GameStateManager::fullGameReset() {
     // Reset dungeon progress
     resetDungeonProgress();
     
-    Serial.println("DEBUG: Full game reset complete - fresh wizard start!");
+    LOG_DEBUG(GAME, "Full game reset complete - fresh wizard start!");
 }
 
 // NEW: Global scroll inventory system implementation
-void GameStateManager::addScroll(Spell* scroll) {
+void GameStateManager::addScroll(const Spell* scroll) {
     if (scroll) {
         availableScrolls.push_back(scroll);
-        Serial.println("GameStateManager: Added scroll to global inventory: " + scroll->getName());
-        Serial.println("Total scrolls available: " + String(availableScrolls.size()));
+        LOG_INFO(GAME, "GameStateManager: Added scroll to global inventory: %s", scroll->getName().c_str());
+        LOG_INFO(GAME, "Total scrolls available: %d", (int)availableScrolls.size());
     }
 }
 
-std::vector<Spell*> GameStateManager::getAvailableScrolls() {
+std::vector<const Spell*> GameStateManager::getAvailableScrolls() {
     return availableScrolls;
 }
 
 void GameStateManager::removeScroll(int index) {
     if (index >= 0 && index < availableScrolls.size()) {
-        Spell* scroll = availableScrolls[index];
-        Serial.println("GameStateManager: Removing scroll: " + (scroll ? scroll->getName() : "null"));
+        const Spell* scroll = availableScrolls[index];
+        LOG_INFO(GAME, "GameStateManager: Removing scroll: %s", scroll ? scroll->getName().c_str() : "null");
         availableScrolls.erase(availableScrolls.begin() + index);
-        // Don't delete the scroll here - it should be transferred to player's library
     }
 }
 
 void GameStateManager::transferScrollsToLibrary() {
     if (libraryRoomState) {
-        Serial.println("GameStateManager: Transferring " + String(availableScrolls.size()) + " scrolls to library");
+        LOG_INFO(GAME, "GameStateManager: Transferring %d scrolls to library", (int)availableScrolls.size());
         
         // Transfer each scroll to the library
-        for (Spell* scroll : availableScrolls) {
+        for (const Spell* scroll : availableScrolls) {
             if (scroll) {
                 libraryRoomState->addAvailableScroll(scroll);
-                Serial.println("Transferred scroll: " + scroll->getName());
+                LOG_INFO(GAME, "Transferred scroll: %s", scroll->getName().c_str());
             }
         }
         
-        // Clear the global list (scrolls are now owned by library)
+        // Clear the global list (the library has them now)
         availableScrolls.clear();
-        Serial.println("Global scroll inventory cleared after transfer");
+        LOG_INFO(GAME, "Global scroll inventory cleared after transfer");
     } else {
-        Serial.println("GameStateManager: No library state available for scroll transfer");
+        LOG_INFO(GAME, "GameStateManager: No library state available for scroll transfer");
     }
 }
 
 void GameStateManager::clearAllScrolls() {
-    // Clean up all scrolls in global inventory
-    for (Spell* scroll : availableScrolls) {
-        if (scroll) {
-            delete scroll;
-        }
-    }
     availableScrolls.clear();
-    Serial.println("GameStateManager: Cleared all scrolls from global inventory");
+    LOG_INFO(GAME, "GameStateManager: Cleared all scrolls from global inventory");
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "../entities/enemy.h"
 #include "../dungeon/DungeonManager.h"
 #include "../spells/spell.h"  // ADDED: Need this for SpellFactory
+#include "../ui/Widgets.h"
 #include <vector>
 
 // Forward declarations
@@ -32,7 +33,7 @@ private:
     DungeonManager* dungeonManager;
     
     // Global scroll inventory system
-    std::vector<Spell*> availableScrolls;  // NEW: Scrolls found but not yet learned
+    std::vector<const Spell*> availableScrolls;  // NEW: Scrolls found but not yet learned
     
     // State management
     GameState* currentState;
@@ -46,6 +47,14 @@ private:
     // Game over handling
     bool handlingGameOver;  // tracks if we're in game over mode
     
+    // NEW: Game over and placeholder (settings, credits) screens as
+    // retained widgets, so they only erase the previous screen's widgets
+    Panel gameOverPanel;
+    Label gameOverTitle, gameOverLines[4], gameOverPrompt1, gameOverPrompt2;
+    
+    Panel placeholderPanel;
+    Label placeholderTitle, placeholderLines[3], placeholderPrompt;
+    
     // State transition
     void changeState(StateTransition newState);
     void handlePlaceholderState(StateTransition state);
@@ -65,6 +74,9 @@ public:
     void initialize();
     void update();
     
+    // NEW: Which state update() is running (for per-state profiling)
+    StateTransition getCurrentStateId() const;
+    
     // Utility
     void resetPlayer();
     void resetDungeonProgress();
@@ -74,8 +86,8 @@ public:
     DungeonManager* getDungeonManager() const { return dungeonManager; }
     
     // NEW: Global scroll inventory system
-    void addScroll(Spell* scroll);              // Add scroll to global inventory
-    std::vector<Spell*> getAvailableScrolls();  // Get all available scrolls
+    void addScroll(const Spell* scroll);              // Add scroll to global inventory
+    std::vector<const Spell*> getAvailableScrolls();  // Get all available scrolls
     void removeScroll(int index);               // Remove scroll by index
     void transferScrollsToLibrary();            // Transfer scrolls to library state
     bool hasScrolls() const { return !availableScrolls.empty(); }  // ADDED: Check if any scrolls available
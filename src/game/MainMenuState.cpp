@@ -1,5 +1,6 @@
 // src/game/MainMenuState.cpp - Fixed version to prevent multiple state changes
 #include "MainMenuState.h"
+#include "../debug/Log.h"
 
 MainMenuState::MainMenuState(Display* disp, Input* inp) : GameState(disp, inp) {
     mainMenu = new MainMenu(display, input);
@@ -10,7 +11,7 @@ MainMenuState::~MainMenuState() {
 }
 
 void MainMenuState::enter() {
-    Serial.println("DEBUG: Entering Main Menu State - resetting selection");
+    LOG_DEBUG(GAME, "Entering Main Menu State - resetting selection");
     
     // FIXED: Clear any pending transitions immediately
     nextState = StateTransition::NONE;
@@ -19,13 +20,13 @@ void MainMenuState::enter() {
     mainMenu->activate();
     mainMenu->render();
     
-    Serial.println("DEBUG: Main Menu entered - nextState is: " + String((int)nextState));
+    LOG_DEBUG(GAME, "Main Menu entered - nextState is: %d", (int)nextState);
 }
 
 void MainMenuState::update() {
     // FIXED: Don't process input if we already have a pending state transition
     if (nextState != StateTransition::NONE) {
-        Serial.println("DEBUG: MainMenuState::update() - already has pending state transition: " + String((int)nextState));
+        LOG_DEBUG(GAME, "MainMenuState::update() - already has pending state transition: %d", (int)nextState);
         return; // Exit early to prevent multiple selections
     }
     
@@ -38,21 +39,21 @@ void MainMenuState::update() {
     if (result == MenuResult::SELECTED && nextState == StateTransition::NONE) {
         MainMenuOption option = mainMenu->getSelectedOption();
         
-        Serial.println("DEBUG: Main menu option selected: " + String((int)option));
+        LOG_DEBUG(GAME, "Main menu option selected: %d", (int)option);
         
         switch (option) {
             case MainMenuOption::START_GAME:
-                Serial.println("DEBUG: Start Game selected - going to door choice");
+                LOG_DEBUG(GAME, "Start Game selected - going to door choice");
                 requestStateChange(StateTransition::DOOR_CHOICE);
                 break;
                 
             case MainMenuOption::SETTINGS:
-                Serial.println("DEBUG: Settings selected");
+                LOG_DEBUG(GAME, "Settings selected");
                 requestStateChange(StateTransition::SETTINGS);
                 break;
                 
             case MainMenuOption::CREDITS:
-                Serial.println("DEBUG: Credits selected");
+                LOG_DEBUG(GAME, "Credits selected");
                 requestStateChange(StateTransition::CREDITS);
                 break;
         }
@@ -60,6 +61,6 @@ void MainMenuState::update() {
 }
 
 void MainMenuState::exit() {
-    Serial.println("DEBUG: Exiting Main Menu State");
+    LOG_DEBUG(GAME, "Exiting Main Menu State");
     mainMenu->deactivate();
 }
\ No newline at end of file
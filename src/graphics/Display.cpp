@@ -1,22 +1,86 @@
 #include "Display.h"
+#include "../debug/FrameProfiler.h"
+#include "../debug/Log.h"
+#include "../debug/Trace.h"
 
-Display::Display() {
+static int rectArea(const DirtyRect& r) {
+    return r.w * r.h;
+}
+
+static DirtyRect rectUnion(const DirtyRect& a, const DirtyRect& b) {
+    int left = min(a.x, b.x);
+    int top = min(a.y, b.y);
+    int right = max(a.x + a.w, b.x + b.w);
+    int bottom = max(a.y + a.h, b.y + b.h);
+    return {left, top, right - left, bottom - top};
+}
+
+Display::Display() : frame(&tft) {
     // TFT_eSPI constructor handles initialization
+    frameReady = false;
+    dirtyCount = 0;
+    bytesFlushedLastFrame = 0;
+    totalBytesFlushed = 0;
+    clearCount = 0;
+    textRunsEnabled = true;
+
+    asyncPresent = false;
+    presentActive = false;
+    stripBuffers[0] = stripBuffers[1] = nullptr;
+    stripReady[0] = stripReady[1] = false;
+    nextStrip = 0;
+    jobCount = 0;
+    jobRect = 0;
+    jobRow = 0;
 }
 
 void Display::init() {
     // Initialize backlight (INVERTED - LOW = ON!)
     pinMode(TFT_BL, OUTPUT);
     setBacklight(true);
-    
+
     // Initialize display
     tft.init();
     tft.setRotation(2);
+    tft.setSwapBytes(false);  // Back buffer is already in panel byte order
+
+    // NEW: Capture the font for the text-run renderer
+    if (!glyphs.init(&tft)) {
+        LOG_INFO(GFX, "Display: glyph cache unavailable, using TFT_eSPI text");
+    }
+
+    // NEW: Allocate the back buffer (TFT_eSprite uses PSRAM when present)
+    frame.setColorDepth(16);
+    frameReady = frame.createSprite(WIDTH, HEIGHT) != nullptr;
+    if (!frameReady) {
+        LOG_INFO(GFX, "Display: back buffer allocation failed, drawing direct to panel");
+    }
+
+    // NEW: DMA strips for async present (needs the back buffer)
+    if (frameReady) {
+        size_t stripBytes = WIDTH * DMA_STRIP_LINES * sizeof(uint16_t);
+        stripBuffers[0] = (uint16_t*)heap_caps_malloc(stripBytes, MALLOC_CAP_DMA);
+        stripBuffers[1] = (uint16_t*)heap_caps_malloc(stripBytes, MALLOC_CAP_DMA);
+        asyncPresent = stripBuffers[0] != nullptr && stripBuffers[1] != nullptr && tft.initDMA();
+        if (!asyncPresent) {
+            LOG_INFO(GFX, "Display: DMA unavailable, presenting synchronously");
+        }
+    }
+
     clear();
+    flush();
 }
 
 void Display::clear() {
-    tft.fillScreen(TFT_BLACK);
+    PROFILE_DRAW_SCOPE();
+    clearCount++;
+    if (frameReady) {
+        servicePresent();
+        frame.fillSprite(TFT_BLACK);
+        markDirty(0, 0, WIDTH, HEIGHT);
+    } else {
+        tft.fillScreen(TFT_BLACK);
+    }
 }
 
 void Display::setBacklight(bool on) {
@@ -25,15 +89,36 @@ void Display::setBacklight(bool on) {
 }
 
 void Display::drawPixel(int x, int y, uint16_t color) {
-    tft.drawPixel(x, y, color);
+    PROFILE_DRAW_SCOPE();
+    if (frameReady) {
+        servicePresent();
+        frame.drawPixel(x, y, color);
+        markDirty(x, y, 1, 1);
+    } else {
+        tft.drawPixel(x, y, color);
+    }
 }
 
 void Display::drawRect(int x, int y, int w, int h, uint16_t color) {
-    tft.drawRect(x, y, w, h, color);
+    PROFILE_DRAW_SCOPE();
+    if (frameReady) {
+        servicePresent();
+        frame.drawRect(x, y, w, h, color);
+        markDirty(x, y, w, h);
+    } else {
+        tft.drawRect(x, y, w, h, color);
+    }
 }
 
 void Display::fillRect(int x, int y, int w, int h, uint16_t color) {
-    tft.fillRect(x, y, w, h, color);
+    PROFILE_DRAW_SCOPE();
+    if (frameReady) {
+        servicePresent();
+        frame.fillRect(x, y, w, h, color);
+        markDirty(x, y, w, h);
+    } else {
+        tft.fillRect(x, y, w, h, color);
+    }
 }
 
 void Display::drawText(const char* text, int x, int y, uint16_t color) {
@@ -41,14 +126,479 @@ void Display::drawText(const char* text, int x, int y, uint16_t color) {
 }
 
 void Display::drawText(const char* text, int x, int y, uint16_t color, uint8_t size) {
-    tft.setTextColor(color, TFT_BLACK);
-    tft.setTextSize(size);
-    tft.setCursor(x, y);
-    tft.print(text);
+    PROFILE_DRAW_SCOPE();
+    const GlyphStyle* style = (textRunsEnabled && glyphs.isReady()) ? glyphs.getStyle(size, color, TFT_BLACK) : nullptr;
+    if (style == nullptr || (!frameReady && !style->fillBackground)) {
+        drawTextDirect(text, x, y, color, TFT_BLACK, size);
+        return;
+    }
+
+    // Split into runs the way TFT_eSPI moves its cursor: '\n' goes to the
+    // start of the next line, and a glyph that would cross the right edge
+    // wraps to x = 0 first
+    int cellW = GLYPH_CELL_WIDTH * size;
+    int lineH = GLYPH_CELL_HEIGHT * size;
+    int cursorX = x;
+    int cursorY = y;
+    const char* runStart = text;
+    int runX = x;
+
+    for (const char* c = text; ; c++) {
+        if (*c == '\r') continue;
+        bool wrap = (*c != '\0' && *c != '\n' && cursorX + cellW > WIDTH);
+        if (*c == '\0' || *c == '\n' || wrap) {
+            drawRun(runStart, c - runStart, runX, cursorY, style);
+            if (*c == '\0') break;
+
+            cursorX = 0;
+            cursorY += lineH;
+            runX = 0;
+            runStart = (*c == '\n') ? c + 1 : c;
+            if (*c == '\n') continue;
+        }
+        cursorX += cellW;
+    }
+}
+
+void Display::drawTextRun(const char* text, int x, int y, uint16_t color, uint16_t bg, uint8_t size) {
+    PROFILE_DRAW_SCOPE();
+    const GlyphStyle* style = (textRunsEnabled && glyphs.isReady()) ? glyphs.getStyle(size, color, bg) : nullptr;
+    if (style == nullptr || (!frameReady && !style->fillBackground)) {
+        // Keep the single-line contract on the fallback path too
+        String line(text);
+        int newline = line.indexOf('\n');
+        if (newline >= 0) line = line.substring(0, newline);
+        drawTextDirect(line.c_str(), x, y, color, bg, size);
+        return;
+    }
+
+    const char* end = strchr(text, '\n');
+    drawRun(text, end ? end - text : strlen(text), x, y, style);
+}
+
+void Display::drawTextDirect(const char* text, int x, int y, uint16_t color, uint16_t bg, uint8_t size) {
+    // Original path: TFT_eSPI renders glyph by glyph
+    servicePresent();
+    TFT_eSPI& target = frameReady ? (TFT_eSPI&)frame : tft;
+    target.setTextColor(color, bg);
+    target.setTextSize(size);
+    target.setCursor(x, y);
+    target.print(text);
+
+    if (frameReady) {
+        markTextDirty(text, x, y, size);
+    }
+}
+
+void Display::drawRun(const char* text, int length, int x, int y, const GlyphStyle* style) {
+    int size = style->size;
+    int cellW = GLYPH_CELL_WIDTH * size;
+
+    // Glyphs of the run that land on screen ('\r' draws nothing and
+    // doesn't advance); x moves up to the first one kept. A run starting
+    // part way off the left edge shows a partial glyph at each end, so
+    // WIDTH / GLYPH_CELL_WIDTH + 2 cells can be visible.
+    uint8_t chars[WIDTH / GLYPH_CELL_WIDTH + 2];
+    int count = 0;
+    for (int i = 0; i < length; i++) {
+        if (text[i] == '\r') continue;
+        if (count == 0 && x + cellW <= 0) {
+            x += cellW;
+            continue;
+        }
+        if (x + count * cellW >= WIDTH || count == (int)sizeof(chars)) break;
+        chars[count++] = (uint8_t)text[i];
+    }
+
+    // Visible part of the run
+    int left = max(x, 0);
+    int top = max(y, 0);
+    int right = min(x + count * cellW, SCREEN_WIDTH);
+    int bottom = min(y + GLYPH_CELL_HEIGHT * size, SCREEN_HEIGHT);
+    if (left >= right || top >= bottom) return;
+    int visibleW = right - left;
+
+    uint16_t scanline[WIDTH];
+    uint16_t* pixels = nullptr;
+    if (frameReady) {
+        servicePresent();
+        pixels = (uint16_t*)frame.getPointer();
+    } else {
+        tft.startWrite();
+        tft.setAddrWindow(left, top, visibleW, bottom - top);
+    }
+
+    for (int line = top; line < bottom; line++) {
+        int glyphRow = (line - y) / size;
+
+        // Buffered: glyph rows go straight into the back buffer line.
+        // Direct: the line is assembled in scanline and pushed.
+        uint16_t* out = frameReady ? pixels + line * WIDTH + left : scanline;
+        for (int i = 0; i < count; i++) {
+            int cellX = x + i * cellW;
+            int from = max(cellX, left);
+            int to = min(cellX + cellW, right);
+            uint8_t mask = glyphs.rowMask(chars[i], glyphRow);
+            const uint16_t* row = style->rows[mask] + (from - cellX);
+
+            if (style->fillBackground || !frameReady) {
+                memcpy(out + (from - left), row, (to - from) * sizeof(uint16_t));
+            } else {
+                // No background: only the glyph's own pixels are written
+                for (int px = from; px < to; px++) {
+                    if ((mask >> ((px - cellX) / size)) & 1) out[px - left] = row[px - from];
+                }
+            }
+        }
+
+        if (!frameReady) {
+            tft.pushPixels(scanline, visibleW);
+        }
+    }
+
+    if (frameReady) {
+        markDirty(left, top, visibleW, bottom - top);
+    } else {
+        tft.endWrite();
+    }
+}
+
+void Display::drawImage(const ImageAsset& image, int x, int y, uint8_t scale) {
+    PROFILE_DRAW_SCOPE();
+    if (image.width > IMAGE_MAX_WIDTH || scale == 0) return;
+
+    // Visible part of the scaled image
+    int drawW = image.width * scale;
+    int drawH = image.height * scale;
+    int left = max(x, 0);
+    int top = max(y, 0);
+    int right = min(x + drawW, SCREEN_WIDTH);
+    int bottom = min(y + drawH, SCREEN_HEIGHT);
+    if (left >= right || top >= bottom) return;
+    int visibleW = right - left;
+
+    // Palette in panel byte order, so scanlines can be copied as-is
+    uint16_t colors[256];
+    for (int i = 0; i < image.paletteSize && i < 256; i++) {
+        uint16_t color = pgm_read_word(&image.palette[i]);
+        colors[i] = (color >> 8) | (color << 8);
+    }
+
+    uint8_t indices[IMAGE_MAX_WIDTH];
+    uint16_t scanline[WIDTH];
+    uint8_t opaque[WIDTH];
+    ImageDecoder decoder(image);
+
+    if (frameReady) {
+        servicePresent();
+    } else {
+        tft.startWrite();
+        tft.setAddrWindow(left, top, visibleW, bottom - top);
+    }
+
+    uint16_t* pixels = frameReady ? (uint16_t*)frame.getPointer() : nullptr;
+    for (int row = 0; row < image.height; row++) {
+        decoder.nextRow(indices);
+
+        int firstLine = y + row * scale;
+        if (firstLine + scale <= top) continue;
+        if (firstLine >= bottom) break;
+
+        // Expand the visible columns of this row
+        for (int sx = left; sx < right; sx++) {
+            uint8_t index = indices[(sx - x) / scale];
+            scanline[sx - left] = colors[index];
+            opaque[sx - left] = (index != image.transparentIndex);
+        }
+
+        for (int line = max(firstLine, top); line < min(firstLine + scale, bottom); line++) {
+            if (!frameReady) {
+                tft.pushPixels(scanline, visibleW);  // Transparency needs the back buffer
+            } else if (image.transparentIndex < 0) {
+                memcpy(pixels + line * WIDTH + left, scanline, visibleW * sizeof(uint16_t));
+            } else {
+                uint16_t* out = pixels + line * WIDTH + left;
+                for (int i = 0; i < visibleW; i++) {
+                    if (opaque[i]) out[i] = scanline[i];
+                }
+            }
+        }
+    }
+
+    if (frameReady) {
+        markDirty(left, top, visibleW, bottom - top);
+    } else {
+        tft.endWrite();
+    }
+}
+
+void Display::drawSprite(const SpriteAtlas& atlas, const SpriteFrame& sprite, int x, int y,
+                         uint8_t scale, bool flipX, const DirtyRect* clip) {
+    PROFILE_DRAW_SCOPE();
+    if (scale == 0) return;
+
+    // Destination rect, clipped to the screen and the optional clip rect
+    int left = max(x, 0);
+    int top = max(y, 0);
+    int right = min(x + sprite.w * scale, SCREEN_WIDTH);
+    int bottom = min(y + sprite.h * scale, SCREEN_HEIGHT);
+    if (clip != nullptr) {
+        left = max(left, clip->x);
+        top = max(top, clip->y);
+        right = min(right, clip->x + clip->w);
+        bottom = min(bottom, clip->y + clip->h);
+    }
+    if (left >= right || top >= bottom) return;
+
+    if (frameReady) {
+        servicePresent();
+    }
+    uint16_t* pixels = frameReady ? (uint16_t*)frame.getPointer() : nullptr;
+
+    for (int dy = top; dy < bottom; dy++) {
+        const uint8_t* row = atlas.pixels + (sprite.y + (dy - y) / scale) * atlas.width + sprite.x;
+        for (int dx = left; dx < right; dx++) {
+            int sx = (dx - x) / scale;
+            if (flipX) sx = sprite.w - 1 - sx;
+            uint8_t index = pgm_read_byte(&row[sx]);
+            if (index == atlas.transparentIndex) continue;
+
+            uint16_t color = pgm_read_word(&atlas.palette[index]);
+            if (frameReady) {
+                pixels[dy * WIDTH + dx] = (color >> 8) | (color << 8);
+            } else {
+                tft.drawPixel(dx, dy, color);
+            }
+        }
+    }
+
+    if (frameReady) {
+        markDirty(left, top, right - left, bottom - top);
+    }
+}
+
+//============================================================================
+// BACK BUFFER / DIRTY RECTANGLES
+//============================================================================
+
+void Display::markDirty(int x, int y, int w, int h) {
+    // Clip to the screen
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > WIDTH) w = WIDTH - x;
+    if (y + h > HEIGHT) h = HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    DirtyRect incoming = {x, y, w, h};
+
+    // Fold into existing rects while the union doesn't push much extra.
+    // A merged rect can now overlap others, so rescan after every merge.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < dirtyCount; i++) {
+            DirtyRect combined = rectUnion(dirtyRects[i], incoming);
+            if (rectArea(combined) <= rectArea(dirtyRects[i]) + rectArea(incoming) + DIRTY_MERGE_SLACK_PIXELS) {
+                incoming = combined;
+                dirtyRects[i] = dirtyRects[--dirtyCount];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    // Out of slots: merge with whichever rect grows the least
+    if (dirtyCount == MAX_DIRTY_RECTS) {
+        int best = 0;
+        int bestGrowth = -1;
+        for (int i = 0; i < dirtyCount; i++) {
+            int growth = rectArea(rectUnion(dirtyRects[i], incoming)) - rectArea(dirtyRects[i]);
+            if (bestGrowth < 0 || growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        incoming = rectUnion(dirtyRects[best], incoming);
+        dirtyRects[best] = dirtyRects[--dirtyCount];
+    }
+
+    dirtyRects[dirtyCount++] = incoming;
 }
 
-void Display::drawSprite(const uint8_t* spriteData, int x, int y, int w, int h) {
-    // This is a placeholder for future sprite implementation
-    // You'll implement this when you add sprite support
-    fillRect(x, y, w, h, TFT_WHITE); // Temporary placeholder
-}
\ No newline at end of file
+void Display::markTextDirty(const char* text, int x, int y, uint8_t size) {
+    // Follow TFT_eSPI's GLCD cursor rules (6x8 cells, wrap at the right edge)
+    // so wrapped text marks every line it touched
+    int charWidth = 6 * size;
+    int lineHeight = 8 * size;
+    int cursorX = x;
+    int cursorY = y;
+    int left = x, top = y, right = x, bottom = y;
+
+    for (const char* c = text; *c; c++) {
+        if (*c == '\r') continue;
+        if (*c == '\n') {
+            cursorX = 0;
+            cursorY += lineHeight;
+            continue;
+        }
+        if (cursorX + charWidth > WIDTH) {
+            cursorX = 0;
+            cursorY += lineHeight;
+        }
+        left = min(left, cursorX);
+        top = min(top, cursorY);
+        right = max(right, cursorX + charWidth);
+        bottom = max(bottom, cursorY + lineHeight);
+        cursorX += charWidth;
+    }
+
+    markDirty(left, top, right - left, bottom - top);
+}
+
+void Display::pushRect(const DirtyRect& rect) {
+    // One address window per rect, rows streamed straight from the buffer
+    uint16_t* pixels = (uint16_t*)frame.getPointer();
+    tft.startWrite();
+    tft.setAddrWindow(rect.x, rect.y, rect.w, rect.h);
+    for (int row = 0; row < rect.h; row++) {
+        tft.pushPixels(pixels + (rect.y + row) * WIDTH + rect.x, rect.w);
+    }
+    tft.endWrite();
+}
+
+void Display::flush() {
+    if (asyncPresent) {
+        present();
+        finishPresent();
+    } else {
+        flushBlocking();
+    }
+}
+
+void Display::flushBlocking() {
+    bytesFlushedLastFrame = 0;
+    if (!frameReady || dirtyCount == 0) {
+        return;
+    }
+    TRACE_SCOPE(trace, TRACE_DISPLAY_FLUSH, dirtyCount);
+
+    for (int i = 0; i < dirtyCount; i++) {
+        pushRect(dirtyRects[i]);
+        bytesFlushedLastFrame += rectArea(dirtyRects[i]) * 2;
+    }
+
+    totalBytesFlushed += bytesFlushedLastFrame;
+    dirtyCount = 0;
+    trace.setResult(bytesFlushedLastFrame);
+}
+
+//============================================================================
+// ASYNC (DMA) PRESENT
+//============================================================================
+
+void Display::present() {
+    if (!asyncPresent) {
+        flushBlocking();
+        return;
+    }
+
+    // The previous frame has to be out before its job slots are reused
+    finishPresent();
+
+    bytesFlushedLastFrame = 0;
+    if (dirtyCount == 0) {
+        return;
+    }
+
+    for (int i = 0; i < dirtyCount; i++) {
+        jobRects[i] = dirtyRects[i];
+        bytesFlushedLastFrame += rectArea(dirtyRects[i]) * 2;
+    }
+    jobCount = dirtyCount;
+    dirtyCount = 0;
+    totalBytesFlushed += bytesFlushedLastFrame;
+    TRACE_ASYNC_BEGIN(TRACE_DISPLAY_FLUSH, jobCount);
+
+    jobRect = 0;
+    jobRow = 0;
+    stripReady[0] = stripReady[1] = false;
+    nextStrip = 0;
+    presentActive = true;
+
+    tft.startWrite();
+    servicePresent();
+}
+
+bool Display::fillStrip(int strip) {
+    // Skip rects that are already fully copied
+    while (jobRect < jobCount && jobRow >= jobRects[jobRect].h) {
+        jobRect++;
+        jobRow = 0;
+    }
+    if (jobRect >= jobCount) {
+        return false;
+    }
+
+    // A strip holds DMA_STRIP_LINES full screen rows, so any rect width fits
+    const DirtyRect& rect = jobRects[jobRect];
+    int lines = min(DMA_STRIP_LINES, rect.h - jobRow);
+    uint16_t* pixels = (uint16_t*)frame.getPointer();
+    uint16_t* out = stripBuffers[strip];
+    for (int row = 0; row < lines; row++) {
+        memcpy(out + row * rect.w, pixels + (rect.y + jobRow + row) * WIDTH + rect.x, rect.w * sizeof(uint16_t));
+    }
+
+    stripWindows[strip] = {rect.x, rect.y + jobRow, rect.w, lines};
+    stripReady[strip] = true;
+    jobRow += lines;
+    return true;
+}
+
+void Display::servicePresent() {
+    if (!presentActive) return;
+
+    // nextStrip is never the buffer on the wire, so it is safe to fill now
+    if (!stripReady[nextStrip]) {
+        fillStrip(nextStrip);
+    }
+
+    if (tft.dmaBusy()) return;
+
+    if (stripReady[nextStrip]) {
+        const DirtyRect& window = stripWindows[nextStrip];
+        tft.pushImageDMA(window.x, window.y, window.w, window.h, stripBuffers[nextStrip]);
+        stripReady[nextStrip] = false;
+        nextStrip ^= 1;
+
+        // The other buffer finished before this transfer started; refill it
+        fillStrip(nextStrip);
+        return;
+    }
+
+    // Nothing left to send and the bus is idle
+    tft.endWrite();
+    presentActive = false;
+    TRACE_ASYNC_END(TRACE_DISPLAY_FLUSH, (int32_t)bytesFlushedLastFrame);
+}
+
+void Display::finishPresent() {
+    while (presentActive) {
+        tft.dmaWait();
+        servicePresent();
+    }
+}
+
+void Display::serviceDelay(unsigned long ms) {
+    unsigned long start = millis();
+
+    // Feed the DMA in 1 ms steps while there is work, then sleep the rest
+    while (presentActive && millis() - start < ms) {
+        servicePresent();
+        delay(1);
+    }
+
+    unsigned long elapsed = millis() - start;
+    if (elapsed < ms) {
+        delay(ms - elapsed);
+    }
+}
@@ -2,40 +2,143 @@
 #define DISPLAY_H
 
 #include <TFT_eSPI.h>
+#include <esp_heap_caps.h>
+#include "ImageAsset.h"
+#include "SpriteAtlas.h"
+#include "GlyphCache.h"
 
 // Display configuration
 #define SCREEN_WIDTH 170
 #define SCREEN_HEIGHT 320
 #define TFT_BL 14
 
+// NEW: Dirty-rectangle tracking for the back buffer
+#define MAX_DIRTY_RECTS 8
+// Merging two rects is worth it if it pushes at most this many extra pixels
+// (roughly what a separate address-window transaction costs on the bus)
+#define DIRTY_MERGE_SLACK_PIXELS 256
+
+// NEW: Async present streams dirty rects through two DMA strip buffers of
+// this many full-width lines each (2 x 5.4 KB of DMA-capable RAM)
+#define DMA_STRIP_LINES 16
+
+struct DirtyRect {
+    int x, y, w, h;
+};
+
 class Display {
 private:
     TFT_eSPI tft;
-    
+
+    // NEW: Full-screen RGB565 back buffer. Drawing goes here; flush() pushes
+    // the dirty parts to the panel once per loop(). If the buffer cannot be
+    // allocated we fall back to drawing straight to the panel.
+    TFT_eSprite frame;
+    bool frameReady;
+
+    DirtyRect dirtyRects[MAX_DIRTY_RECTS];
+    int dirtyCount;
+
+    uint32_t bytesFlushedLastFrame;
+    uint32_t totalBytesFlushed;
+
+    // NEW: Bumped by every clear(); lets retained UI tell whether what it
+    // drew is still on screen
+    uint32_t clearCount;
+
+    // NEW: Async present job. present() takes over the frame's dirty rects;
+    // servicePresent() copies them a strip at a time into whichever strip
+    // buffer is not on the wire and hands it to pushImageDMA. A strip buffer
+    // belongs to the DMA engine from pushImageDMA until dmaBusy() clears, so
+    // the CPU never touches the one in flight. Drawing keeps going into the
+    // back buffer meanwhile; rows not yet copied simply go out newer, and
+    // they are dirty again for the next present.
+    bool asyncPresent;
+    bool presentActive;
+    uint16_t* stripBuffers[2];
+    bool stripReady[2];
+    DirtyRect stripWindows[2];
+    int nextStrip;
+    DirtyRect jobRects[MAX_DIRTY_RECTS];
+    int jobCount;
+    int jobRect;
+    int jobRow;
+
+    // NEW: Pre-rasterized GLCD glyphs for the text-run renderer
+    GlyphCache glyphs;
+    bool textRunsEnabled;
+
+    void drawTextDirect(const char* text, int x, int y, uint16_t color, uint16_t bg, uint8_t size);
+    void drawRun(const char* text, int length, int x, int y, const GlyphStyle* style);
+    void markDirty(int x, int y, int w, int h);
+    void markTextDirty(const char* text, int x, int y, uint8_t size);
+    void pushRect(const DirtyRect& rect);
+    void flushBlocking();
+    bool fillStrip(int strip);
+    void finishPresent();
+
 public:
     Display();
     void init();
     void clear();
+    uint32_t getClearCount() const { return clearCount; }
     void setBacklight(bool on);
-    
+
     // Basic drawing functions
     void drawPixel(int x, int y, uint16_t color);
     void drawRect(int x, int y, int w, int h, uint16_t color);
     void fillRect(int x, int y, int w, int h, uint16_t color);
-    
+
     // Text functions
     void drawText(const char* text, int x, int y, uint16_t color);
     void drawText(const char* text, int x, int y, uint16_t color, uint8_t size);
-    
-    // Sprite functions (for future use)
-    void drawSprite(const uint8_t* spriteData, int x, int y, int w, int h);
-    
+
+    // NEW: Draw one line of text as a single run: every scanline of the
+    // string is assembled from cached glyph rows and written in one go (one
+    // address window when drawing straight to the panel). No wrapping;
+    // stops at '\n' and clips at the screen edge. drawText() uses the same
+    // renderer, split into runs at newlines and wrap points.
+    void drawTextRun(const char* text, int x, int y, uint16_t color, uint16_t bg = TFT_BLACK, uint8_t size = 1);
+    GlyphCache& getGlyphCache() { return glyphs; }
+    // Switch back to TFT_eSPI's glyph-by-glyph text (for comparisons)
+    void setTextRunsEnabled(bool enabled) { textRunsEnabled = enabled; }
+
+    // NEW: Decode a compressed image asset straight into the back buffer
+    // (or one address window on the panel), optionally scaled up
+    void drawImage(const ImageAsset& image, int x, int y, uint8_t scale = 1);
+
+    // NEW: Blit one atlas frame with its transparent colour skipped. The
+    // optional clip limits drawing to part of the screen (used by SpriteLayer
+    // to repaint only damaged areas).
+    void drawSprite(const SpriteAtlas& atlas, const SpriteFrame& sprite, int x, int y,
+                    uint8_t scale = 1, bool flipX = false, const DirtyRect* clip = nullptr);
+
+    // NEW: Push everything drawn since the last flush to the panel and wait
+    // for it to land. Used by screens that block waiting for input.
+    void flush();
+    bool hasPendingChanges() const { return dirtyCount > 0; }
+    bool isBuffered() const { return frameReady; }
+
+    // NEW: Start pushing this frame without waiting (DMA when available,
+    // otherwise the same as flush()). Called once per loop().
+    void present();
+    // Keep an in-flight present moving; cheap when there is nothing to do
+    void servicePresent();
+    // delay() replacement that feeds the DMA while it waits
+    void serviceDelay(unsigned long ms);
+    bool isPresenting() const { return presentActive; }
+    bool isAsyncPresent() const { return asyncPresent; }
+
+    // NEW: Bus traffic accounting (pixel bytes only, RGB565 = 2 bytes/pixel)
+    uint32_t getBytesFlushedLastFrame() const { return bytesFlushedLastFrame; }
+    uint32_t getTotalBytesFlushed() const { return totalBytesFlushed; }
+
     // Get TFT instance for advanced operations
     TFT_eSPI& getTFT() { return tft; }
-    
+
     // Screen dimensions
     static const int WIDTH = SCREEN_WIDTH;
     static const int HEIGHT = SCREEN_HEIGHT;
 };
 
-#endif
\ No newline at end of file
+#endif
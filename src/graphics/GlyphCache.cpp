@@ -0,0 +1,88 @@
+#include "GlyphCache.h"
+#include "../debug/Log.h"
+
+GlyphCache::GlyphCache() {
+    ready = false;
+    styleCount = 0;
+    useCounter = 0;
+    hits = 0;
+    misses = 0;
+}
+
+bool GlyphCache::init(TFT_eSPI* tft) {
+    // Draw every character white-on-black into a one-cell sprite and read
+    // back which pixels it set
+    TFT_eSprite scratch(tft);
+    scratch.setColorDepth(16);
+    if (scratch.createSprite(GLYPH_CELL_WIDTH, GLYPH_CELL_HEIGHT) == nullptr) {
+        LOG_INFO(GFX, "GlyphCache: scratch sprite allocation failed");
+        return false;
+    }
+
+    uint16_t* pixels = (uint16_t*)scratch.getPointer();
+    for (int c = 0; c < 256; c++) {
+        scratch.fillSprite(TFT_BLACK);
+        scratch.drawChar(0, 0, c, TFT_WHITE, TFT_BLACK, 1);
+        for (int row = 0; row < GLYPH_CELL_HEIGHT; row++) {
+            uint8_t mask = 0;
+            for (int col = 0; col < GLYPH_CELL_WIDTH; col++) {
+                if (pixels[row * GLYPH_CELL_WIDTH + col] != 0) {
+                    mask |= 1 << col;
+                }
+            }
+            masks[c][row] = mask;
+        }
+    }
+
+    scratch.deleteSprite();
+    ready = true;
+    return true;
+}
+
+void GlyphCache::buildStyle(GlyphStyle& style, uint8_t size, uint16_t fg, uint16_t bg) {
+    style.size = size;
+    style.fg = fg;
+    style.bg = bg;
+    style.fillBackground = (fg != bg);
+
+    uint16_t fgPanel = (fg >> 8) | (fg << 8);
+    uint16_t bgPanel = (bg >> 8) | (bg << 8);
+    int width = GLYPH_CELL_WIDTH * size;
+    for (int pattern = 0; pattern < 64; pattern++) {
+        for (int px = 0; px < width; px++) {
+            style.rows[pattern][px] = (pattern >> (px / size)) & 1 ? fgPanel : bgPanel;
+        }
+    }
+}
+
+const GlyphStyle* GlyphCache::getStyle(uint8_t size, uint16_t fg, uint16_t bg) {
+    if (size == 0 || size > GLYPH_MAX_SIZE) return nullptr;
+    useCounter++;
+
+    for (int i = 0; i < styleCount; i++) {
+        GlyphStyle& style = styles[i];
+        if (style.size == size && style.fg == fg && style.bg == bg) {
+            style.lastUsed = useCounter;
+            hits++;
+            return &style;
+        }
+    }
+
+    // Miss: take a free slot or evict the least recently used one
+    int slot = styleCount;
+    if (styleCount < GLYPH_CACHE_SLOTS) {
+        styleCount++;
+    } else {
+        slot = 0;
+        for (int i = 1; i < styleCount; i++) {
+            if (styles[i].lastUsed < styles[slot].lastUsed) {
+                slot = i;
+            }
+        }
+    }
+
+    buildStyle(styles[slot], size, fg, bg);
+    styles[slot].lastUsed = useCounter;
+    misses++;
+    return &styles[slot];
+}
@@ -0,0 +1,60 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <TFT_eSPI.h>
+
+// TFT_eSPI's built-in GLCD font: 6x8 cells (5x7 glyph plus spacing)
+#define GLYPH_CELL_WIDTH 6
+#define GLYPH_CELL_HEIGHT 8
+
+// Largest text size the cache pre-rasterizes; bigger text uses TFT_eSPI
+#define GLYPH_MAX_SIZE 3
+// Colour/size combinations kept at once (least recently used is replaced)
+#define GLYPH_CACHE_SLOTS 8
+
+// One pre-rasterized text style. A glyph row is a 6-bit pattern (bit 0 is
+// the leftmost column), so every row any glyph can produce is one of 64
+// scanline pieces; they are stored here already scaled and in panel byte
+// order, ready to copy.
+struct GlyphStyle {
+    uint8_t size;
+    uint16_t fg, bg;               // RGB565 as passed to TFT_eSPI
+    bool fillBackground;           // false when fg == bg (TFT_eSPI draws no background then)
+    uint32_t lastUsed;
+    uint16_t rows[64][GLYPH_CELL_WIDTH * GLYPH_MAX_SIZE];
+};
+
+// Glyph shapes for the GLCD font plus a small cache of coloured styles.
+// The shapes are captured once from TFT_eSPI itself, so cached text is
+// pixel-identical to what print() draws.
+class GlyphCache {
+private:
+    uint8_t masks[256][GLYPH_CELL_HEIGHT];
+    bool ready;
+
+    GlyphStyle styles[GLYPH_CACHE_SLOTS];
+    int styleCount;
+    uint32_t useCounter;
+    uint32_t hits;
+    uint32_t misses;
+
+    void buildStyle(GlyphStyle& style, uint8_t size, uint16_t fg, uint16_t bg);
+
+public:
+    GlyphCache();
+
+    // Rasterize the font through a scratch sprite. Needs an initialised TFT.
+    bool init(TFT_eSPI* tft);
+    bool isReady() const { return ready; }
+
+    // Row pattern of glyph c (0..7), bit 0 = leftmost column
+    uint8_t rowMask(uint8_t c, int row) const { return masks[c][row]; }
+
+    // Cached style for this size and colour pair (built on a miss)
+    const GlyphStyle* getStyle(uint8_t size, uint16_t fg, uint16_t bg);
+
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "ImageAsset.h"
+
+ImageDecoder::ImageDecoder(const ImageAsset& asset) : image(asset) {
+    cursor = image.data;
+    rowsDecoded = 0;
+}
+
+bool ImageDecoder::nextRow(uint8_t* out) {
+    if (rowsDecoded >= image.height) {
+        return false;
+    }
+
+    const uint8_t* end = image.data + image.dataSize;
+    int x = 0;
+    while (x < image.width && cursor < end) {
+        uint8_t header = pgm_read_byte(cursor++);
+        int count = (header & 0x7F) + 1;
+        if (x + count > image.width) {
+            count = image.width - x;  // Corrupt stream - don't overrun the row
+        }
+
+        if (header & 0x80) {
+            uint8_t index = pgm_read_byte(cursor++);
+            memset(out + x, index, count);
+        } else {
+            for (int i = 0; i < count; i++) {
+                out[x + i] = pgm_read_byte(cursor++);
+            }
+        }
+        x += count;
+    }
+
+    // Short stream: pad with the first palette entry rather than garbage
+    if (x < image.width) {
+        memset(out + x, 0, image.width - x);
+    }
+
+    rowsDecoded++;
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef IMAGE_ASSET_H
+#define IMAGE_ASSET_H
+
+#include <Arduino.h>
+
+// Widest image the decoder will handle (one scanline of indices)
+#define IMAGE_MAX_WIDTH 320
+
+// Compressed image stored in flash, produced by tools/img2asset.py.
+//
+// Pixels are palette indices, run-length encoded row by row (packets never
+// cross a row, so rows decode independently and in order):
+//   header byte n with bit 7 set   -> (n & 0x7F) + 1 copies of the next byte
+//   header byte n with bit 7 clear -> n + 1 literal index bytes follow
+struct ImageAsset {
+    uint16_t width;
+    uint16_t height;
+    uint16_t paletteSize;
+    int16_t transparentIndex;   // -1 if every pixel is drawn
+    const uint16_t* palette;    // RGB565
+    const uint8_t* data;        // RLE stream
+    uint32_t dataSize;
+};
+
+// Streams an ImageAsset one row of palette indices at a time
+class ImageDecoder {
+private:
+    const ImageAsset& image;
+    const uint8_t* cursor;
+    int rowsDecoded;
+
+public:
+    ImageDecoder(const ImageAsset& asset);
+
+    // Decode the next row into out[0..width-1]. Returns false past the end.
+    bool nextRow(uint8_t* out);
+    int getRowsDecoded() const { return rowsDecoded; }
+};
+
+#endif
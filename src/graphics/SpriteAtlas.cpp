@@ -0,0 +1,22 @@
+#include "SpriteAtlas.h"
+#include <strings.h>
+
+const SpriteFrame* SpriteAtlas::find(const char* name) const {
+    if (name == nullptr) return nullptr;
+
+    // Strip any directory and extension: "enemies/goblin.bmp" -> "goblin"
+    const char* start = strrchr(name, '/');
+    start = start ? start + 1 : name;
+    const char* dot = strrchr(start, '.');
+    size_t length = dot ? (size_t)(dot - start) : strlen(start);
+
+    for (int i = 0; i < frameCount; i++) {
+        const char* frameName = frames[i].name;
+        if (strlen(frameName) != length) continue;
+        // Case-insensitive, enemy names are capitalised ("Goblin")
+        if (strncasecmp(frameName, start, length) == 0) {
+            return &frames[i];
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,34 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <Arduino.h>
+
+// One named sprite inside an atlas
+struct SpriteFrame {
+    const char* name;
+    uint16_t x, y;
+    uint16_t w, h;
+};
+
+// Sprite sheet in flash: 8-bit palette indices, one shared RGB565 palette.
+// Pixels equal to transparentIndex are skipped when blitting.
+// Generated by tools/pack_sprites.py (see SpriteAtlasData.cpp).
+struct SpriteAtlas {
+    uint16_t width;
+    uint16_t height;
+    uint16_t paletteSize;
+    uint8_t transparentIndex;
+    const uint16_t* palette;
+    const uint8_t* pixels;
+    const SpriteFrame* frames;
+    uint16_t frameCount;
+
+    // Look a frame up by name. Accepts asset paths too, so
+    // "enemies/goblin.bmp" finds "goblin". Returns nullptr if missing.
+    const SpriteFrame* find(const char* name) const;
+};
+
+// The game's sprites (assets/sprites)
+extern const SpriteAtlas gameSprites;
+
+#endif
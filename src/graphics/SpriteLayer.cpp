@@ -0,0 +1,123 @@
+#include "SpriteLayer.h"
+
+static bool rectsOverlap(const DirtyRect& a, const DirtyRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+SpriteLayer::SpriteLayer(Display* disp, const SpriteAtlas* spriteAtlas, int x, int y, int w, int h,
+                         uint16_t backgroundColor) {
+    display = disp;
+    atlas = spriteAtlas;
+    bounds = {x, y, w, h};
+    background = backgroundColor;
+    fullRedraw = true;
+    for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+        entries[i].used = false;
+        entries[i].visible = false;
+        entries[i].changed = false;
+        entries[i].sprite = nullptr;
+        entries[i].onScreen = false;
+    }
+}
+
+int SpriteLayer::add(const SpriteFrame* sprite, int x, int y, uint8_t scale, bool flipX) {
+    for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+        if (entries[i].used || entries[i].onScreen) continue;
+        Entry& entry = entries[i];
+        entry.used = true;
+        entry.visible = true;
+        entry.changed = true;
+        entry.sprite = sprite;
+        entry.x = x;
+        entry.y = y;
+        entry.scale = scale;
+        entry.flipX = flipX;
+        return i;
+    }
+    return -1;
+}
+
+void SpriteLayer::remove(int handle) {
+    if (handle < 0 || handle >= MAX_LAYER_SPRITES || !entries[handle].used) return;
+    // Keep the slot until compose() has erased it
+    entries[handle].used = false;
+    entries[handle].changed = true;
+}
+
+void SpriteLayer::clear() {
+    for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+        remove(i);
+    }
+}
+
+void SpriteLayer::setSprite(int handle, const SpriteFrame* sprite) {
+    if (handle < 0 || handle >= MAX_LAYER_SPRITES || !entries[handle].used) return;
+    if (entries[handle].sprite == sprite) return;
+    entries[handle].sprite = sprite;
+    entries[handle].changed = true;
+}
+
+void SpriteLayer::moveTo(int handle, int x, int y) {
+    if (handle < 0 || handle >= MAX_LAYER_SPRITES || !entries[handle].used) return;
+    if (entries[handle].x == x && entries[handle].y == y) return;
+    entries[handle].x = x;
+    entries[handle].y = y;
+    entries[handle].changed = true;
+}
+
+void SpriteLayer::setVisible(int handle, bool visible) {
+    if (handle < 0 || handle >= MAX_LAYER_SPRITES || !entries[handle].used) return;
+    if (entries[handle].visible == visible) return;
+    entries[handle].visible = visible;
+    entries[handle].changed = true;
+}
+
+DirtyRect SpriteLayer::entryRect(const Entry& entry) const {
+    if (entry.sprite == nullptr) return {entry.x, entry.y, 0, 0};
+    return {entry.x, entry.y, entry.sprite->w * entry.scale, entry.sprite->h * entry.scale};
+}
+
+void SpriteLayer::repaint(const DirtyRect& area) {
+    // Clip to the layer, clear to background, redraw overlapping sprites
+    int left = max(area.x, bounds.x);
+    int top = max(area.y, bounds.y);
+    int right = min(area.x + area.w, bounds.x + bounds.w);
+    int bottom = min(area.y + area.h, bounds.y + bounds.h);
+    if (left >= right || top >= bottom) return;
+    DirtyRect clip = {left, top, right - left, bottom - top};
+
+    display->fillRect(clip.x, clip.y, clip.w, clip.h, background);
+    for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+        const Entry& entry = entries[i];
+        if (!entry.used || !entry.visible || entry.sprite == nullptr) continue;
+        if (!rectsOverlap(entryRect(entry), clip)) continue;
+        display->drawSprite(*atlas, *entry.sprite, entry.x, entry.y, entry.scale, entry.flipX, &clip);
+    }
+}
+
+void SpriteLayer::compose() {
+    if (fullRedraw) {
+        repaint(bounds);
+    } else {
+        // Old and new footprint of each changed sprite
+        for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+            Entry& entry = entries[i];
+            if (!entry.changed) continue;
+            if (entry.onScreen) {
+                repaint(entry.drawnRect);
+            }
+            if (entry.used && entry.visible) {
+                repaint(entryRect(entry));
+            }
+        }
+    }
+
+    // Record what is on screen now
+    for (int i = 0; i < MAX_LAYER_SPRITES; i++) {
+        Entry& entry = entries[i];
+        entry.changed = false;
+        entry.onScreen = entry.used && entry.visible && entry.sprite != nullptr;
+        entry.drawnRect = entryRect(entry);
+    }
+    fullRedraw = false;
+}
@@ -0,0 +1,56 @@
+#ifndef SPRITE_LAYER_H
+#define SPRITE_LAYER_H
+
+#include "Display.h"
+#include "SpriteAtlas.h"
+
+#define MAX_LAYER_SPRITES 8
+
+// Per-frame sprite list for one screen region. Callers place, swap and move
+// sprites; compose() then repaints only the areas that changed (background
+// plus every sprite overlapping them, in list order) into the back buffer.
+class SpriteLayer {
+private:
+    struct Entry {
+        bool used;
+        bool visible;
+        bool changed;
+        const SpriteFrame* sprite;
+        int x, y;
+        uint8_t scale;
+        bool flipX;
+        bool onScreen;       // Drawn at the last compose
+        DirtyRect drawnRect; // Where it was drawn
+    };
+
+    Display* display;
+    const SpriteAtlas* atlas;
+    DirtyRect bounds;
+    uint16_t background;
+    Entry entries[MAX_LAYER_SPRITES];
+    bool fullRedraw;
+
+    DirtyRect entryRect(const Entry& entry) const;
+    void repaint(const DirtyRect& area);
+
+public:
+    SpriteLayer(Display* disp, const SpriteAtlas* spriteAtlas, int x, int y, int w, int h,
+                uint16_t backgroundColor = TFT_BLACK);
+
+    // Returns a handle, or -1 if the layer is full
+    int add(const SpriteFrame* sprite, int x, int y, uint8_t scale = 1, bool flipX = false);
+    void remove(int handle);
+    void clear();
+
+    void setSprite(int handle, const SpriteFrame* sprite);
+    void moveTo(int handle, int x, int y);
+    void setVisible(int handle, bool visible);
+
+    // The region was painted over by someone else; redraw it all next time
+    void invalidate() { fullRedraw = true; }
+
+    // Repaint whatever changed since the last compose
+    void compose();
+};
+
+#endif
@@ -1,105 +1,97 @@
+// Generated by tools/img2asset.py from assets/images/victory.png - do not edit.
+// 60x90, 6 colours, 1145 bytes of RLE data (10800 bytes as raw RGB565)
 #ifndef VICTORY_SCREEN_H
 #define VICTORY_SCREEN_H
 
-#include <Arduino.h>
+#include "ImageAsset.h"
 
-// Image dimensions
 #define VICTORY_IMAGE_WIDTH 60
 #define VICTORY_IMAGE_HEIGHT 90
 
-// Store image in PROGMEM to save RAM
-const uint16_t PROGMEM victoryImageData[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xa0, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0xd3, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
- 
+const uint16_t PROGMEM victoryPalette[] = {
+  0x0000, 0xFFFF, 0x31D3, 0xFFA0, 0x4A49, 0xFFD8,
 };
 
-#endif
\ No newline at end of file
+const uint8_t PROGMEM victoryData[] = {
+  0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01,
+  0x83, 0x00, 0x82, 0x01, 0x84, 0x00, 0x01, 0x01, 0x01, 0x83, 0x00, 0x84, 0x01, 0x84, 0x00, 0x01,
+  0x01, 0x01, 0x84, 0x00, 0x82, 0x01, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00,
+  0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01,
+  0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x86,
+  0x00, 0x04, 0x01, 0x01, 0x00, 0x01, 0x01, 0x82, 0x00, 0x84, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85,
+  0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x01, 0x00,
+  0x00, 0x01, 0x83, 0x00, 0x82, 0x01, 0x85, 0x00, 0x82, 0x01, 0x83, 0x00, 0x84, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x85, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x84,
+  0x00, 0x85, 0x00, 0x00, 0x01, 0x85, 0x00, 0x82, 0x01, 0x84, 0x00, 0x01, 0x01, 0x01, 0x85, 0x00,
+  0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x01, 0x84, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x85, 0x00,
+  0x00, 0x01, 0x84, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00,
+  0xBB, 0x00, 0x96, 0x00, 0x01, 0x02, 0x02, 0xA2, 0x00, 0x95, 0x00, 0x82, 0x02, 0xA2, 0x00, 0x95,
+  0x00, 0x82, 0x02, 0xA2, 0x00, 0x94, 0x00, 0x83, 0x02, 0xA2, 0x00, 0x94, 0x00, 0x83, 0x02, 0xA2,
+  0x00, 0x93, 0x00, 0x02, 0x02, 0x02, 0x03, 0x82, 0x02, 0xA1, 0x00, 0x93, 0x00, 0x85, 0x02, 0xA1,
+  0x00, 0x93, 0x00, 0x85, 0x02, 0xA1, 0x00, 0x92, 0x00, 0x86, 0x02, 0xA1, 0x00, 0x92, 0x00, 0x02,
+  0x02, 0x02, 0x03, 0x83, 0x02, 0xA1, 0x00, 0x92, 0x00, 0x84, 0x02, 0x01, 0x03, 0x02, 0xA1, 0x00,
+  0x92, 0x00, 0x86, 0x02, 0xA1, 0x00, 0x92, 0x00, 0x86, 0x02, 0xA1, 0x00, 0x92, 0x00, 0x86, 0x02,
+  0x8B, 0x00, 0x83, 0x04, 0x87, 0x00, 0x83, 0x04, 0x85, 0x00, 0x92, 0x00, 0x86, 0x05, 0x8A, 0x00,
+  0x04, 0x04, 0x04, 0x05, 0x05, 0x04, 0x86, 0x00, 0x01, 0x04, 0x04, 0x82, 0x05, 0x00, 0x04, 0x84,
+  0x00, 0x91, 0x00, 0x88, 0x05, 0x89, 0x00, 0x00, 0x04, 0x83, 0x05, 0x00, 0x04, 0x85, 0x00, 0x00,
+  0x04, 0x83, 0x05, 0x00, 0x04, 0x84, 0x00, 0x91, 0x00, 0x02, 0x05, 0x05, 0x00, 0x82, 0x05, 0x02,
+  0x00, 0x05, 0x05, 0x89, 0x00, 0x00, 0x04, 0x84, 0x05, 0x00, 0x04, 0x83, 0x00, 0x01, 0x04, 0x04,
+  0x83, 0x05, 0x00, 0x04, 0x84, 0x00, 0x91, 0x00, 0x88, 0x05, 0x8A, 0x00, 0x00, 0x04, 0x83, 0x05,
+  0x05, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x84, 0x05, 0x00, 0x04, 0x84, 0x00, 0x91, 0x00, 0x88,
+  0x05, 0x8A, 0x00, 0x01, 0x04, 0x04, 0x83, 0x05, 0x03, 0x04, 0x04, 0x00, 0x04, 0x84, 0x05, 0x01,
+  0x04, 0x04, 0x84, 0x00, 0x91, 0x00, 0x88, 0x05, 0x8A, 0x00, 0x01, 0x04, 0x04, 0x84, 0x05, 0x02,
+  0x04, 0x00, 0x04, 0x84, 0x05, 0x00, 0x04, 0x85, 0x00, 0x92, 0x00, 0x01, 0x05, 0x00, 0x84, 0x05,
+  0x8C, 0x00, 0x00, 0x04, 0x84, 0x05, 0x82, 0x04, 0x84, 0x05, 0x00, 0x04, 0x85, 0x00, 0x92, 0x00,
+  0x01, 0x05, 0x05, 0x82, 0x00, 0x01, 0x05, 0x05, 0x8C, 0x00, 0x00, 0x04, 0x84, 0x05, 0x01, 0x04,
+  0x04, 0x85, 0x05, 0x00, 0x04, 0x85, 0x00, 0x93, 0x00, 0x84, 0x05, 0x8D, 0x00, 0x00, 0x04, 0x84,
+  0x05, 0x01, 0x04, 0x04, 0x84, 0x05, 0x01, 0x04, 0x04, 0x85, 0x00, 0x93, 0x00, 0x00, 0x02, 0x82,
+  0x05, 0x00, 0x02, 0x8D, 0x00, 0x01, 0x04, 0x04, 0x83, 0x05, 0x00, 0x04, 0x85, 0x05, 0x00, 0x04,
+  0x86, 0x00, 0x92, 0x00, 0x86, 0x02, 0x8D, 0x00, 0x00, 0x04, 0x83, 0x05, 0x00, 0x04, 0x84, 0x05,
+  0x01, 0x04, 0x04, 0x86, 0x00, 0x91, 0x00, 0x87, 0x02, 0x8D, 0x00, 0x00, 0x04, 0x89, 0x05, 0x85,
+  0x04, 0x82, 0x00, 0x90, 0x00, 0x89, 0x02, 0x8C, 0x00, 0x00, 0x04, 0x88, 0x05, 0x00, 0x04, 0x83,
+  0x05, 0x82, 0x04, 0x01, 0x00, 0x00, 0x90, 0x00, 0x8A, 0x02, 0x00, 0x05, 0x89, 0x00, 0x01, 0x04,
+  0x04, 0x87, 0x05, 0x00, 0x04, 0x83, 0x05, 0x05, 0x04, 0x04, 0x05, 0x04, 0x04, 0x00, 0x8F, 0x00,
+  0x8B, 0x02, 0x01, 0x05, 0x05, 0x86, 0x00, 0x82, 0x04, 0x00, 0x05, 0x82, 0x04, 0x84, 0x05, 0x00,
+  0x04, 0x83, 0x05, 0x00, 0x04, 0x82, 0x05, 0x01, 0x04, 0x00, 0x8E, 0x00, 0x8C, 0x02, 0x83, 0x05,
+  0x83, 0x00, 0x01, 0x04, 0x04, 0x85, 0x05, 0x00, 0x04, 0x82, 0x05, 0x01, 0x04, 0x04, 0x82, 0x05,
+  0x01, 0x04, 0x04, 0x82, 0x05, 0x01, 0x04, 0x00, 0x8E, 0x00, 0x8C, 0x02, 0x85, 0x05, 0x02, 0x00,
+  0x00, 0x04, 0x87, 0x05, 0x84, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x83, 0x05, 0x01, 0x04, 0x00,
+  0x8E, 0x00, 0x8D, 0x02, 0x00, 0x00, 0x85, 0x05, 0x00, 0x04, 0x8C, 0x05, 0x82, 0x04, 0x84, 0x05,
+  0x01, 0x04, 0x00, 0x8D, 0x00, 0x8E, 0x02, 0x82, 0x00, 0x83, 0x05, 0x00, 0x04, 0x8C, 0x05, 0x01,
+  0x04, 0x04, 0x83, 0x05, 0x82, 0x04, 0x00, 0x00, 0x8D, 0x00, 0x8E, 0x02, 0x85, 0x00, 0x01, 0x05,
+  0x04, 0x84, 0x05, 0x82, 0x04, 0x01, 0x05, 0x05, 0x84, 0x04, 0x83, 0x05, 0x03, 0x04, 0x04, 0x00,
+  0x00, 0x8D, 0x00, 0x85, 0x02, 0x00, 0x03, 0x87, 0x02, 0x86, 0x00, 0x01, 0x04, 0x04, 0x86, 0x05,
+  0x82, 0x04, 0x02, 0x05, 0x05, 0x04, 0x84, 0x05, 0x03, 0x04, 0x04, 0x00, 0x00, 0x8C, 0x00, 0x8A,
+  0x02, 0x00, 0x03, 0x83, 0x02, 0x87, 0x00, 0x01, 0x04, 0x04, 0x85, 0x05, 0x01, 0x04, 0x04, 0x82,
+  0x05, 0x01, 0x04, 0x04, 0x82, 0x05, 0x01, 0x04, 0x04, 0x82, 0x00, 0x8C, 0x00, 0x90, 0x02, 0x87,
+  0x00, 0x00, 0x04, 0x83, 0x05, 0x01, 0x04, 0x04, 0x85, 0x05, 0x84, 0x04, 0x83, 0x00, 0x8C, 0x00,
+  0x90, 0x02, 0x88, 0x00, 0x01, 0x04, 0x04, 0x8B, 0x05, 0x01, 0x04, 0x04, 0x84, 0x00, 0x8B, 0x00,
+  0x91, 0x02, 0x89, 0x00, 0x01, 0x04, 0x04, 0x89, 0x05, 0x01, 0x04, 0x04, 0x85, 0x00, 0x8B, 0x00,
+  0x82, 0x02, 0x00, 0x03, 0x8D, 0x02, 0x8A, 0x00, 0x8B, 0x04, 0x86, 0x00, 0x8B, 0x00, 0x91, 0x02,
+  0x9D, 0x00, 0x8B, 0x00, 0x91, 0x02, 0x9D, 0x00, 0x8A, 0x00, 0x85, 0x02, 0x00, 0x03, 0x8B, 0x02,
+  0x9D, 0x00, 0x8A, 0x00, 0x92, 0x02, 0x9D, 0x00, 0x8A, 0x00, 0x93, 0x02, 0x9C, 0x00, 0x8A, 0x00,
+  0x8D, 0x02, 0x00, 0x03, 0x84, 0x02, 0x9C, 0x00, 0x89, 0x00, 0x94, 0x02, 0x9C, 0x00, 0x89, 0x00,
+  0x94, 0x02, 0x9C, 0x00, 0x89, 0x00, 0x95, 0x02, 0x9B, 0x00, 0x89, 0x00, 0x85, 0x02, 0x00, 0x03,
+  0x8E, 0x02, 0x9B, 0x00, 0x89, 0x00, 0x95, 0x02, 0x9B, 0x00, 0x88, 0x00, 0x96, 0x02, 0x9B, 0x00,
+  0x88, 0x00, 0x97, 0x02, 0x9A, 0x00, 0x88, 0x00, 0x97, 0x02, 0x9A, 0x00, 0x88, 0x00, 0x8B, 0x02,
+  0x00, 0x03, 0x8A, 0x02, 0x9A, 0x00, 0x87, 0x00, 0x99, 0x02, 0x99, 0x00, 0x87, 0x00, 0x99, 0x02,
+  0x99, 0x00, 0x86, 0x00, 0x89, 0x02, 0x00, 0x03, 0x8F, 0x02, 0x99, 0x00, 0x86, 0x00, 0x9B, 0x02,
+  0x98, 0x00, 0x85, 0x00, 0x95, 0x02, 0x00, 0x03, 0x85, 0x02, 0x98, 0x00, 0x85, 0x00, 0x9D, 0x02,
+  0x97, 0x00, 0x84, 0x00, 0x9E, 0x02, 0x97, 0x00, 0x84, 0x00, 0x91, 0x02, 0x00, 0x03, 0x8C, 0x02,
+  0x96, 0x00, 0x83, 0x00, 0x86, 0x02, 0x00, 0x03, 0x98, 0x02, 0x96, 0x00, 0x82, 0x00, 0xA3, 0x02,
+  0x94, 0x00, 0x01, 0x00, 0x00, 0x9D, 0x02, 0x00, 0x03, 0x87, 0x02, 0x92, 0x00, 0xAB, 0x02, 0x8F,
+  0x00, 0x86, 0x00, 0xA4, 0x02, 0x8F, 0x00, 0x87, 0x00, 0x85, 0x05, 0x9B, 0x02, 0x91, 0x00, 0x85,
+  0x00, 0x87, 0x05, 0x88, 0x00, 0x90, 0x02, 0x93, 0x00, 0x84, 0x00, 0x87, 0x05, 0x8B, 0x00, 0x85,
+  0x05, 0x9C, 0x00, 0x84, 0x00, 0x83, 0x05, 0x91, 0x00, 0x84, 0x05, 0x9B, 0x00, 0x9B, 0x00, 0x84,
+  0x05, 0x9A, 0x00, 0x9D, 0x00, 0x82, 0x05, 0x9A, 0x00,
+};
+
+const ImageAsset victoryImage = {
+  60, 90, 6, -1,
+  victoryPalette,
+  victoryData,
+  sizeof(victoryData)
+};
+
+#endif
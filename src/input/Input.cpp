@@ -1,11 +1,29 @@
 #include "Input.h"
+#include "InputRecording.h"
+#include "../utils/constants.h"
 
-Input::Input() {
-    lastDebounceTime = 0;
+static const uint32_t DEBOUNCE_US = INPUT_DEBOUNCE_MS * 1000UL;
+static const uint32_t HOLD_US = INPUT_HOLD_THRESHOLD_MS * 1000UL;
+static const uint32_t REPEAT_US = INPUT_REPEAT_DELAY_MS * 1000UL;
+
+Input* Input::instance = nullptr;
+
+Input::Input() : queueHead(0), queueTail(0) {
+    static const uint8_t pins[4] = {BUTTON_UP, BUTTON_DOWN, BUTTON_A, BUTTON_B};
     for (int i = 0; i < 4; i++) {
-        buttonStates[i] = false;
-        previousButtonStates[i] = false;
+        buttons[i].pin = pins[i];
+        buttons[i].down = false;
+        buttons[i].lastEdgeUs = 0;
+        buttons[i].bounced = false;
+        buttons[i].pressedUs = 0;
+        buttons[i].nextRepeatUs = 0;
+        buttons[i].holdSent = false;
     }
+    interruptsAttached = false;
+    replaying = false;
+    droppedEvents = 0;
+    frameCount = 0;
+    frameCursor = 0;
 }
 
 void Input::init() {
@@ -13,37 +31,265 @@ void Input::init() {
     pinMode(BUTTON_DOWN, INPUT_PULLUP);
     pinMode(BUTTON_A, INPUT_PULLUP);
     pinMode(BUTTON_B, INPUT_PULLUP);
+
+    // Start from the current levels so a button held at boot isn't a press
+    readLevels();
+
+    instance = this;
+    attachInterrupts();
+}
+
+void Input::readLevels() {
+    for (int i = 0; i < 4; i++) {
+        buttons[i].down = (digitalRead(buttons[i].pin) == LOW);
+    }
+}
+
+//============================================================================
+// ISR SIDE
+//============================================================================
+
+void IRAM_ATTR Input::isrUp() { instance->handleEdge(0); }
+void IRAM_ATTR Input::isrDown() { instance->handleEdge(1); }
+void IRAM_ATTR Input::isrA() { instance->handleEdge(2); }
+void IRAM_ATTR Input::isrB() { instance->handleEdge(3); }
+
+void IRAM_ATTR Input::handleEdge(int index) {
+    ButtonState& button = buttons[index];
+    uint32_t now = micros();
+
+    // Leading-edge debounce: act on the first edge, ignore the chatter
+    // after it. update() re-reads the pin if the window swallowed a real
+    // release (or press).
+    if (now - button.lastEdgeUs < DEBOUNCE_US) {
+        button.bounced = true;
+        return;
+    }
+
+    bool down = (digitalRead(button.pin) == LOW);  // Pull-up: LOW = pressed
+    if (down == button.down) return;
+
+    button.down = down;
+    button.lastEdgeUs = now;
+    button.bounced = false;
+    pushEvent(now, index, down ? InputEventType::PRESS : InputEventType::RELEASE);
+}
+
+void IRAM_ATTR Input::pushEvent(uint32_t timeUs, int index, InputEventType type) {
+    uint32_t head = queueHead.load(std::memory_order_relaxed);
+    uint32_t tail = queueTail.load(std::memory_order_acquire);
+    if (head - tail >= INPUT_QUEUE_SIZE) {
+        droppedEvents++;
+        return;
+    }
+
+    InputEvent& event = queue[head & (INPUT_QUEUE_SIZE - 1)];
+    event.timeUs = timeUs;
+    event.button = (Button)index;
+    event.type = type;
+    queueHead.store(head + 1, std::memory_order_release);
+}
+
+void Input::attachInterrupts() {
+    if (interruptsAttached) return;
+    attachInterrupt(digitalPinToInterrupt(BUTTON_UP), isrUp, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(BUTTON_DOWN), isrDown, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(BUTTON_A), isrA, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(BUTTON_B), isrB, CHANGE);
+    interruptsAttached = true;
+}
+
+void Input::suspendInterrupts() {
+    if (!interruptsAttached) return;
+    for (int i = 0; i < 4; i++) {
+        detachInterrupt(digitalPinToInterrupt(buttons[i].pin));
+    }
+    interruptsAttached = false;
+}
+
+void Input::resumeInterrupts() {
+    if (interruptsAttached) return;
+
+    // No ISR can run yet, so we may act as the producer: queue whatever
+    // changed while we were asleep (usually the press that woke us)
+    uint32_t now = micros();
+    for (int i = 0; i < 4; i++) {
+        bool down = (digitalRead(buttons[i].pin) == LOW);
+        if (down != buttons[i].down) {
+            buttons[i].down = down;
+            buttons[i].lastEdgeUs = now;
+            buttons[i].bounced = false;
+            pushEvent(now, i, down ? InputEventType::PRESS : InputEventType::RELEASE);
+        }
+    }
+    attachInterrupts();
+}
+
+//============================================================================
+// MAIN LOOP SIDE
+//============================================================================
+
+void Input::addFrameEvent(const InputEvent& event) {
+    if (frameCount >= INPUT_FRAME_EVENTS) return;
+    frameEvents[frameCount] = event;
+    frameConsumed[frameCount] = false;
+    frameCount++;
+
+    ButtonState& button = buttons[getButtonIndex(event.button)];
+    if (event.type == InputEventType::PRESS) {
+        button.pressedUs = event.timeUs;
+        button.holdSent = false;
+    }
+}
+
+void Input::resyncButton(int index, uint32_t nowUs) {
+    ButtonState& button = buttons[index];
+    if (!button.bounced || nowUs - button.lastEdgeUs < DEBOUNCE_US) return;
+
+    noInterrupts();
+    bool down = (digitalRead(button.pin) == LOW);
+    bool changed = button.bounced && down != button.down;
+    button.bounced = false;
+    if (changed) {
+        button.down = down;
+        button.lastEdgeUs = nowUs;
+    }
+    interrupts();
+
+    if (changed) {
+        addFrameEvent({nowUs, (Button)index, down ? InputEventType::PRESS : InputEventType::RELEASE});
+    }
 }
 
 void Input::update() {
-    // Store previous states first
+    frameCount = 0;
+    frameCursor = 0;
+
+    if (InputRecording::isReplaying()) {
+        updateFromReplay();
+        return;
+    }
+    if (replaying) {
+        // Replay just ended: pick up the buttons from where they really are
+        replaying = false;
+        noInterrupts();
+        readLevels();
+        interrupts();
+    }
+
+    // Drain the ring; anything that doesn't fit waits for the next frame
+    uint32_t tail = queueTail.load(std::memory_order_relaxed);
+    uint32_t head = queueHead.load(std::memory_order_acquire);
+    while (tail != head && frameCount < INPUT_FRAME_EVENTS) {
+        addFrameEvent(queue[tail & (INPUT_QUEUE_SIZE - 1)]);
+        tail++;
+    }
+    queueTail.store(tail, std::memory_order_release);
+
+    uint32_t now = micros();
     for (int i = 0; i < 4; i++) {
-        previousButtonStates[i] = buttonStates[i];
+        resyncButton(i, now);
+
+        // Hold once, then auto-repeat while the button stays down
+        ButtonState& button = buttons[i];
+        if (!button.down) continue;
+        if (!button.holdSent) {
+            if (now - button.pressedUs >= HOLD_US) {
+                button.holdSent = true;
+                button.nextRepeatUs = now + REPEAT_US;
+                addFrameEvent({now, (Button)i, InputEventType::HOLD});
+            }
+        } else if ((int32_t)(now - button.nextRepeatUs) >= 0) {
+            button.nextRepeatUs += REPEAT_US;
+            addFrameEvent({now, (Button)i, InputEventType::REPEAT});
+        }
+    }
+
+    if (InputRecording::isRecording()) {
+        InputRecording::recordFrame(frameEvents, frameCount);
+    }
+}
+
+void Input::updateFromReplay() {
+    replaying = true;
+
+    // The buttons still interrupt; drop what they queued
+    queueTail.store(queueHead.load(std::memory_order_acquire), std::memory_order_release);
+
+    // HOLD and REPEAT are in the recording too, so nothing is generated here.
+    // Levels follow the replayed edges so isDown()/anyHeld() agree with them.
+    InputEvent replayed[INPUT_FRAME_EVENTS];
+    int count = InputRecording::replayFrame(replayed, INPUT_FRAME_EVENTS);
+    for (int i = 0; i < count; i++) {
+        addFrameEvent(replayed[i]);
+        if (replayed[i].type == InputEventType::PRESS || replayed[i].type == InputEventType::RELEASE) {
+            buttons[getButtonIndex(replayed[i].button)].down = (replayed[i].type == InputEventType::PRESS);
+        }
+    }
+}
+
+bool Input::consume(Button button, InputEventType type) {
+    for (int i = 0; i < frameCount; i++) {
+        if (!frameConsumed[i] && frameEvents[i].button == button && frameEvents[i].type == type) {
+            frameConsumed[i] = true;
+            return true;
+        }
     }
-    
-    // Read new states (invert because of pull-up)
-    buttonStates[0] = !digitalRead(BUTTON_UP);    // UP
-    buttonStates[1] = !digitalRead(BUTTON_DOWN);  // DOWN
-    buttonStates[2] = !digitalRead(BUTTON_A);     // A
-    buttonStates[3] = !digitalRead(BUTTON_B);     // B
+    return false;
 }
 
 bool Input::wasPressed(Button button) {
-    // Simple edge detection with basic debounce
-    if (millis() - lastDebounceTime < debounceDelay) {
-        return false;
-    }
-    
-    int index = getButtonIndex(button);
-    bool pressed = buttonStates[index] && !previousButtonStates[index];
-    
-    if (pressed) {
-        lastDebounceTime = millis();
-    }
-    
+    return consume(button, InputEventType::PRESS);
+}
+
+bool Input::wasAnyPressed() {
+    bool pressed = false;
+    for (int i = 0; i < frameCount; i++) {
+        if (!frameConsumed[i] && frameEvents[i].type == InputEventType::PRESS) {
+            frameConsumed[i] = true;
+            pressed = true;
+        }
+    }
     return pressed;
 }
 
+bool Input::wasHeld(Button button) {
+    return consume(button, InputEventType::HOLD);
+}
+
+bool Input::wasRepeated(Button button) {
+    return consume(button, InputEventType::REPEAT);
+}
+
+bool Input::isDown(Button button) const {
+    switch (button) {
+        case Button::UP: return buttons[0].down;
+        case Button::DOWN: return buttons[1].down;
+        case Button::A: return buttons[2].down;
+        case Button::B: return buttons[3].down;
+        default: return false;
+    }
+}
+
+bool Input::pollEvent(InputEvent& event) {
+    while (frameCursor < frameCount) {
+        int i = frameCursor++;
+        if (!frameConsumed[i]) {
+            frameConsumed[i] = true;
+            event = frameEvents[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Input::anyHeld() const {
+    for (int i = 0; i < 4; i++) {
+        if (buttons[i].down) return true;
+    }
+    return false;
+}
+
 int Input::getButtonIndex(Button button) {
     switch (button) {
         case Button::UP: return 0;
@@ -52,4 +298,4 @@ int Input::getButtonIndex(Button button) {
         case Button::B: return 3;
         default: return 0;
     }
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #define INPUT_H
 
 #include <Arduino.h>
+#include <atomic>
 
 // Button definitions
 #define BUTTON_UP 18
@@ -9,6 +10,11 @@
 #define BUTTON_A 21
 #define BUTTON_B 38
 
+// NEW: Edge events queued by the button ISRs (power of two)
+#define INPUT_QUEUE_SIZE 32
+// Events handed to the game per update()
+#define INPUT_FRAME_EVENTS 16
+
 enum class Button {
     UP,
     DOWN,
@@ -16,23 +22,105 @@ enum class Button {
     B
 };
 
+// NEW: What happened to a button
+enum class InputEventType : uint8_t {
+    PRESS,
+    RELEASE,
+    HOLD,       // Held for INPUT_HOLD_THRESHOLD_MS (once per press)
+    REPEAT      // Every INPUT_REPEAT_DELAY_MS after that while still held
+};
+
+struct InputEvent {
+    uint32_t timeUs;    // micros() when the edge was seen
+    Button button;
+    InputEventType type;
+};
+
+// Buttons are read by GPIO interrupts instead of polling. Each ISR debounces
+// its own button (leading edge: the first edge counts, bounces within
+// INPUT_DEBOUNCE_MS are dropped) and pushes a timestamped event into a
+// single-producer / single-consumer ring. The GPIO ISRs share one interrupt
+// source, so they never run concurrently and count as one producer.
+//
+// update() drains the ring into this frame's event list and adds HOLD and
+// REPEAT events. States either walk the list with pollEvent() or ask
+// wasPressed(), which consumes that button's press so the same press is
+// never handled twice - other buttons are unaffected.
+//
+// While InputRecording replays a file, update() takes its events from there
+// and the real buttons are ignored; while it records, every update()'s
+// final event list goes to the file.
 class Input {
 private:
-    bool buttonStates[4];
-    bool previousButtonStates[4];
-    unsigned long lastDebounceTime;
-    static const unsigned long debounceDelay = 50;
-    
-    int getButtonPin(Button button);
+    struct ButtonState {
+        uint8_t pin;
+        volatile bool down;             // Debounced level as seen by the ISR
+        volatile uint32_t lastEdgeUs;   // Last accepted edge
+        volatile bool bounced;          // An edge was dropped inside the window
+        uint32_t pressedUs;             // Main-loop side: start of current press
+        uint32_t nextRepeatUs;
+        bool holdSent;
+    };
+
+    ButtonState buttons[4];
+    bool interruptsAttached;
+    bool replaying;     // NEW: Last update() came from an InputRecording
+
+    // ISR -> update() ring
+    InputEvent queue[INPUT_QUEUE_SIZE];
+    std::atomic<uint32_t> queueHead;    // Written by the ISR only
+    std::atomic<uint32_t> queueTail;    // Written by update() only
+    volatile uint32_t droppedEvents;
+
+    // This frame's events
+    InputEvent frameEvents[INPUT_FRAME_EVENTS];
+    bool frameConsumed[INPUT_FRAME_EVENTS];
+    int frameCount;
+    int frameCursor;
+
+    static Input* instance;
+
+    static void IRAM_ATTR isrUp();
+    static void IRAM_ATTR isrDown();
+    static void IRAM_ATTR isrA();
+    static void IRAM_ATTR isrB();
+    void IRAM_ATTR handleEdge(int index);
+    void IRAM_ATTR pushEvent(uint32_t timeUs, int index, InputEventType type);
+
+    void attachInterrupts();
+    void resyncButton(int index, uint32_t nowUs);
+    void readLevels();
+    void updateFromReplay();
+    void addFrameEvent(const InputEvent& event);
+    bool consume(Button button, InputEventType type);
     int getButtonIndex(Button button);
 
 public:
     Input();
     void init();
     void update();
-    
-    // Check if button was just pressed this frame (press event)
+
+    // Check if button was just pressed this frame (press event). Consumes it.
     bool wasPressed(Button button);
+    // NEW: Any button pressed this frame (consumes all of this frame's presses)
+    bool wasAnyPressed();
+    bool wasHeld(Button button);
+    bool wasRepeated(Button button);
+    bool isDown(Button button) const;
+
+    // NEW: Walk this frame's unconsumed events in order; marks each consumed
+    bool pollEvent(InputEvent& event);
+
+    // NEW: Any button down as of the last update() (frame scheduler idling)
+    bool anyHeld() const;
+
+    // NEW: Light sleep reuses the button pins as wakeup sources, which takes
+    // over their interrupt configuration. Detach before, re-attach after
+    // (this also picks up the press that woke us).
+    void suspendInterrupts();
+    void resumeInterrupts();
+
+    uint32_t getDroppedEvents() const { return droppedEvents; }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,303 @@
+#include "InputRecording.h"
+#include "../utils/Rng.h"
+#include "../debug/Log.h"
+#include <LittleFS.h>
+#include <string.h>
+
+#define HEADER_SIZE 12
+// Worst-case record: two 5-byte varints, tag, count, a full frame of events
+#define RECORD_MAX (5 + 5 + 1 + 1 + INPUT_FRAME_EVENTS)
+#define DUMP_BYTES_PER_LINE 32
+
+bool InputRecording::mounted = false;
+bool InputRecording::recording = false;
+bool InputRecording::replaying = false;
+bool InputRecording::realtime = false;
+uint32_t InputRecording::frame = 0;
+uint32_t InputRecording::lastFrame = 0;
+uint32_t InputRecording::startMs = 0;
+uint32_t InputRecording::lastMs = 0;
+uint32_t InputRecording::recordCount = 0;
+uint32_t InputRecording::eventCount = 0;
+void (*InputRecording::replayListener)() = nullptr;
+
+static File file;
+
+// Replay lookahead: the next record, applied once its update comes around
+static bool pendingValid = false;
+static uint32_t pendingFrame = 0;
+static uint8_t pendingTag = 0;
+static uint8_t pendingPayload[1 + INPUT_FRAME_EVENTS];
+
+static int putVarint(uint8_t* out, uint32_t value) {
+    int n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+static void putU32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+static uint32_t getU32(const uint8_t* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+bool InputRecording::mount() {
+    if (mounted) return true;
+    // First boot on a blank partition formats it
+    mounted = LittleFS.begin(true);
+    if (!mounted) {
+        LOG_ERROR(REPLAY, "LittleFS mount failed");
+    }
+    return mounted;
+}
+
+//============================================================================
+// RECORDING
+//============================================================================
+
+bool InputRecording::startRecording(const char* path) {
+    if (recording || replaying) {
+        LOG_WARN(REPLAY, "Already %s", recording ? "recording" : "replaying");
+        return false;
+    }
+    if (!mount()) return false;
+
+    file = LittleFS.open(path, "w");
+    if (!file) {
+        LOG_ERROR(REPLAY, "Can't create %s", path);
+        return false;
+    }
+
+    uint8_t header[HEADER_SIZE] = {0};
+    memcpy(header, INPUT_RECORDING_MAGIC, 4);
+    header[4] = INPUT_RECORDING_VERSION;
+    putU32(header + 8, Rng::getRunSeed());
+    file.write(header, HEADER_SIZE);
+    file.flush();
+
+    recording = true;
+    frame = 0;
+    lastFrame = 0;
+    startMs = millis();
+    lastMs = 0;
+    recordCount = 0;
+    LOG_INFO(REPLAY, "Recording input to %s", path);
+    return true;
+}
+
+void InputRecording::writeRecord(InputRecordTag tag, const uint8_t* payload, int length) {
+    uint8_t record[RECORD_MAX];
+    uint32_t ms = millis() - startMs;
+
+    int n = putVarint(record, frame - lastFrame);
+    n += putVarint(record + n, ms - lastMs);
+    record[n++] = tag;
+    if (length > 0) {
+        memcpy(record + n, payload, length);
+        n += length;
+    }
+
+    // Records only come with button activity, so flushing each one is cheap
+    // and a crash or power cut keeps everything up to it
+    file.write(record, n);
+    file.flush();
+
+    lastFrame = frame;
+    lastMs = ms;
+    recordCount++;
+}
+
+void InputRecording::recordFrame(const InputEvent* events, int count) {
+    frame++;
+    if (count == 0) return;
+
+    uint8_t payload[1 + INPUT_FRAME_EVENTS];
+    payload[0] = (uint8_t)count;
+    for (int i = 0; i < count; i++) {
+        payload[1 + i] = (uint8_t)(((int)events[i].button << 2) | (int)events[i].type);
+    }
+    writeRecord(INPUT_RECORD_EVENTS, payload, 1 + count);
+}
+
+void InputRecording::noteRunSeed(uint32_t seed) {
+    if (!recording) return;
+    uint8_t payload[4];
+    putU32(payload, seed);
+    writeRecord(INPUT_RECORD_SEED, payload, 4);
+}
+
+//============================================================================
+// REPLAY
+//============================================================================
+
+static bool readVarint(uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = file.read();
+        if (byte < 0) return false;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+// Loads the next record into the lookahead; false at the end of the file
+static bool readNextRecord() {
+    pendingValid = false;
+
+    uint32_t frameDelta;
+    uint32_t msDelta;
+    if (!readVarint(frameDelta) || !readVarint(msDelta)) return false;
+    int tag = file.read();
+
+    switch (tag) {
+        case INPUT_RECORD_EVENTS: {
+            int count = file.read();
+            if (count < 0 || count > INPUT_FRAME_EVENTS) return false;
+            pendingPayload[0] = (uint8_t)count;
+            if ((int)file.read(pendingPayload + 1, count) != count) return false;
+            break;
+        }
+        case INPUT_RECORD_SEED:
+            if (file.read(pendingPayload, 4) != 4) return false;
+            break;
+        case INPUT_RECORD_END:
+            break;
+        default:
+            return false;
+    }
+
+    pendingFrame += frameDelta;
+    pendingTag = (uint8_t)tag;
+    pendingValid = true;
+    return true;
+}
+
+bool InputRecording::startReplay(bool atRealtime, const char* path) {
+    if (recording || replaying) {
+        LOG_WARN(REPLAY, "Already %s", recording ? "recording" : "replaying");
+        return false;
+    }
+    if (!mount()) return false;
+
+    file = LittleFS.open(path, "r");
+    if (!file) {
+        LOG_ERROR(REPLAY, "Can't open %s", path);
+        return false;
+    }
+
+    uint8_t header[HEADER_SIZE];
+    if (file.read(header, HEADER_SIZE) != HEADER_SIZE || memcmp(header, INPUT_RECORDING_MAGIC, 4) != 0 ||
+        header[4] != INPUT_RECORDING_VERSION) {
+        LOG_ERROR(REPLAY, "%s is not an input recording", path);
+        file.close();
+        return false;
+    }
+
+    replaying = true;
+    realtime = atRealtime;
+    frame = 0;
+    pendingFrame = 0;
+    recordCount = 0;
+    eventCount = 0;
+    readNextRecord();
+    LOG_INFO(REPLAY, "Replaying %s (%lu bytes, seed %lu at start, %s)", path, (unsigned long)file.size(),
+             (unsigned long)getU32(header + 8), realtime ? "real time" : "full speed");
+    return true;
+}
+
+int InputRecording::replayFrame(InputEvent* events, int maxEvents) {
+    frame++;
+    int count = 0;
+    uint32_t now = micros();
+
+    while (replaying && pendingValid && pendingFrame <= frame) {
+        switch (pendingTag) {
+            case INPUT_RECORD_EVENTS:
+                if (replayListener) replayListener();
+                for (int i = 0; i < pendingPayload[0] && count < maxEvents; i++) {
+                    uint8_t packed = pendingPayload[1 + i];
+                    events[count++] = {now, (Button)(packed >> 2), (InputEventType)(packed & 0x03)};
+                    eventCount++;
+                }
+                break;
+            case INPUT_RECORD_SEED:
+                Rng::queueRunSeed(getU32(pendingPayload));
+                break;
+            case INPUT_RECORD_END:
+                stop();
+                return count;
+        }
+        recordCount++;
+        if (!readNextRecord()) {
+            // Recording cut short (no end record): stop after its last event
+            stop();
+        }
+    }
+    return count;
+}
+
+//============================================================================
+// CONTROL
+//============================================================================
+
+void InputRecording::stop() {
+    if (recording) {
+        writeRecord(INPUT_RECORD_END, nullptr, 0);
+        file.close();
+        recording = false;
+        LOG_INFO(REPLAY, "Recording stopped: %lu updates, %lu records, %lu ms", (unsigned long)frame,
+                 (unsigned long)recordCount, (unsigned long)lastMs);
+    } else if (replaying) {
+        file.close();
+        replaying = false;
+        pendingValid = false;
+        LOG_INFO(REPLAY, "Replay finished: %lu updates, %lu records", (unsigned long)frame,
+                 (unsigned long)recordCount);
+    }
+}
+
+// Format (one line each):
+//   === INPUT BEGIN bytes=N ===
+//   R <up to 64 hex digits>  the file, 32 bytes per line
+//   === INPUT END ===
+void InputRecording::dump(const char* path) {
+    static const char hexDigits[] = "0123456789abcdef";
+    if (!mount()) return;
+
+    File in = LittleFS.open(path, "r");
+    if (!in) {
+        LOG_WARN(REPLAY, "No recording at %s", path);
+        return;
+    }
+
+    Log::flush();  // Keep queued log lines ahead of the dump
+    char line[8 + DUMP_BYTES_PER_LINE * 2];
+    snprintf(line, sizeof(line), "%s bytes=%lu ===", INPUT_DUMP_BEGIN, (unsigned long)in.size());
+    Serial.println(line);
+
+    uint8_t bytes[DUMP_BYTES_PER_LINE];
+    size_t n;
+    while ((n = in.read(bytes, DUMP_BYTES_PER_LINE)) > 0) {
+        line[0] = 'R';
+        line[1] = ' ';
+        for (size_t b = 0; b < n; b++) {
+            line[2 + b * 2] = hexDigits[bytes[b] >> 4];
+            line[3 + b * 2] = hexDigits[bytes[b] & 0x0F];
+        }
+        line[2 + n * 2] = '\0';
+        Serial.println(line);
+    }
+    in.close();
+
+    Serial.println(INPUT_DUMP_END);
+    Serial.flush();
+}
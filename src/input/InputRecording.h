@@ -0,0 +1,91 @@
+#ifndef INPUT_RECORDING_H
+#define INPUT_RECORDING_H
+
+#include "Input.h"
+
+// Records the button events Input::update() hands to the game, plus every
+// run seed, into a small binary file (LittleFS on the device, a plain file
+// under --fs on the host), and plays such a file back through Input in
+// place of the buttons. Events are keyed to the update() they arrived in,
+// and everything the game does is a function of its events and seeds, so a
+// replay walks the same screens and the same fights as the original session
+// - on the device or on the host build.
+//
+//   w - start recording     x - stop recording/replay
+//   y - replay in real time f - replay at full speed
+//   e - dump the file as hex lines
+//
+// Real time keeps the normal frame pacing (handy for frame-time profiling
+// with a repeatable workload); full speed skips the frame budget entirely.
+// Start both the recording and the replay on the title screen of a fresh
+// boot, or build with -D INPUT_RECORD_AT_BOOT=1 to record from setup().
+// On the host, e.g.
+//   program --console w --keys AA.A...     (writes ./input.rec)
+//   program --console f --frames 5000
+//
+// A dump captured from the device serial log turns back into a file with
+//   sed -n 's/^R //p' log.txt | xxd -r -p > input.rec
+
+#define INPUT_RECORDING_PATH "/input.rec"
+
+// File layout, all integers little endian:
+//   header: "IREC", version, 3 reserved bytes, run seed at the start (u32)
+//   record: varint update delta, varint ms delta, tag, payload
+#define INPUT_RECORDING_MAGIC   "IREC"
+#define INPUT_RECORDING_VERSION 1
+
+// Dump framing
+#define INPUT_DUMP_BEGIN "=== INPUT BEGIN"
+#define INPUT_DUMP_END   "=== INPUT END ==="
+
+enum InputRecordTag : uint8_t {
+    INPUT_RECORD_EVENTS = 'E',  // count, then one (button << 2 | type) byte each
+    INPUT_RECORD_SEED = 'S',    // u32 run seed from Rng::startRun()
+    INPUT_RECORD_END = 'X'      // Recording stopped
+};
+
+class InputRecording {
+private:
+    static bool mounted;
+    static bool recording;
+    static bool replaying;
+    static bool realtime;
+    static uint32_t frame;          // update() calls since start
+    static uint32_t lastFrame;      // Of the last record written/read
+    static uint32_t startMs;
+    static uint32_t lastMs;
+    static uint32_t recordCount;
+    static uint32_t eventCount;
+    static void (*replayListener)();
+
+    static bool mount();
+    static void writeRecord(InputRecordTag tag, const uint8_t* payload, int length);
+
+public:
+    static bool startRecording(const char* path = INPUT_RECORDING_PATH);
+    static bool startReplay(bool atRealtime, const char* path = INPUT_RECORDING_PATH);
+    static void stop();
+
+    static bool isRecording() { return recording; }
+    static bool isReplaying() { return replaying; }
+    // Replaying with the frame budget skipped
+    static bool isFullSpeed() { return replaying && !realtime; }
+    // Replay progress, for tools that act on replayed input (golden frames).
+    // The listener runs right before each batch of events is handed to
+    // Input, i.e. with the screen as it was when the buttons were pressed -
+    // including screens that block in their own input loop.
+    static uint32_t getEventsReplayed() { return eventCount; }
+    static void setReplayListener(void (*listener)()) { replayListener = listener; }
+
+    static void dump(const char* path = INPUT_RECORDING_PATH);
+
+    // Input::update() hooks, once per call: record this update's events, or
+    // fill in the recorded ones (returns the count)
+    static void recordFrame(const InputEvent* events, int count);
+    static int replayFrame(InputEvent* events, int maxEvents);
+
+    // Rng::startRun() picked a seed; recorded so the replay gets it back
+    static void noteRunSeed(uint32_t seed);
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "item_types/consumable.h"
 #include "item_types/equipment.h"
 #include "../entities/player.h"
+#include "../debug/Log.h"
 
 // Constructor
 Inventory::Inventory(int slots) {
@@ -18,7 +19,7 @@ bool Inventory::addItem(Item* item, int quantity) {
     
     // Check if we have space
     if (!hasSpace(item, quantity)) {
-        Serial.println("Inventory is full!");
+        LOG_INFO(ITEM, "Inventory is full!");
         return false;
     }
     
@@ -27,14 +28,14 @@ bool Inventory::addItem(Item* item, int quantity) {
         int existingIndex = findItemIndex(item->getID());
         if (existingIndex != -1) {
             items[existingIndex].quantity += quantity;
-            Serial.println("Added " + String(quantity) + "x " + item->getName() + " to inventory.");
+            LOG_INFO(ITEM, "Added %dx %s to inventory.", quantity, item->getName().c_str());
             return true;
         }
     }
     
     // Add as new slot
     items.push_back(InventorySlot(item, quantity));
-    Serial.println("Added " + String(quantity) + "x " + item->getName() + " to inventory.");
+    LOG_INFO(ITEM, "Added %dx %s to inventory.", quantity, item->getName().c_str());
     return true;
 }
 
@@ -78,7 +79,7 @@ Item* Inventory::getItemByID(int itemID) const {
 // Use item from inventory
 bool Inventory::useItem(int inventoryIndex, Player* player) {
     if (inventoryIndex < 0 || inventoryIndex >= items.size()) {
-        Serial.println("Invalid item selection!");
+        LOG_INFO(ITEM, "Invalid item selection!");
         return false;
     }
     
@@ -108,7 +109,7 @@ bool Inventory::useItemByID(int itemID, Player* player) {
         return useItem(index, player);
     }
     
-    Serial.println("Item not found in inventory!");
+    LOG_INFO(ITEM, "Item not found in inventory!");
     return false;
 }
 
@@ -180,7 +181,7 @@ bool Inventory::equipOrUnequipItem(Equipment* equipment, Player* player) {
     // If there's already something equipped in this slot, unequip it first
     if (*currentSlot != nullptr) {
         (*currentSlot)->unequip(player);
-        Serial.println("Unequipped " + (*currentSlot)->getName() + " to make room.");
+        LOG_INFO(ITEM, "Unequipped %s to make room.", (*currentSlot)->getName().c_str());
         *currentSlot = nullptr; // Clear the slot
     }
     
@@ -227,11 +228,11 @@ Equipment* Inventory::getEquippedAccessory() const {
 
 // Display inventory
 void Inventory::displayInventory() const {
-    Serial.println("=== INVENTORY ===");
-    Serial.println("Slots used: " + String(getItemCount()) + "/" + String(maxSlots));
+    LOG_INFO(ITEM, "=== INVENTORY ===");
+    LOG_INFO(ITEM, "Slots used: %d/%d", getItemCount(), maxSlots);
     
     if (items.empty()) {
-        Serial.println("Inventory is empty.");
+        LOG_INFO(ITEM, "Inventory is empty.");
         return;
     }
     
@@ -240,18 +241,18 @@ void Inventory::displayInventory() const {
         int qty = items[i].quantity;
         
         if (qty > 1) {
-            Serial.println(String(i + 1) + ". " + item->getDisplayName() + " (x" + String(qty) + ")");
+            LOG_INFO(ITEM, "%d. %s (x%d)", i + 1, item->getDisplayName().c_str(), qty);
         } else {
-            Serial.println(String(i + 1) + ". " + item->getDisplayName());
+            LOG_INFO(ITEM, "%d. %s", i + 1, item->getDisplayName().c_str());
         }
-        Serial.println("   " + item->getUseDescription());
-        Serial.println("   Value: " + String(item->getGoldCost()) + " gold");
+        LOG_INFO(ITEM, "   %s", item->getUseDescription().c_str());
+        LOG_INFO(ITEM, "   Value: %d gold", item->getGoldCost());
     }
 }
 
 // Display only consumables
 void Inventory::displayConsumables() const {
-    Serial.println("=== CONSUMABLES ===");
+    LOG_INFO(ITEM, "=== CONSUMABLES ===");
     
     bool foundConsumables = false;
     for (int i = 0; i < items.size(); i++) {
@@ -261,48 +262,48 @@ void Inventory::displayConsumables() const {
             foundConsumables = true;
             
             if (qty > 1) {
-                Serial.println(String(i + 1) + ". " + item->getName() + " (x" + String(qty) + ")");
+                LOG_INFO(ITEM, "%d. %s (x%d)", i + 1, item->getName().c_str(), qty);
             } else {
-                Serial.println(String(i + 1) + ". " + item->getName());
+                LOG_INFO(ITEM, "%d. %s", i + 1, item->getName().c_str());
             }
-            Serial.println("   " + item->getUseDescription());
+            LOG_INFO(ITEM, "   %s", item->getUseDescription().c_str());
         }
     }
     
     if (!foundConsumables) {
-        Serial.println("No consumable items.");
+        LOG_INFO(ITEM, "No consumable items.");
     }
 }
 
 // Display equipped items
 void Inventory::displayEquipment() const {
-    Serial.println("=== EQUIPPED ITEMS ===");
+    LOG_INFO(ITEM, "=== EQUIPPED ITEMS ===");
     
     if (equippedWeapon) {
-        Serial.println("Weapon: " + equippedWeapon->getDisplayName());
-        Serial.println("  " + equippedWeapon->getStatsDescription());
+        LOG_INFO(ITEM, "Weapon: %s", equippedWeapon->getDisplayName().c_str());
+        LOG_INFO(ITEM, "  %s", equippedWeapon->getStatsDescription().c_str());
     } else {
-        Serial.println("Weapon: None");
+        LOG_INFO(ITEM, "Weapon: None");
     }
     
     if (equippedArmor) {
-        Serial.println("Armor: " + equippedArmor->getDisplayName());
-        Serial.println("  " + equippedArmor->getStatsDescription());
+        LOG_INFO(ITEM, "Armor: %s", equippedArmor->getDisplayName().c_str());
+        LOG_INFO(ITEM, "  %s", equippedArmor->getStatsDescription().c_str());
     } else {
-        Serial.println("Armor: None");
+        LOG_INFO(ITEM, "Armor: None");
     }
     
     if (equippedAccessory) {
-        Serial.println("Accessory: " + equippedAccessory->getDisplayName());
-        Serial.println("  " + equippedAccessory->getStatsDescription());
+        LOG_INFO(ITEM, "Accessory: %s", equippedAccessory->getDisplayName().c_str());
+        LOG_INFO(ITEM, "  %s", equippedAccessory->getStatsDescription().c_str());
     } else {
-        Serial.println("Accessory: None");
+        LOG_INFO(ITEM, "Accessory: None");
     }
 }
 
 // Get inventory status string
-String Inventory::getInventoryStatus() const {
-    return "Inventory: " + String(getItemCount()) + "/" + String(maxSlots) + " slots";
+ItemText Inventory::getInventoryStatus() const {
+    return ItemText::format("Inventory: %d/%d slots", getItemCount(), maxSlots);
 }
 
 // Check if inventory has space for item
@@ -67,7 +67,7 @@ public:
     // Display
     void displayInventory() const;
     void displayConsumables() const;
-    String getInventoryStatus() const;
+    ItemText getInventoryStatus() const;
     
     // Utility
     void sortInventory(); // Sort by item type and rarity
@@ -1,7 +1,7 @@
 #include "item.h"
 
 // Constructor
-Item::Item(int id, String itemName, ItemType itemType) {
+Item::Item(int id, FlashString itemName, ItemType itemType) {
     itemID = id;
     name = itemName;
     type = itemType;
@@ -17,11 +17,11 @@ int Item::getID() const {
     return itemID;
 }
 
-String Item::getName() const {
+FlashString Item::getName() const {
     return name;
 }
 
-String Item::getDescription() const {
+FlashString Item::getDescription() const {
     return description;
 }
 
@@ -89,7 +89,7 @@ void Item::setRarity(ItemRarity newRarity) {
     sellValue = goldCost / 2;
 }
 
-String Item::getRarityName() const {
+const char* Item::getRarityName() const {
     switch(rarity) {
         case RARITY_COMMON:
             return "Common";
@@ -105,27 +105,27 @@ String Item::getRarityName() const {
 }
 
 // Description system
-void Item::setDescription(String desc) {
+void Item::setDescription(FlashString desc) {
     description = desc;
 }
 
 // Display helpers
-String Item::getDisplayName() const {
+ItemText Item::getDisplayName() const {
     // For now, just return name with rarity
     // Later this could include color codes for display
-    return "[" + getRarityName() + "] " + name;
+    return ItemText::format("[%s] %s", getRarityName(), name.c_str());
 }
 
-String Item::getFullDescription() const {
-    String fullDesc = getDisplayName() + "\n";
-    fullDesc += description + "\n";
-    fullDesc += "Value: " + String(goldCost) + " gold";
+ItemFullText Item::getFullDescription() const {
+    ItemFullText fullDesc;
+    fullDesc.appendf("%s\n%s\n", getDisplayName().c_str(), description.c_str());
+    fullDesc.appendf("Value: %d gold", goldCost);
     
     if (sellValue > 0) {
-        fullDesc += " (Sells for " + String(sellValue) + " gold)";
+        fullDesc.appendf(" (Sells for %d gold)", sellValue);
     }
     
-    fullDesc += "\n" + getUseDescription();
+    fullDesc.appendf("\n%s", getUseDescription().c_str());
     
     return fullDesc;
 }
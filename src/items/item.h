@@ -2,6 +2,14 @@
 #define ITEM_H
 
 #include <Arduino.h>
+#include "../utils/FixedString.h"
+
+// Generated item text: one line, and the multi-line full description
+#define ITEM_TEXT_MAX 64
+#define ITEM_FULL_TEXT_MAX 256
+
+typedef FixedString<ITEM_TEXT_MAX> ItemText;
+typedef FixedString<ITEM_FULL_TEXT_MAX> ItemFullText;
 
 // Forward declaration to avoid circular includes
 class Player;
@@ -21,8 +29,8 @@ enum ItemRarity {
 class Item {
 protected:
     int itemID;
-    String name;
-    String description;
+    FlashString name;
+    FlashString description;
     ItemType type;
     ItemRarity rarity;
     int goldCost;
@@ -31,12 +39,12 @@ protected:
     
 public:
     // Constructor
-    Item(int id, String itemName, ItemType itemType);
+    Item(int id, FlashString itemName, ItemType itemType);
     
     // Basic properties
     int getID() const;
-    String getName() const;
-    String getDescription() const;
+    FlashString getName() const;
+    FlashString getDescription() const;
     ItemType getType() const;
     ItemRarity getRarity() const;
     
@@ -52,18 +60,18 @@ public:
     
     // Rarity system
     void setRarity(ItemRarity newRarity);
-    String getRarityName() const;
+    const char* getRarityName() const;
     
     // Description system
-    void setDescription(String desc);
+    void setDescription(FlashString desc);
     
     // Usage (pure virtual - must be implemented by subclasses)
     virtual bool use(Player* player) = 0;
-    virtual String getUseDescription() const = 0;
+    virtual ItemText getUseDescription() const = 0;
     
     // Display helpers
-    String getDisplayName() const;
-    String getFullDescription() const;
+    ItemText getDisplayName() const;
+    ItemFullText getFullDescription() const;
     
     // Virtual destructor for proper inheritance
     virtual ~Item();
@@ -1,9 +1,10 @@
 #include "consumable.h"
 #include "../../entities/player.h"
 #include "../../utils/constants.h"
+#include "../../debug/Log.h"
 
 // Base Consumable constructor
-Consumable::Consumable(int id, String name, ConsumableEffect consumableEffect, int value) 
+Consumable::Consumable(int id, FlashString name, ConsumableEffect consumableEffect, int value) 
     : Item(id, name, ITEM_CONSUMABLE) {
     effect = consumableEffect;
     effectValue = value;
@@ -22,12 +23,12 @@ bool Consumable::use(Player* player) {
                 int maxHP = player->getMaxHP();
                 
                 if (currentHP >= maxHP) {
-                    Serial.println("Already at full health!");
+                    LOG_INFO(ITEM, "Already at full health!");
                     return false; // Can't use if already at full health
                 }
                 
                 player->heal(effectValue);
-                Serial.println("Restored " + String(effectValue) + " HP!");
+                LOG_INFO(ITEM, "Restored %d HP!", effectValue);
                 return true;
             }
             break;
@@ -36,17 +37,17 @@ bool Consumable::use(Player* player) {
         case EFFECT_BOOST_DEFENSE: 
         case EFFECT_BOOST_SPEED:
             // These will be handled by specific subclass implementations
-            Serial.println("Used " + getName() + "!");
+            LOG_INFO(ITEM, "Used %s!", getName().c_str());
             return true;
             
         default:
-            Serial.println("Unknown consumable effect!");
+            LOG_INFO(ITEM, "Unknown consumable effect!");
             return false;
     }
 }
 
-String Consumable::getUseDescription() const {
-    return "Use: " + getEffectDescription();
+ItemText Consumable::getUseDescription() const {
+    return ItemText::format("Use: %s", getEffectDescription().c_str());
 }
 
 // Consumable-specific getters
@@ -67,16 +68,16 @@ void Consumable::setEffectDuration(int duration) {
 }
 
 // Helper method for effect descriptions
-String Consumable::getEffectDescription() const {
+ItemText Consumable::getEffectDescription() const {
     switch(effect) {
         case EFFECT_HEAL_HP:
-            return "Restore " + String(effectValue) + " HP";
+            return ItemText::format("Restore %d HP", effectValue);
         case EFFECT_BOOST_ATTACK:
-            return "Increase Attack by " + String(effectValue);
+            return ItemText::format("Increase Attack by %d", effectValue);
         case EFFECT_BOOST_DEFENSE:
-            return "Increase Defense by " + String(effectValue);
+            return ItemText::format("Increase Defense by %d", effectValue);
         case EFFECT_BOOST_SPEED:
-            return "Increase Speed by " + String(effectValue);
+            return ItemText::format("Increase Speed by %d", effectValue);
         default:
             return "Unknown effect";
     }
@@ -113,8 +114,8 @@ bool StrengthPotion::use(Player* player) {
     
     // Add temporary equipment bonus (this integrates with existing system!)
     player->addEquipmentBonus(0, effectValue, 0, 0);
-    Serial.println("Your muscles bulge with power! (+" + String(effectValue) + " Attack)");
-    Serial.println("Effect will last for " + String(effectDuration) + " rooms.");
+    LOG_INFO(ITEM, "Your muscles bulge with power! (+%d Attack)", effectValue);
+    LOG_INFO(ITEM, "Effect will last for %d rooms.", effectDuration);
     return true;
 }
 
@@ -130,8 +131,8 @@ bool DefensePotion::use(Player* player) {
     if (!player) return false;
     
     player->addEquipmentBonus(0, 0, effectValue, 0);
-    Serial.println("Your skin hardens like steel! (+" + String(effectValue) + " Defense)");
-    Serial.println("Effect will last for " + String(effectDuration) + " rooms.");
+    LOG_INFO(ITEM, "Your skin hardens like steel! (+%d Defense)", effectValue);
+    LOG_INFO(ITEM, "Effect will last for %d rooms.", effectDuration);
     return true;
 }
 
@@ -147,7 +148,7 @@ bool SpeedPotion::use(Player* player) {
     if (!player) return false;
     
     player->addEquipmentBonus(0, 0, 0, effectValue);
-    Serial.println("You feel incredibly swift! (+" + String(effectValue) + " Speed)");
-    Serial.println("Effect will last for " + String(effectDuration) + " rooms.");
+    LOG_INFO(ITEM, "You feel incredibly swift! (+%d Speed)", effectValue);
+    LOG_INFO(ITEM, "Effect will last for %d rooms.", effectDuration);
     return true;
 }
\ No newline at end of file
@@ -21,11 +21,11 @@ protected:
     
 public:
     // Constructor
-    Consumable(int id, String name, ConsumableEffect consumableEffect, int value);
+    Consumable(int id, FlashString name, ConsumableEffect consumableEffect, int value);
     
     // Item interface implementation
     bool use(Player* player) override;
-    String getUseDescription() const override;
+    ItemText getUseDescription() const override;
     
     // Consumable-specific properties
     ConsumableEffect getEffect() const;
@@ -34,7 +34,7 @@ public:
     void setEffectDuration(int duration);
     
     // Helper methods
-    String getEffectDescription() const;
+    ItemText getEffectDescription() const;
 };
 
 // ==============================================
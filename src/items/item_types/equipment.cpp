@@ -1,9 +1,10 @@
 #include "equipment.h"
 #include "../../entities/player.h"
 #include "../../utils/constants.h"
+#include "../../debug/Log.h"
 
 // Base Equipment constructor
-Equipment::Equipment(int id, String name, EquipmentSlot equipSlot) 
+Equipment::Equipment(int id, FlashString name, EquipmentSlot equipSlot) 
     : Item(id, name, ITEM_EQUIPMENT) {
     slot = equipSlot;
     hpBonus = 0;
@@ -25,11 +26,11 @@ bool Equipment::use(Player* player) {
     }
 }
 
-String Equipment::getUseDescription() const {
+ItemText Equipment::getUseDescription() const {
     if (isEquipped) {
-        return "Use: Unequip " + getSlotName();
+        return ItemText::format("Use: Unequip %s", getSlotName());
     } else {
-        return "Use: Equip " + getSlotName() + " - " + getStatsDescription();
+        return ItemText::format("Use: Equip %s - %s", getSlotName(), getStatsDescription().c_str());
     }
 }
 
@@ -70,34 +71,34 @@ void Equipment::setStatBonuses(int hp, int atk, int def, int spd) {
     speedBonus = spd;
 }
 
-String Equipment::getStatsDescription() const {
-    String stats = "";
+ItemText Equipment::getStatsDescription() const {
+    ItemText stats;
     bool hasStats = false;
     
     if (hpBonus > 0) {
-        stats += "+" + String(hpBonus) + " HP";
+        stats.appendf("+%d HP", hpBonus);
         hasStats = true;
     }
     if (attackBonus > 0) {
         if (hasStats) stats += ", ";
-        stats += "+" + String(attackBonus) + " ATK";
+        stats.appendf("+%d ATK", attackBonus);
         hasStats = true;
     }
     if (defenseBonus > 0) {
         if (hasStats) stats += ", ";
-        stats += "+" + String(defenseBonus) + " DEF";
+        stats.appendf("+%d DEF", defenseBonus);
         hasStats = true;
     }
     if (speedBonus > 0) {
         if (hasStats) stats += ", ";
-        stats += "+" + String(speedBonus) + " SPD";
+        stats.appendf("+%d SPD", speedBonus);
         hasStats = true;
     }
     
-    return hasStats ? stats : "No stat bonuses";
+    return hasStats ? stats : ItemText("No stat bonuses");
 }
 
-String Equipment::getSlotName() const {
+const char* Equipment::getSlotName() const {
     switch(slot) {
         case SLOT_WEAPON:
             return "Weapon";
@@ -118,7 +119,7 @@ bool Equipment::equip(Player* player) {
     player->addEquipmentBonus(hpBonus, attackBonus, defenseBonus, speedBonus);
     setEquipped(true);
     
-    Serial.println("Equipped " + getName() + "! (" + getStatsDescription() + ")");
+    LOG_INFO(ITEM, "Equipped %s! (%s)", getName().c_str(), getStatsDescription().c_str());
     return true;
 }
 
@@ -130,7 +131,7 @@ bool Equipment::unequip(Player* player) {
     player->removeEquipmentBonus(hpBonus, attackBonus, defenseBonus, speedBonus);
     setEquipped(false);
     
-    Serial.println("Unequipped " + getName() + ".");
+    LOG_INFO(ITEM, "Unequipped %s.", getName().c_str());
     return true;
 }
 
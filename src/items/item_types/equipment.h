@@ -23,11 +23,11 @@ protected:
     
 public:
     // Constructor
-    Equipment(int id, String name, EquipmentSlot equipSlot);
+    Equipment(int id, FlashString name, EquipmentSlot equipSlot);
     
     // Item interface implementation
     bool use(Player* player) override;
-    String getUseDescription() const override;
+    ItemText getUseDescription() const override;
     
     // Equipment-specific properties
     EquipmentSlot getSlot() const;
@@ -41,8 +41,8 @@ public:
     
     // Stat management
     void setStatBonuses(int hp, int atk, int def, int spd);
-    String getStatsDescription() const;
-    String getSlotName() const;
+    ItemText getStatsDescription() const;
+    const char* getSlotName() const;
     
     // Equipment actions
     bool equip(Player* player);
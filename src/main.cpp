@@ -1,8 +1,14 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include "input/Input.h"
+#include "input/InputRecording.h"
 #include "graphics/Display.h"
 #include "game/GameStateManager.h"
+#include "game/FrameScheduler.h"
+#include "debug/FrameProfiler.h"
+#include "debug/Log.h"
+#include "debug/Trace.h"
+#include "debug/DebugConsole.h"
 
 // Core systems
 Input input;
@@ -11,10 +17,14 @@ Display display;
 // Game state manager handles everything
 GameStateManager gameState(&display, &input);
 
+// Paces loop() and idles when nothing is happening
+FrameScheduler scheduler(&display, &input);
+
 void setup() {
     Serial.begin(115200);
     delay(2000);
-    Serial.println("=== STARTING GAME INITIALIZATION ===");  // ADD THIS
+    LOG_INFO(MAIN, "=== STARTING GAME INITIALIZATION ===");  // ADD THIS
+    Trace::init();
     
     // Initialize hardware
     display.init();
@@ -22,16 +32,46 @@ void setup() {
     
     // Initialize game
     gameState.initialize();
+    scheduler.init();
+
+#if INPUT_RECORD_AT_BOOT
+    InputRecording::startRecording();
+#endif
     
-    Serial.println("Setup complete!");
+    LOG_INFO(MAIN, "Setup complete!");
 }
 
 void loop() {
+    scheduler.beginFrame();
+    DebugConsole::poll();
+    
+#if FRAME_PROFILER
+    FrameProfiler::beginFrame();
+    int profiledState = (int)gameState.getCurrentStateId();
+#endif
+
     // Update input
     input.update();
     
     // Update game state
     gameState.update();
     
-    delay(10);
+#if FRAME_PROFILER
+    FrameProfiler::endUpdate();
+    FrameProfiler::drawOverlay(&display);
+#endif
+
+    // Start streaming this frame's changes to the panel. The transfer runs
+    // on DMA through the frame delay and into the next update.
+    display.present();
+    
+#if FRAME_PROFILER
+    FrameProfiler::endFrame(profiledState, display.getBytesFlushedLastFrame());
+#endif
+
+    // Hand queued log lines to the UART (whatever its FIFO takes)
+    Log::pump();
+
+    // Sleep whatever is left of the frame budget
+    scheduler.endFrame();
 }
\ No newline at end of file
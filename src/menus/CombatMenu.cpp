@@ -1,52 +1,35 @@
 #include "CombatMenu.h"
 
-CombatMenu::CombatMenu(Display* disp, Input* inp) : MenuBase(disp, inp, 3) {
-    lastRenderedSelection = -1;
+CombatMenu::CombatMenu(Display* disp, Input* inp)
+    : MenuBase(disp, inp, 3, 0, 250, SCREEN_WIDTH, 70),  // Bottom menu area (reserve top for sprites)
+      options(10, 260, 50, 0) {
     needsRedraw = true;
+    
+    for (int i = 0; i < maxOptions; i++) {
+        options.setItem(i, menuOptions[i], TFT_WHITE);
+    }
+    options.setHighlightBox(44, 20, TFT_WHITE, TFT_BLACK);
+    
+    panel.setFilled(true);
+    panel.add(&options);
 }
 
 void CombatMenu::activate() {
     MenuBase::activate();
-    lastRenderedSelection = -1;
     needsRedraw = true;
 }
 
 void CombatMenu::render() {
     if (!isActive) return;
     
-    // Only redraw if selection changed or forced redraw
-    if (selectedOption != lastRenderedSelection || needsRedraw) {
-        drawMenuArea();
-        lastRenderedSelection = selectedOption;
+    if (needsRedraw) {
+        panel.invalidate();
         needsRedraw = false;
     }
-}
-
-void CombatMenu::clearMenuArea() {
-    // Clear only the bottom menu area (reserve top for sprites)
-    display->fillRect(0, 250, Display::WIDTH, 70, TFT_BLACK);
-}
-
-void CombatMenu::drawMenuArea() {
-    clearMenuArea();
-    
-    // Menu positioned at bottom of screen
-    int yStart = 260;
-    int xSpacing = 50;
     
-    for (int i = 0; i < maxOptions; i++) {
-        int xPos = 10 + (i * xSpacing);
-        
-        // Highlight selected option
-        if (i == selectedOption) {
-            // Draw selection box
-            display->fillRect(xPos - 2, yStart - 2, 44, 20, TFT_WHITE);
-            display->drawText(menuOptions[i], xPos, yStart, TFT_BLACK, 1);
-        } else {
-            // Draw unselected option
-            display->drawText(menuOptions[i], xPos, yStart, TFT_WHITE, 1);
-        }
-    }
+    // Only the boxes whose highlight changed are repainted
+    options.select(selectedOption);
+    panel.render(display);
 }
 
 MenuResult CombatMenu::handleInput() {
@@ -12,11 +12,10 @@ enum class CombatAction {
 class CombatMenu : public MenuBase {
 private:
     const char* menuOptions[3] = {"Attack", "Defend", "Item"};
-    int lastRenderedSelection;
     bool needsRedraw;
     
-    void drawMenuArea();
-    void clearMenuArea();
+    // NEW: Options as one horizontal list; the selected one is boxed
+    ListWidget options;
     
 public:
     CombatMenu(Display* disp, Input* inp);
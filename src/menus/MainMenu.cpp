@@ -1,16 +1,34 @@
-// src/menus/MainMenu.cpp - Fixed version with better state management
+// src/menus/MainMenu.cpp - Main menu built from retained widgets
 #include "MainMenu.h"
+#include "../debug/Log.h"
 
-MainMenu::MainMenu(Display* disp, Input* inp) : MenuBase(disp, inp, 3) {
+MainMenu::MainMenu(Display* disp, Input* inp)
+    : MenuBase(disp, inp, 3),
+      titleTop(30, 65, "ARCANE", TFT_SKYBLUE, 3),
+      titleBottom(20, 90, "DUNGEON", TFT_LIGHTGREY, 3),
+      options(0, 160, 0, 30, 2),  // Leave space on the right for the cursor
+      cursor(">", TFT_WHITE, 2),
+      navigateHint(0, 280, "UP/DOWN: Navigate"),
+      selectHint(0, 295, "A: Select") {
     // 3 options: Start Game, Settings, Credits
-    lastRenderedSelection = -1;
     needsRedraw = true;
+    
+    for (int i = 0; i < maxOptions; i++) {
+        options.setItem(i, menuOptions[i], TFT_WHITE);
+    }
+    options.layoutCursor(cursor, 130, 0);
+    
+    panel.add(&titleTop);
+    panel.add(&titleBottom);
+    panel.add(&options);
+    panel.add(&cursor);
+    panel.add(&navigateHint);
+    panel.add(&selectHint);
 }
 
 void MainMenu::activate() {
-    Serial.println("DEBUG: MainMenu::activate() called");
+    LOG_DEBUG(MENU, "MainMenu::activate() called");
     MenuBase::activate();
-    lastRenderedSelection = -1;
     needsRedraw = true;
 }
 
@@ -19,87 +37,15 @@ void MainMenu::render() {
         return;
     }
     
-    // Full redraw only when needed
+    cursor.select(selectedOption);
+    
+    // Take over the screen once, after that only the cursor repaints
     if (needsRedraw) {
-        drawFullMenu();
+        panel.show(display);
         needsRedraw = false;
-        lastRenderedSelection = selectedOption; // FIXED: Update tracking immediately
-    }
-    // Partial update when only selection changes
-    else if (selectedOption != lastRenderedSelection) {
-        updateMenuSelection();
-    }
-}
-
-void MainMenu::drawFullMenu() {
-    display->clear();
-    
-    // Draw static elements
-    drawTitle();
-    drawMenuOptions();
-    drawInstructions();
-    
-    // Draw initial cursor
-    drawMenuCursor(selectedOption);
-}
-
-void MainMenu::drawTitle() {
-    // Game title - centered and large
-    display->drawText("ARCANE", 30, 65, TFT_SKYBLUE, 3);
-    display->drawText("DUNGEON", 20, 90, TFT_LIGHTGREY, 3);
-    
-}
-
-void MainMenu::drawMenuOptions() {
-    // Menu options centered in the middle area
-    int yStart = 160;
-    int ySpacing = 30;
-    
-    for (int i = 0; i < maxOptions; i++) {
-        int yPos = yStart + (i * ySpacing);
-        int xPos = 0; // Leave space for cursor (was 35, now 50 for cursor space)
-        
-        // Draw menu option text (no highlighting here)
-        display->drawText(menuOptions[i], xPos, yPos, TFT_WHITE, 2);
-    }
-}
-
-void MainMenu::drawMenuCursor(int option) {
-    int yStart = 160;
-    int ySpacing = 30;
-    int yPos = yStart + (option * ySpacing);
-    // Draw yellow cursor arrow
-    display->drawText(">", 130, yPos, TFT_WHITE, 2);
-}
-
-void MainMenu::clearMenuCursor(int option) {
-    int yStart = 160;
-    int ySpacing = 30;
-    int yPos = yStart + (option * ySpacing);
-    
-    // Clear cursor area (slightly wider to ensure clean erase)
-    display->fillRect(130, yPos, 18, 16, TFT_BLACK);
-}
-
-void MainMenu::updateMenuSelection() {
-    // Clear old cursor
-    if (lastRenderedSelection >= 0 && lastRenderedSelection < maxOptions) {
-        clearMenuCursor(lastRenderedSelection);
+    } else {
+        panel.render(display);
     }
-    
-    // Draw new cursor
-    drawMenuCursor(selectedOption);
-    
-    // Update tracking
-    lastRenderedSelection = selectedOption;
-}
-
-void MainMenu::drawInstructions() {
-    // Instructions at bottom
-    int instructY = 280;
-    display->drawText("UP/DOWN: Navigate", 0, instructY, TFT_WHITE, 1);
-    instructY += 15;
-    display->drawText("A: Select", 0, instructY, TFT_WHITE, 1);
 }
 
 MenuResult MainMenu::handleInput() {
@@ -109,20 +55,20 @@ MenuResult MainMenu::handleInput() {
     
     // FIXED: Clear any corrupted selection state at the start
     if (selectionMade != -1) {
-        Serial.println("WARNING: MainMenu starting with unexpected selectionMade: " + String(selectionMade));
+        LOG_WARN(MENU, "MainMenu starting with unexpected selectionMade: %d", selectionMade);
         selectionMade = -1; // Clear it
     }
     
     // Handle navigation
     if (input->wasPressed(Button::UP)) {
-        Serial.println("DEBUG: MainMenu - UP button pressed");
+        LOG_DEBUG(MENU, "MainMenu - UP button pressed");
         moveSelectionUp();
         // Note: render() will handle the cursor update automatically
         return MenuResult::NONE;
     }
     
     if (input->wasPressed(Button::DOWN)) {
-        Serial.println("DEBUG: MainMenu - DOWN button pressed");
+        LOG_DEBUG(MENU, "MainMenu - DOWN button pressed");
         moveSelectionDown();
         // Note: render() will handle the cursor update automatically
         return MenuResult::NONE;
@@ -132,11 +78,11 @@ MenuResult MainMenu::handleInput() {
     if (input->wasPressed(Button::A)) {
         // FIXED: Validate selection is in valid range
         if (selectedOption >= 0 && selectedOption < maxOptions) {
-            Serial.println("DEBUG: MainMenu - A button pressed, making selection: " + String(selectedOption));
+            LOG_DEBUG(MENU, "MainMenu - A button pressed, making selection: %d", selectedOption);
             selectionMade = selectedOption;
             return MenuResult::SELECTED;
         } else {
-            Serial.println("ERROR: Invalid selection in MainMenu: " + String(selectedOption));
+            LOG_ERROR(MENU, "Invalid selection in MainMenu: %d", selectedOption);
             selectedOption = 0; // Reset to safe value
             return MenuResult::NONE;
         }
@@ -149,10 +95,10 @@ MenuResult MainMenu::handleInput() {
 MainMenuOption MainMenu::getSelectedOption() const {
     // FIXED: Add validation
     if (selectionMade >= 0 && selectionMade < maxOptions) {
-        Serial.println("DEBUG: MainMenu::getSelectedOption() returning: " + String(selectionMade));
+        LOG_DEBUG(MENU, "MainMenu::getSelectedOption() returning: %d", selectionMade);
         return static_cast<MainMenuOption>(selectionMade);
     } else {
-        Serial.println("ERROR: Invalid selectionMade in MainMenu: " + String(selectionMade));
+        LOG_ERROR(MENU, "Invalid selectionMade in MainMenu: %d", selectionMade);
         return MainMenuOption::START_GAME; // Safe default
     }
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-// src/menus/MainMenu.h - Updated header with partial update methods
+// src/menus/MainMenu.h - Main menu built from retained widgets
 #ifndef MAIN_MENU_H
 #define MAIN_MENU_H
 
@@ -13,19 +13,15 @@ enum class MainMenuOption {
 class MainMenu : public MenuBase {
 private:
     const char* menuOptions[3] = {"Start Game", "Settings", "Credits"};
-    int lastRenderedSelection;
     bool needsRedraw;
     
-    // Full screen drawing methods
-    void drawFullMenu();
-    void drawTitle();
-    void drawMenuOptions();
-    void drawInstructions();
-    
-    // NEW: Partial update drawing methods
-    void drawMenuCursor(int option);
-    void clearMenuCursor(int option);
-    void updateMenuSelection();
+    // NEW: Retained widgets - built once, render() only moves the cursor
+    Label titleTop;
+    Label titleBottom;
+    ListWidget options;
+    Cursor cursor;
+    Label navigateHint;
+    Label selectHint;
     
 public:
     MainMenu(Display* disp, Input* inp);
@@ -1,6 +1,11 @@
 #include "MenuBase.h"
 
-MenuBase::MenuBase(Display* disp, Input* inp, int numOptions) {
+MenuBase::MenuBase(Display* disp, Input* inp, int numOptions)
+    : MenuBase(disp, inp, numOptions, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT) {
+}
+
+MenuBase::MenuBase(Display* disp, Input* inp, int numOptions, int panelX, int panelY, int panelW, int panelH)
+    : panel(panelX, panelY, panelW, panelH) {
     display = disp;
     input = inp;
     maxOptions = numOptions;
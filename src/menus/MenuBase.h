@@ -3,6 +3,7 @@
 
 #include "../input/Input.h"
 #include "../graphics/Display.h"
+#include "../ui/Widgets.h"
 
 enum class MenuResult {
     NONE,           // No selection made yet
@@ -21,6 +22,11 @@ protected:
     Display* display;
     Input* input;
     
+    // NEW: Root widget panel (full screen by default). Subclasses add their
+    // widgets once, update them in render() and call panel.show() to take
+    // over the screen or panel.render() to repaint what changed.
+    Panel panel;
+    
     // Helper methods for common menu operations
     void moveSelectionUp();
     void moveSelectionDown();
@@ -28,6 +34,8 @@ protected:
     
 public:
     MenuBase(Display* disp, Input* inp, int numOptions);
+    // NEW: Menus that only own part of the screen pass their panel area
+    MenuBase(Display* disp, Input* inp, int numOptions, int panelX, int panelY, int panelW, int panelH);
     virtual ~MenuBase() = default;
     
     // Core menu interface - must be implemented by each menu
@@ -1,70 +1,116 @@
-// src/menus/SpellCombatMenu.cpp - Moved spells to bottom for text box space
+// src/menus/SpellCombatMenu.cpp - Spell slots at the bottom, drawn with retained widgets
 #include "SpellCombatMenu.h"
 #include "../spells/spell.h"
 #include "../entities/player.h"
+#include "../debug/Log.h"
+
+#define SPELL_MENU_Y 260       // CHANGED: Moved down 50 pixels to make room for text
+#define SPELL_SLOT_WIDTH 70
+#define SPELL_SLOT_HEIGHT 25   // CHANGED: Reduced height from 30 to 25
+#define SPELL_SLOT_SPACING 10
+#define SPELL_GRAY 0x8410
+
+SpellCombatMenu::SpellSlotView::SpellSlotView()
+    : frame(0, 0, SPELL_SLOT_WIDTH, SPELL_SLOT_HEIGHT),
+      empty(0, 0, "Empty", SPELL_GRAY),
+      mana(0, 0, "", TFT_BLUE) {
+    frame.setFilled(true);
+    frame.setBorder(TFT_WHITE);
+    frame.add(&number);
+    frame.add(&name);
+    frame.add(&empty);
+    frame.add(&power);
+    frame.add(&mana);
+}
+
+void SpellCombatMenu::SpellSlotView::place(int x, int y) {
+    frame.moveTo(x, y);
+    number.moveTo(x + 3, y + 1);
+    name.moveTo(x + 3, y + 10);
+    empty.moveTo(x + 3, y + 12);
+    power.moveTo(x + 3, y + 18);   // Mana cost and power on same line to save space
+    mana.moveTo(x + 50, y + 18);
+}
 
 SpellCombatMenu::SpellCombatMenu(Display* disp, Input* inp, Player* p) 
-    : MenuBase(disp, inp, 4) {  // 4 spell slots only
+    : MenuBase(disp, inp, 4, 0, SPELL_MENU_Y, SCREEN_WIDTH, 60) {  // 4 spell slots only
     player = p;
-    lastRenderedSelection = -1;
     needsRedraw = true;
     
     // Initialize spell info with proper struct construction
     for (int i = 0; i < 4; i++) {
         spellInfo[i].name = "Empty";
         spellInfo[i].shortName = "----";
-        spellInfo[i].color = 0x8410;  // Gray color
+        spellInfo[i].color = SPELL_GRAY;
         spellInfo[i].available = false;
         spellInfo[i].manaCost = 0;
         spellInfo[i].power = 0;
     }
+    
+    // Layout: 2x2 grid of slots at the very bottom, cursor left of each slot
+    panel.setFilled(true);
+    for (int i = 0; i < 4; i++) {
+        int row = i / 2;
+        int col = i % 2;
+        int x = 10 + (col * (SPELL_SLOT_WIDTH + SPELL_SLOT_SPACING));
+        int y = SPELL_MENU_Y + (row * (SPELL_SLOT_HEIGHT + SPELL_SLOT_SPACING));
+        
+        slots[i].place(x, y);
+        slots[i].number.setText(WidgetText::format("%d", i + 1));
+        cursor.setStop(i, x - 8, y + 10);
+        panel.add(&slots[i].frame);
+    }
+    panel.add(&cursor);
 }
 
 void SpellCombatMenu::activate() {
     MenuBase::activate();
     updateSpellInfo();
-    lastRenderedSelection = -1;
     needsRedraw = true;
 }
 
 void SpellCombatMenu::render() {
     if (!isActive) return;
     
-    // Update spell info in case spells changed
+    // Update spell info in case spells changed; widgets only repaint on change
     updateSpellInfo();
+    updateSlotWidgets();
+    cursor.select(selectedOption);
     
-    // Full redraw when needed
     if (needsRedraw) {
-        drawFullMenu();
+        panel.invalidate();
         needsRedraw = false;
     }
-    // Partial update when only selection changes
-    else if (selectedOption != lastRenderedSelection) {
-        updateMenuSelection();
-    }
+    panel.render(display);
 }
 
-void SpellCombatMenu::drawFullMenu() {
-    clearMenuArea();
-    
-    // Draw only spell slots at the bottom
-    drawSpellSlots();
-    
-    // Draw initial cursor
-    drawMenuCursor(selectedOption);
-    
-    lastRenderedSelection = selectedOption;
+void SpellCombatMenu::updateSlotWidgets() {
+    for (int i = 0; i < 4; i++) {
+        SpellDisplayInfo& info = spellInfo[i];
+        SpellSlotView& slot = slots[i];
+        bool hasSpell = (info.name != "Empty");
+        
+        // Red border: not enough mana
+        slot.frame.setBorder((!info.available && hasSpell) ? TFT_RED : TFT_WHITE);
+        
+        slot.name.set(info.shortName, info.available ? info.color : SPELL_GRAY);
+        slot.power.setText(WidgetText::format("%d", info.power));
+        slot.mana.setText(WidgetText::format("%d", info.manaCost));
+        slot.name.setVisible(hasSpell);
+        slot.power.setVisible(hasSpell);
+        slot.mana.setVisible(hasSpell);
+        slot.empty.setVisible(!hasSpell);
+    }
 }
 
 void SpellCombatMenu::updateSpellInfo() {
-    auto equippedSpells = player->getEquippedSpells();
-    
+    // Runs every frame in combat, so read the slots in place rather than
+    // copying the equipped list
     for (int i = 0; i < 4; i++) {
-        if (i < equippedSpells.size() && equippedSpells[i]) {
-            Spell* spell = equippedSpells[i];
+        const Spell* spell = player->getEquippedSpell(i);
+        if (spell) {
             spellInfo[i].name = spell->getName();
-            spellInfo[i].shortName = spell->getName().length() > 8 ? 
-                                   spell->getName().substring(0, 8) : spell->getName();
+            spellInfo[i].shortName = spell->getName().c_str();  // Cut to fit
             spellInfo[i].color = spell->getElementColor();
             spellInfo[i].available = (player->getCurrentMana() >= spell->getManaCost());
             spellInfo[i].manaCost = spell->getManaCost();
@@ -72,7 +118,7 @@ void SpellCombatMenu::updateSpellInfo() {
         } else {
             spellInfo[i].name = "Empty";
             spellInfo[i].shortName = "----";
-            spellInfo[i].color = 0x8410;  // Gray color
+            spellInfo[i].color = SPELL_GRAY;
             spellInfo[i].available = false;
             spellInfo[i].manaCost = 0;
             spellInfo[i].power = 0;
@@ -80,96 +126,6 @@ void SpellCombatMenu::updateSpellInfo() {
     }
 }
 
-void SpellCombatMenu::clearMenuArea() {
-    // Clear only the bottom spell menu area (reserve space above for text box)
-    display->fillRect(0, 260, Display::WIDTH, 60, TFT_BLACK);
-}
-
-void SpellCombatMenu::drawSpellSlots() {
-    // Menu positioned at the very bottom (moved down from 210)
-    int menuStartY = 260;  // CHANGED: Moved down 50 pixels to make room for text
-    
-    // Layout: 2x2 grid for spells (slightly smaller to fit)
-    int slotWidth = 70;
-    int slotHeight = 25;    // CHANGED: Reduced height from 30 to 25
-    int spacing = 10;
-    
-    // Draw spell slots (static part)
-    for (int i = 0; i < 4; i++) {
-        int row = i / 2;
-        int col = i % 2;
-        int x = 10 + (col * (slotWidth + spacing));
-        int y = menuStartY + (row * (slotHeight + spacing));
-        
-        drawSpellSlotContent(i, x, y);
-    }
-}
-
-void SpellCombatMenu::drawSpellSlotContent(int slot, int x, int y) {
-    SpellDisplayInfo& info = spellInfo[slot];
-    
-    // Draw slot background and border (no selection highlighting)
-    uint16_t borderColor = TFT_WHITE;
-    if (!info.available && info.name != "Empty") {
-        borderColor = TFT_RED; // Not enough mana
-    }
-    
-    // Draw border and background (smaller height)
-    display->drawRect(x, y, 70, 25, borderColor);  // CHANGED: Height from 30 to 25
-    display->fillRect(x + 1, y + 1, 68, 23, TFT_BLACK);  // CHANGED: Height from 28 to 23
-    
-    // Slot number
-    display->drawText(String(slot + 1).c_str(), x + 3, y + 1, TFT_WHITE, 1);  // CHANGED: Moved up 1 pixel
-    
-    if (info.name != "Empty") {
-        // Spell name (shortened) - adjusted position
-        uint16_t textColor = info.available ? info.color : 0x8410;
-        display->drawText(info.shortName.c_str(), x + 3, y + 10, textColor, 1);  // CHANGED: Moved up 2 pixels
-        
-        // Mana cost and power on same line to save space
-        display->drawText(String(info.manaCost).c_str(), x + 50, y + 18, TFT_BLUE, 1);  // CHANGED: Moved up 4 pixels
-        display->drawText(String(info.power).c_str(), x + 3, y + 18, TFT_WHITE, 1);   // CHANGED: Moved up 4 pixels
-    } else {
-        display->drawText("Empty", x + 3, y + 12, 0x8410, 1);  // CHANGED: Moved up 3 pixels
-    }
-}
-
-void SpellCombatMenu::drawMenuCursor(int option) {
-    if (option >= 0 && option < 4) {
-        // Spell slot cursor (adjusted for new positions)
-        int row = option / 2;
-        int col = option % 2;
-        int x = 10 + (col * (70 + 10));
-        int y = 260 + (row * (25 + 10));  // CHANGED: Updated y position
-        
-        display->drawText(">", x - 8, y + 10, TFT_WHITE);  // CHANGED: Adjusted y offset
-    }
-}
-
-void SpellCombatMenu::clearMenuCursor(int option) {
-    if (option >= 0 && option < 4) {
-        // Clear spell slot cursor (adjusted for new positions)
-        int row = option / 2;
-        int col = option % 2;
-        int x = 10 + (col * (70 + 10));
-        int y = 260 + (row * (25 + 10));  // CHANGED: Updated y position
-        
-        display->fillRect(x - 8, y + 10, 8, 8, TFT_BLACK);  // CHANGED: Adjusted y offset
-    }
-}
-
-void SpellCombatMenu::updateMenuSelection() {
-    // Clear old cursor
-    if (lastRenderedSelection >= 0 && lastRenderedSelection < 4) {
-        clearMenuCursor(lastRenderedSelection);
-    }
-    
-    // Draw new cursor
-    drawMenuCursor(selectedOption);
-    
-    lastRenderedSelection = selectedOption;
-}
-
 MenuResult SpellCombatMenu::handleInput() {
     if (!isActive) return MenuResult::NONE;
     
@@ -195,7 +151,7 @@ MenuResult SpellCombatMenu::handleInput() {
         // Check if selection is valid
         if (!isSelectedActionValid()) {
             // Invalid selection (not enough mana, empty slot, etc.)
-            Serial.println("Invalid spell selection!");
+            LOG_INFO(MENU, "Invalid spell selection!");
             return MenuResult::NONE;
         }
         
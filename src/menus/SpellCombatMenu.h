@@ -1,9 +1,11 @@
-// src/menus/SpellCombatMenu.h - Updated header with text area support
+// src/menus/SpellCombatMenu.h - Spell slots as retained widgets
 #ifndef SPELL_COMBAT_MENU_H
 #define SPELL_COMBAT_MENU_H
 
 #include "MenuBase.h"
 
+#define SPELL_SHORT_NAME_CHARS 8  // What fits in a slot box
+
 // Forward declarations
 class Player;
 class Spell;
@@ -19,34 +21,39 @@ enum class SpellCombatAction {
 class SpellCombatMenu : public MenuBase {
 private:
     Player* player;  // Need access to player's spells
-    int lastRenderedSelection;
     bool needsRedraw;
     
     // Spell display data
     struct SpellDisplayInfo {
-        String name;
-        String shortName;
+        FlashString name;
+        FixedString<SPELL_SHORT_NAME_CHARS + 1> shortName;
         uint16_t color;
         bool available;
         int manaCost;
         int power;
     };
     
-    SpellDisplayInfo spellInfo[4];
+    // NEW: Widgets for one spell slot box
+    struct SpellSlotView {
+        Panel frame;
+        Label number;
+        Label name;
+        Label empty;
+        Label power;
+        Label mana;
+        
+        SpellSlotView();
+        void place(int x, int y);
+    };
     
-    // Full menu drawing methods
-    void drawFullMenu();
-    void updateSpellInfo();
-    void clearMenuArea();
+    SpellDisplayInfo spellInfo[4];
     
-    // Static content drawing methods
-    void drawSpellSlots();
-    void drawSpellSlotContent(int slot, int x, int y);
+    SpellSlotView slots[4];
+    Cursor cursor;
     
-    // Partial update drawing methods
-    void drawMenuCursor(int option);
-    void clearMenuCursor(int option);
-    void updateMenuSelection();
+    void updateSpellInfo();
+    // Push spellInfo into the slot widgets (only changes get repainted)
+    void updateSlotWidgets();
     
 public:
     SpellCombatMenu(Display* disp, Input* inp, Player* p);
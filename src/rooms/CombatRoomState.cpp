@@ -1,5 +1,6 @@
 #include "CombatRoomState.h"
 #include "../spells/spell.h"  // For Spell class methods
+#include "../debug/Log.h"
 
 CombatRoomState::CombatRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
     : RoomState(disp, inp, p, e, dm) {
@@ -14,14 +15,10 @@ CombatRoomState::CombatRoomState(Display* disp, Input* inp, Player* p, Enemy* e,
     // Setup text box area (gets coordinates from spell menu)
     int textX, textY, textWidth, textHeight;
     spellCombatMenu->getTextAreaBounds(textX, textY, textWidth, textHeight);
-    Serial.println("DEBUG: Text area bounds: x=" + String(textX) + " y=" + String(textY) + 
-                   " w=" + String(textWidth) + " h=" + String(textHeight));
+    LOG_DEBUG(ROOM, "Text area bounds: x=%d y=%d w=%d h=%d", textX, textY, textWidth, textHeight);
     combatTextBox->setTextArea(textX, textY, textWidth, textHeight);
     
-    // NEW: Set text box reference in combat manager for synergy display
-    combatManager->setTextBox(combatTextBox);
-    
-    Serial.println("CombatRoomState: Initialized with text box and synergy support");
+    LOG_INFO(ROOM, "CombatRoomState: Initialized with text box and synergy support");
 }
 
 CombatRoomState::~CombatRoomState() {
@@ -32,17 +29,14 @@ CombatRoomState::~CombatRoomState() {
 }
 
 void CombatRoomState::enterRoom() {
-    Serial.println("Starting combat in " + currentRoom->getRoomName());
+    LOG_INFO(ROOM, "Starting combat in %s", currentRoom->getRoomName().c_str());
     startCombat();
 }
 
 void CombatRoomState::handleRoomInteraction() {
     if (showingResultScreen) {
         // Wait for player input to continue
-        if (input->wasPressed(Button::UP) || 
-            input->wasPressed(Button::DOWN) ||
-            input->wasPressed(Button::A) || 
-            input->wasPressed(Button::B)) {
+        if (input->wasAnyPressed()) {
             
             showingResultScreen = false;
             
@@ -50,28 +44,28 @@ void CombatRoomState::handleRoomInteraction() {
             if (combatManager->getCombatResult() == RESULT_VICTORY) {
                 // Check if this was a boss room - Auto go to library
                 if (currentRoom && currentRoom->getType() == ROOM_BOSS) {
-                    Serial.println("=== BOSS DEFEATED ===");
-                    Serial.println("Boss defeated! Automatically going to library...");
+                    LOG_INFO(ROOM, "=== BOSS DEFEATED ===");
+                    LOG_INFO(ROOM, "Boss defeated! Automatically going to library...");
                     
                     // Mark room as completed first
                     completeRoom();
                     
                     // Advance to next floor
                     dungeonManager->advanceToNextFloor();
-                    Serial.println("Advanced to floor: " + String(dungeonManager->getCurrentFloorNumber()));
+                    LOG_INFO(ROOM, "Advanced to floor: %d", dungeonManager->getCurrentFloorNumber());
                     
                     // Go directly to library (automatic reward for defeating boss)
                     requestStateChange(StateTransition::LIBRARY);
-                    Serial.println("=== GOING TO LIBRARY ===");
+                    LOG_INFO(ROOM, "=== GOING TO LIBRARY ===");
                     return;
                 } else {
                     // Regular room - normal completion, return to door choice
-                    Serial.println("Regular enemy defeated - completing room");
+                    LOG_INFO(ROOM, "Regular enemy defeated - completing room");
                     completeRoom(); // This will trigger return to door choice
                 }
             } else {
                 // Player was defeated - game over
-                Serial.println("Player defeated - game over");
+                LOG_INFO(ROOM, "Player defeated - game over");
                 requestStateChange(StateTransition::GAME_OVER);
             }
         }
@@ -86,7 +80,7 @@ void CombatRoomState::handleRoomInteraction() {
 }
 
 void CombatRoomState::exitRoom() {
-    Serial.println("Combat completed, exiting room");
+    LOG_INFO(ROOM, "Combat completed, exiting room");
     combatActive = false;
     showingResultScreen = false;
     spellCombatMenu->deactivate();
@@ -98,24 +92,15 @@ void CombatRoomState::startCombat() {
     // Create enemy from room
     if (currentRoom) {
         *currentEnemy = currentRoom->createEnemy();
-        Serial.println("Combat: Fighting " + currentEnemy->getName());
+        LOG_INFO(ROOM, "Combat: Fighting %s", currentEnemy->getName().c_str());
     } else {
         *currentEnemy = Enemy::createRandomEnemy();
-        Serial.println("Combat: Fighting random " + currentEnemy->getName());
+        LOG_INFO(ROOM, "Combat: Fighting random %s", currentEnemy->getName().c_str());
     }
     
     // Start combat systems
     combatManager->startCombat(player, currentEnemy);
     
-    // DEBUG: Check textBox before setting
-    Serial.println("DEBUG CombatRoomState::startCombat() - combatTextBox: " + String(combatTextBox != nullptr ? "NOT NULL" : "NULL"));
-    
-    // Set text box reference in combat manager for synergy display
-    combatManager->setTextBox(combatTextBox);
-    
-    // DEBUG: Verify it was set
-    Serial.println("DEBUG CombatRoomState::startCombat() - Called setTextBox()");
-    
     combatHUD->drawFullCombatScreen(player, currentEnemy, combatManager->getTurnCounter());
     
     // Initialize combat text (no stats)
@@ -125,25 +110,26 @@ void CombatRoomState::startCombat() {
     spellCombatMenu->render();
     combatActive = true;
     
-    Serial.println("=== COMBAT STARTED ===");
+    LOG_INFO(ROOM, "=== COMBAT STARTED ===");
     combatManager->printCombatStatus();
 }
 
 void CombatRoomState::initializeCombatText() {
-    Serial.println("DEBUG: initializeCombatText() called");
+    LOG_DEBUG(ROOM, "initializeCombatText() called");
     
     combatTextBox->show();  // Make sure text box is visible
     combatTextBox->clearText();
-    Serial.println("DEBUG: Text cleared");
+    LOG_DEBUG(ROOM, "Text cleared");
     
     combatTextBox->addText("=== COMBAT BEGINS ===");
-    Serial.println("DEBUG: Added combat begins text");
+    LOG_DEBUG(ROOM, "Added combat begins text");
     
-    combatTextBox->addText(player->getName() + " vs " + currentEnemy->getName());
-    Serial.println("DEBUG: Added vs text");
+    combatTextBox->addText(FixedString<COMBAT_TEXT_MAX>::format("%s vs %s", player->getName().c_str(),
+                                                            currentEnemy->getName().c_str()).c_str());
+    LOG_DEBUG(ROOM, "Added vs text");
     
     combatTextBox->render();
-    Serial.println("DEBUG: Text box rendered");
+    LOG_DEBUG(ROOM, "Text box rendered");
 }
 
 void CombatRoomState::handleCombatInput() {
@@ -174,14 +160,10 @@ void CombatRoomState::handleCombatInput() {
                 break;
         }
         
-        // Show what the player chose in text box BEFORE processing turn
-        showPlayerActionText(menuAction);
-        
-        // Process combat turn (this will now show synergy bonuses in the text box)
-        CombatResult combatResult = combatManager->processTurn(playerAction);
-        
-        // Show what the enemy did after turn processing
-        showEnemyActionText();
+        // Resolve the turn, then show what happened
+        const TurnResult& turn = combatManager->processTurn(playerAction);
+        CombatResult combatResult = turn.outcome;
+        showTurnText(turn);
         
         // Update display
         combatHUD->updateCombatStats(player, currentEnemy, combatManager->getTurnCounter());
@@ -197,9 +179,9 @@ void CombatRoomState::handleCombatInput() {
             showingResultScreen = true;
 
             if (currentRoom && currentRoom->getType() == ROOM_BOSS) {
-                Serial.println("Boss defeated! Will go to library after button press...");
+                LOG_INFO(ROOM, "Boss defeated! Will go to library after button press...");
             } else {
-                Serial.println("Regular enemy defeated!");
+                LOG_INFO(ROOM, "Regular enemy defeated!");
             }
 
             // Wait for player input before processing victory
@@ -214,9 +196,9 @@ void CombatRoomState::handleCombatInput() {
             
             // Log what type of room we died in
             if (currentRoom) {
-                Serial.println("Died in: " + currentRoom->getRoomName());
+                LOG_INFO(ROOM, "Died in: %s", currentRoom->getRoomName().c_str());
                 if (currentRoom->getType() == ROOM_BOSS) {
-                    Serial.println("Death was in boss room!");
+                    LOG_INFO(ROOM, "Death was in boss room!");
                 }
             }
         } else {
@@ -227,45 +209,24 @@ void CombatRoomState::handleCombatInput() {
     }
 }
 
-void CombatRoomState::showPlayerActionText(SpellCombatAction menuAction) {
-    String actionText = "";
-    
-    switch (menuAction) {
-        case SpellCombatAction::CAST_SPELL_1:
-        case SpellCombatAction::CAST_SPELL_2:
-        case SpellCombatAction::CAST_SPELL_3:
-        case SpellCombatAction::CAST_SPELL_4:
-            {
-                int slotIndex = (int)menuAction;
-                auto equippedSpells = player->getEquippedSpells();
-                if (slotIndex < equippedSpells.size() && equippedSpells[slotIndex]) {
-                    actionText = "casts " + equippedSpells[slotIndex]->getName();
-                } else {
-                    actionText = "tries to cast empty spell";
-                }
-            }
-            break;
-        case SpellCombatAction::DEFEND:
-            actionText = "defends with magic";
-            break;
+// Player's choice, any synergy, then the enemy's move
+void CombatRoomState::showTurnText(const TurnResult& turn) {
+    FixedString<COMBAT_TEXT_MAX> actionText;
+    if (turn.playerAction == ACTION_DEFEND) {
+        actionText = "defends with magic";
+    } else if (turn.spell) {
+        actionText.appendf("casts %s", turn.spell->getName().c_str());
+    } else {
+        actionText = "tries to cast empty spell";
     }
+    combatTextBox->showPlayerAction(player->getName(), actionText.c_str());
     
-    if (actionText != "") {
-        combatTextBox->showPlayerAction(player->getName(), actionText);
-        // Don't render here - let handleRoomInteraction handle it
+    if (turn.synergyBonus > 0) {
+        combatTextBox->showSynergyBonus(turn.spell->getName(), turn.synergyBonus);
     }
-}
-
-void CombatRoomState::showEnemyActionText() {
-    // Get the enemy's last action and show it
-    String enemyName = currentEnemy->getName();
     
-    // Simple enemy action text based on defending state
-    if (currentEnemy->getIsDefending()) {
-        combatTextBox->showEnemyAction(enemyName, "defends");
-    } else {
-        combatTextBox->showEnemyAction(enemyName, "attacks");
-    }
+    // The stance as it ended the turn (a hit knocks a defending enemy out of it)
+    combatTextBox->showEnemyAction(currentEnemy->getName(), turn.enemyDefending ? "defends" : "attacks");
     
     // Don't render here - let handleRoomInteraction handle it
-}
\ No newline at end of file
+}
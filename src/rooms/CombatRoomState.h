@@ -21,8 +21,7 @@ private:
     
     // NEW: Text box integration helpers
     void initializeCombatText();
-    void showPlayerActionText(SpellCombatAction menuAction);
-    void showEnemyActionText();  // CHANGED: Method to show enemy actions
+    void showTurnText(const TurnResult& turn);
     
 public:
     CombatRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm);
@@ -1,13 +1,87 @@
-// src/rooms/LibraryRoomState.cpp - Fixed version with better state management
+// src/rooms/LibraryRoomState.cpp - Library screens built from retained widgets
 #include "LibraryRoomState.h"
 #include "../entities/player.h"
 #include "../entities/enemy.h"
 #include "../dungeon/DungeonManager.h"
 #include "../dungeon/Room.h"
 #include "../spells/spell.h"
+#include "../debug/Log.h"
+
+#define LIBRARY_GRAY 0x8410  // Dark grey
+#define MAX_SCROLLS_SHOWN 6
+#define MAX_KNOWN_SHOWN 7
 
 LibraryRoomState::LibraryRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
-    : GameState(disp, inp) {
+    : GameState(disp, inp),
+      // Main menu
+      mainPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      mainTitleTop(50, 15, "ARCANE", TFT_WHITE, 2),
+      mainTitleBottom(45, 35, "LIBRARY", TFT_WHITE, 2),
+      hpLabel(10, 70),
+      manaLabel(10, 85, "", TFT_BLUE),
+      mainOptions(30, 150, 0, 25),
+      equippedHeader(10, 250, "Equipped:"),
+      // Scroll selection
+      scrollPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      scrollTitle(25, 15, "Study a scroll?"),
+      scrollCount(10, 40),
+      scrollNames(30, 60, 0, 35),
+      scrollTiers(30, 72, 0, 35),
+      scrollElements(30, 84, 0, 35),
+      scrollControls(20, 280, "A: Read Scroll, B: Back"),
+      noScrollsTitle(25, 100, "No scrolls to read", TFT_RED),
+      noScrollsHint1(20, 120, "Find treasure chests"),
+      noScrollsHint2(25, 135, "or defeat bosses!"),
+      noScrollsReturn(50, 200, "B: Return"),
+      // Spell management
+      managePanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      manageTitle(30, 15, "Grimoire", TFT_WHITE, 2),
+      manageEquipped(10, 40, "Equipped:"),
+      slotNames(30, 55, 0, 25),
+      slotElements(120, 55, 0, 25),
+      knownHeader(10, 170, "Known:"),
+      knownList(15, 185, 0, 15),
+      knownMore(15, 230),
+      manageControls(10, 280, "A: Manage Slot, B: Back"),
+      // Spell replacement
+      replacePanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      replaceTitle(30, 15, "EQUIP SPELL", TFT_WHITE, 2),
+      replaceSlot(50, 35),
+      currentLabel(10, 55),
+      currentName(15, 70),
+      availableHeader(10, 95, "Available:"),
+      replaceNames(30, 110, 0, 20),
+      replaceElements(100, 110, 0, 20),
+      replaceControls(20, 280, "A: Equip, B: Back"),
+      // Rest result
+      restPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      restTitle(0, 80, "", TFT_WHITE, 2),
+      restLine1(0, 110),
+      restLine2(20, 125, "Fully Restored!"),
+      restGold(40, 145),
+      restPrompt1(20, 160, "Press any button"),
+      restPrompt2(35, 175, "to continue"),
+      // Popups
+      knownPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      knownTitle(7, 100, "Already Known", TFT_RED, 2),
+      knownLine1(25, 130, "You already know"),
+      knownLine2(40, 145, "this spell!"),
+      knownPrompt(20, 170, "Press any button"),
+      equippedPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      equippedTitle(31, 100, "Equipped!", TFT_GREEN, 2),
+      equippedName(20, 130),
+      equippedSlot(35, 145),
+      equippedPrompt(20, 170, "Press any button"),
+      learnedPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      learnedTop(60, 30, "SPELL", TFT_WHITE, 2),
+      learnedBottom(45, 45, "LEARNED!", TFT_WHITE, 2),
+      learnedName(5, 100),
+      learnedElement(10, 125),
+      learnedPower(10, 140),
+      learnedHint1(35, 175, "Added to grimoire!"),
+      learnedHint2(30, 195, "Visit 'Manage Spells'"),
+      learnedHint3(55, 210, "to equip it!"),
+      learnedPrompt(40, 235, "Press any button") {
     player = p;
     currentEnemy = e;
     dungeonManager = dm;
@@ -16,34 +90,101 @@ LibraryRoomState::LibraryRoomState(Display* disp, Input* inp, Player* p, Enemy*
     currentScreen = SCREEN_MAIN_MENU;
     selectedOption = 0;
     maxOptions = 4;
-    screenDrawn = false;
-    lastSelectedOption = -1;
     
     selectedSpellSlot = 0;
     selectedScrollIndex = 0;
     selectedKnownSpell = 0;
     
     availableScrolls.clear();
+    
+    // Main menu: cursor left of each option, equipped spells along the bottom
+    mainPanel.add(&mainTitleTop);
+    mainPanel.add(&mainTitleBottom);
+    mainPanel.add(&hpLabel);
+    mainPanel.add(&manaLabel);
+    mainPanel.add(&mainOptions);
+    mainPanel.add(&mainCursor);
+    mainPanel.add(&equippedHeader);
+    for (int i = 0; i < 4; i++) {
+        footerSlots[i].moveTo(10 + (i * 35), 265);
+        footerNames[i].moveTo(10 + (i * 35), 275);
+        mainPanel.add(&footerSlots[i]);
+        mainPanel.add(&footerNames[i]);
+    }
+    
+    scrollPanel.add(&scrollTitle);
+    scrollPanel.add(&scrollCount);
+    scrollPanel.add(&scrollNames);
+    scrollPanel.add(&scrollTiers);
+    scrollPanel.add(&scrollElements);
+    scrollPanel.add(&scrollControls);
+    scrollPanel.add(&scrollCursor);
+    scrollPanel.add(&noScrollsTitle);
+    scrollPanel.add(&noScrollsHint1);
+    scrollPanel.add(&noScrollsHint2);
+    scrollPanel.add(&noScrollsReturn);
+    
+    managePanel.add(&manageTitle);
+    managePanel.add(&manageEquipped);
+    managePanel.add(&slotNames);
+    managePanel.add(&slotElements);
+    managePanel.add(&knownHeader);
+    managePanel.add(&knownList);
+    managePanel.add(&knownMore);
+    managePanel.add(&manageControls);
+    managePanel.add(&manageCursor);
+    
+    replacePanel.add(&replaceTitle);
+    replacePanel.add(&replaceSlot);
+    replacePanel.add(&currentLabel);
+    replacePanel.add(&currentName);
+    replacePanel.add(&availableHeader);
+    replacePanel.add(&replaceNames);
+    replacePanel.add(&replaceElements);
+    replacePanel.add(&replaceControls);
+    replacePanel.add(&replaceCursor);
+    
+    restPanel.add(&restTitle);
+    restPanel.add(&restLine1);
+    restPanel.add(&restLine2);
+    restPanel.add(&restGold);
+    restPanel.add(&restPrompt1);
+    restPanel.add(&restPrompt2);
+    
+    knownPanel.add(&knownTitle);
+    knownPanel.add(&knownLine1);
+    knownPanel.add(&knownLine2);
+    knownPanel.add(&knownPrompt);
+    
+    equippedPanel.add(&equippedTitle);
+    equippedPanel.add(&equippedName);
+    equippedPanel.add(&equippedSlot);
+    equippedPanel.add(&equippedPrompt);
+    
+    learnedPanel.add(&learnedTop);
+    learnedPanel.add(&learnedBottom);
+    learnedPanel.add(&learnedName);
+    learnedPanel.add(&learnedElement);
+    learnedPanel.add(&learnedPower);
+    learnedPanel.add(&learnedHint1);
+    learnedPanel.add(&learnedHint2);
+    learnedPanel.add(&learnedHint3);
+    learnedPanel.add(&learnedPrompt);
 }
 
 LibraryRoomState::~LibraryRoomState() {
-    for (Spell* scroll : availableScrolls) {
-        delete scroll;
-    }
     availableScrolls.clear();
 }
 
 void LibraryRoomState::enter() {
-    Serial.println("Entering the mystical library...");
+    LOG_INFO(ROOM, "Entering the mystical library...");
     currentScreen = SCREEN_MAIN_MENU;
     selectedOption = 0;
-    screenDrawn = false;
-    lastSelectedOption = -1;
     
     // FIXED: Clear any pending state transitions immediately
     clearTransition();
     
-    drawMainMenu();
+    showMainMenu();
 }
 
 void LibraryRoomState::update() {
@@ -52,33 +193,38 @@ void LibraryRoomState::update() {
         return;
     }
     
+    // Input may switch screens; only the cursor of the screen we end up on
+    // is moved, and only what changed gets repainted
     switch (currentScreen) {
         case SCREEN_MAIN_MENU:
             handleMainMenuInput();
-            // Only update selection cursor if it changed
-            if (currentScreen == SCREEN_MAIN_MENU && selectedOption != lastSelectedOption) {
-                updateMainMenuSelection();
+            if (currentScreen == SCREEN_MAIN_MENU) {
+                mainCursor.select(selectedOption);
+                mainPanel.render(display);
             }
             break;
             
         case SCREEN_SCROLL_SELECTION:
             handleScrollSelectionInput();
-            if (currentScreen == SCREEN_SCROLL_SELECTION && selectedOption != lastSelectedOption) {
-                updateScrollSelection();
+            if (currentScreen == SCREEN_SCROLL_SELECTION) {
+                scrollCursor.select(selectedScrollIndex);
+                scrollPanel.render(display);
             }
             break;
             
         case SCREEN_SPELL_MANAGEMENT:
             handleSpellManagementInput();
-            if (currentScreen == SCREEN_SPELL_MANAGEMENT && selectedOption != lastSelectedOption) {
-                updateSpellManagementSelection();
+            if (currentScreen == SCREEN_SPELL_MANAGEMENT) {
+                manageCursor.select(selectedOption);
+                managePanel.render(display);
             }
             break;
             
         case SCREEN_SPELL_REPLACEMENT:
             handleSpellReplacementInput();
-            if (currentScreen == SCREEN_SPELL_REPLACEMENT && selectedOption != lastSelectedOption) {
-                updateSpellReplacementSelection();
+            if (currentScreen == SCREEN_SPELL_REPLACEMENT) {
+                replaceCursor.select(selectedOption);
+                replacePanel.render(display);
             }
             break;
             
@@ -89,7 +235,7 @@ void LibraryRoomState::update() {
 }
 
 void LibraryRoomState::exit() {
-    Serial.println("Leaving the library behind...");
+    LOG_INFO(ROOM, "Leaving the library behind...");
 }
 
 // ==============================================
@@ -162,8 +308,7 @@ void LibraryRoomState::handleSpellManagementInput() {
         if (player->getSpellLibrary()->getKnownSpellCount() > 0) {
             currentScreen = SCREEN_SPELL_REPLACEMENT;
             selectedOption = 0;
-            lastSelectedOption = -1; // Force redraw
-            drawSpellReplacement();
+            showSpellReplacement();
         }
     }
     
@@ -173,7 +318,7 @@ void LibraryRoomState::handleSpellManagementInput() {
 }
 
 void LibraryRoomState::handleSpellReplacementInput() {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
+    const auto& knownSpells = player->getSpellLibrary()->getKnownSpells();
     
     if (input->wasPressed(Button::UP)) {
         selectedOption--;
@@ -192,370 +337,164 @@ void LibraryRoomState::handleSpellReplacementInput() {
     if (input->wasPressed(Button::B)) {
         currentScreen = SCREEN_SPELL_MANAGEMENT;
         selectedOption = selectedSpellSlot;
-        lastSelectedOption = -1; // Force redraw
-        drawSpellManagement();
+        showSpellManagement();
     }
 }
 
 void LibraryRoomState::handleRestResultInput() {
-    if (input->wasPressed(Button::UP) || input->wasPressed(Button::DOWN) ||
-        input->wasPressed(Button::A) || input->wasPressed(Button::B)) {
+    if (input->wasAnyPressed()) {
         returnToMainMenu();
     }
 }
 
 // ==============================================
-// OPTIMIZED DRAWING METHODS
+// RETAINED WIDGET SCREENS
 // ==============================================
 
-void LibraryRoomState::drawMainMenu() {
-    display->clear();
-    
-    // Title
-    display->drawText("ARCANE", 50, 15, TFT_WHITE, 2);
-    display->drawText("LIBRARY", 45, 35, TFT_WHITE, 2);
-
-    
-    // Player status
-    display->drawText(("HP: " + String(player->getCurrentHP()) + "/" + String(player->getMaxHP())).c_str(), 
-                     10, 70, TFT_WHITE);
-    display->drawText(("Mana: " + String(player->getCurrentMana()) + "/" + String(player->getMaxMana())).c_str(), 
-                     10, 85, TFT_BLUE);
-    
-    // Show scroll counts by tier
-    if (hasScrolls()) {
-        int tier1Count = 0, tier2Count = 0, tier3Count = 0;
-        for (Spell* scroll : availableScrolls) {
-            if (scroll->getBasePower() <= 20) tier1Count++;
-            else if (scroll->getBasePower() <= 25) tier2Count++;
-            else tier3Count++;
-        }
-    }
-    
-    // Draw menu options (static part)
-    drawMainMenuOptions();
-    
-    // Draw equipped spells at bottom (static)
-    drawEquippedSpellsFooter();
-    
-    // Draw controls
-    
-    // Draw initial cursor
-    drawMainMenuCursor(selectedOption);
-    
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
-}
-
-void LibraryRoomState::drawMainMenuOptions() {
-    int yStart = 150;
-    int ySpacing = 25;
-    const char* options[4] = {"Rest (20g)", "Read Scrolls", "Manage Spells", "Leave"};
-    
-    for (int i = 0; i < maxOptions; i++) {
-        int yPos = yStart + (i * ySpacing);
-        String optionText = options[i];
-        uint16_t textColor = TFT_WHITE;
-        
-        // Update option appearance based on availability
-        if (i == 0 && player->getGold() < REST_COST) {
-            textColor = TFT_RED;
-        } else if (i == 1) {
-            if (!hasScrolls()) {
-                optionText = "Read Scrolls (0)";
-                textColor = 0x8410; // Dark grey
-            } else {
-                optionText = "Read Scrolls (" + String(availableScrolls.size()) + ")";
-                textColor = TFT_GREEN;
-            }
-        }
-        
-        // Draw option text with proper spacing for cursor
-        display->drawText(optionText.c_str(), 30, yPos, textColor);
-    }
+void LibraryRoomState::showMainMenu() {
+    updateMainMenuWidgets();
+    mainCursor.select(selectedOption);
+    mainPanel.show(display);
 }
 
-void LibraryRoomState::drawMainMenuCursor(int option) {
-    int yStart = 150;
-    int ySpacing = 25;
-    int yPos = yStart + (option * ySpacing);
-    
-    display->drawText(">", 15, yPos, TFT_WHITE);
-}
-
-void LibraryRoomState::clearMainMenuCursor(int option) {
-    int yStart = 150;
-    int ySpacing = 25;
-    int yPos = yStart + (option * ySpacing);
+void LibraryRoomState::updateMainMenuWidgets() {
+    // Player status
+    hpLabel.setText(WidgetText::format("HP: %d/%d", player->getCurrentHP(), player->getMaxHP()));
+    manaLabel.setText(WidgetText::format("Mana: %d/%d", player->getCurrentMana(), player->getMaxMana()));
     
-    // Clear cursor area
-    display->fillRect(15, yPos, 12, 12, TFT_BLACK);
-}
-
-void LibraryRoomState::updateMainMenuSelection() {
-    // Clear old cursor
-    if (lastSelectedOption >= 0 && lastSelectedOption < maxOptions) {
-        clearMainMenuCursor(lastSelectedOption);
+    // Options change appearance based on availability
+    mainOptions.setItem(0, "Rest (20g)", player->getGold() < REST_COST ? TFT_RED : TFT_WHITE);
+    if (!hasScrolls()) {
+        mainOptions.setItem(1, "Read Scrolls (0)", LIBRARY_GRAY);
+    } else {
+        mainOptions.setItem(1, WidgetText::format("Read Scrolls (%d)", (int)availableScrolls.size()), TFT_GREEN);
     }
+    mainOptions.setItem(2, "Manage Spells", TFT_WHITE);
+    mainOptions.setItem(3, "Leave", TFT_WHITE);
+    mainOptions.layoutCursor(mainCursor, -15, 0);
     
-    // Draw new cursor
-    drawMainMenuCursor(selectedOption);
-    
-    lastSelectedOption = selectedOption;
-}
-
-void LibraryRoomState::drawEquippedSpellsFooter() {
-    display->drawText("Equipped:", 10, 250, TFT_WHITE);
-    auto equippedSpells = player->getEquippedSpells();
-    
+    // Equipped spells footer
     for (int i = 0; i < 4; i++) {
-        int x = 10 + (i * 35);
-        int y = 265;
-        
-        if (i < equippedSpells.size() && equippedSpells[i]) {
-            display->drawText((String(i + 1) + ":").c_str(), x, y, TFT_WHITE, 1);
-            String shortName = equippedSpells[i]->getName();
-            if (shortName.length() > 4) shortName = shortName.substring(0, 4);
-            display->drawText(shortName.c_str(), x, y + 10, 
-                            equippedSpells[i]->getElementColor(), 1);
+        const Spell* spell = player->getEquippedSpell(i);
+        if (spell) {
+            footerSlots[i].set(WidgetText::format("%d:", i + 1), TFT_WHITE);
+            FixedString<5> shortName = spell->getName().c_str();
+            footerNames[i].set(shortName, spell->getElementColor());
+            footerNames[i].setVisible(true);
         } else {
-            display->drawText((String(i + 1) + ": ---").c_str(), x, y, 0x8410, 1);
+            footerSlots[i].set(WidgetText::format("%d: ---", i + 1), LIBRARY_GRAY);
+            footerNames[i].setVisible(false);
         }
     }
 }
 
-void LibraryRoomState::drawScrollSelection() {
-    display->clear();
-    
-    display->drawText("Study a scroll?", 25, 15, TFT_WHITE, 1);
-    
-    if (availableScrolls.empty()) {
-        display->drawText("No scrolls to read", 25, 100, TFT_RED);
-        display->drawText("Find treasure chests", 20, 120, TFT_WHITE);
-        display->drawText("or defeat bosses!", 25, 135, TFT_WHITE);
-        display->drawText("B: Return", 50, 200, TFT_WHITE);
-        screenDrawn = true;
-        return;
-    }
-    
-    display->drawText(("You have " + String(availableScrolls.size()) + " scrolls:").c_str(), 10, 40, TFT_WHITE);
-    
-    // Draw scroll options (static part)
-    drawScrollOptions();
-    
-    // Draw controls
-    display->drawText("A: Read Scroll, B: Back", 20, 280, TFT_WHITE);
-    
-    // Draw initial cursor
-    drawScrollCursor(selectedScrollIndex);
-    
-    screenDrawn = true;
-    lastSelectedOption = selectedScrollIndex;
+void LibraryRoomState::showScrollSelection() {
+    updateScrollWidgets();
+    scrollCursor.select(selectedScrollIndex);
+    scrollPanel.show(display);
 }
 
-void LibraryRoomState::drawScrollOptions() {
-    for (int i = 0; i < availableScrolls.size() && i < 6; i++) {
-        int yPos = 60 + (i * 35);
-        Spell* scroll = availableScrolls[i];
+void LibraryRoomState::updateScrollWidgets() {
+    bool empty = availableScrolls.empty();
+    noScrollsTitle.setVisible(empty);
+    noScrollsHint1.setVisible(empty);
+    noScrollsHint2.setVisible(empty);
+    noScrollsReturn.setVisible(empty);
+    scrollCount.setVisible(!empty);
+    scrollControls.setVisible(!empty);
+    
+    scrollCount.setText(WidgetText::format("You have %d scrolls:", (int)availableScrolls.size()));
+    
+    int shown = min((int)availableScrolls.size(), MAX_SCROLLS_SHOWN);
+    scrollNames.setCount(shown);
+    scrollTiers.setCount(shown);
+    scrollElements.setCount(shown);
+    for (int i = 0; i < shown; i++) {
+        const Spell* scroll = availableScrolls[i];
         
         // Show mysterious scroll description
-        String scrollDesc = "Mysterious Scroll";
-        String tierDesc = "Tier 1";
+        const char* tierDesc = "Tier 1";
         uint16_t tierColor = TFT_WHITE;
-        
         if (scroll->getBasePower() > 25) {
             tierDesc = "Tier 3 (Powerful)";
             tierColor = TFT_RED;
         } else if (scroll->getBasePower() > 20) {
             tierDesc = "Tier 2 (Advanced)";
-            tierColor = TFT_WHITE;
         }
         
-        display->drawText(scrollDesc.c_str(), 30, yPos, TFT_WHITE);
-        display->drawText(tierDesc.c_str(), 30, yPos + 12, tierColor);
-        display->drawText(scroll->getElementName().c_str(), 30, yPos + 24, scroll->getElementColor());
-    }
-}
-
-void LibraryRoomState::drawScrollCursor(int scrollIndex) {
-    if (scrollIndex >= 0 && scrollIndex < availableScrolls.size()) {
-        int yPos = 60 + (scrollIndex * 35) + 12; // Center vertically
-        display->drawText(">", 15, yPos, TFT_WHITE);
-    }
-}
-
-void LibraryRoomState::clearScrollCursor(int scrollIndex) {
-    if (scrollIndex >= 0 && scrollIndex < availableScrolls.size()) {
-        int yPos = 60 + (scrollIndex * 35) + 12;
-        display->fillRect(15, yPos, 12, 12, TFT_BLACK);
+        scrollNames.setItem(i, "Mysterious Scroll", TFT_WHITE);
+        scrollTiers.setItem(i, tierDesc, tierColor);
+        scrollElements.setItem(i, scroll->getElementName(), scroll->getElementColor());
     }
-}
-
-void LibraryRoomState::updateScrollSelection() {
-    // Clear old cursor
-    if (lastSelectedOption >= 0 && lastSelectedOption < availableScrolls.size()) {
-        clearScrollCursor(lastSelectedOption);
-    }
-    
-    // Draw new cursor
-    drawScrollCursor(selectedScrollIndex);
     
-    lastSelectedOption = selectedScrollIndex;
+    // Cursor centered vertically on each scroll
+    scrollTiers.layoutCursor(scrollCursor, -15, 0);
 }
 
-void LibraryRoomState::drawSpellManagement() {
-    display->clear();
-    
-    display->drawText("Grimoire", 30, 15, TFT_WHITE, 2);
-    
-    // Show equipped spells (static part)
-    display->drawText("Equipped:", 10, 40, TFT_WHITE);
-    drawSpellSlots();
-    
-    // Show known spells summary
-    drawKnownSpellsSummary();
-    
-    // Draw controls
-    display->drawText("A: Manage Slot, B: Back", 10, 280, TFT_WHITE);
-    
-    // Draw initial cursor
-    drawSpellSlotCursor(selectedOption);
-    
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
+void LibraryRoomState::showSpellManagement() {
+    updateSpellManagementWidgets();
+    manageCursor.select(selectedOption);
+    managePanel.show(display);
 }
 
-void LibraryRoomState::drawSpellSlots() {
-    auto equippedSpells = player->getEquippedSpells();
-    
+void LibraryRoomState::updateSpellManagementWidgets() {
     for (int i = 0; i < 4; i++) {
-        int yPos = 55 + (i * 25);
-        
-        String slotText = "Slot " + String(i + 1) + ": ";
-        if (i < equippedSpells.size() && equippedSpells[i]) {
-            slotText += equippedSpells[i]->getName();
-            display->drawText(slotText.c_str(), 30, yPos, TFT_WHITE);
-            display->drawText(equippedSpells[i]->getElementName().c_str(), 
-                            120, yPos, equippedSpells[i]->getElementColor());
+        const Spell* spell = player->getEquippedSpell(i);
+        if (spell) {
+            slotNames.setItem(i, WidgetText::format("Slot %d: %s", i + 1, spell->getName().c_str()), TFT_WHITE);
+            slotElements.setItem(i, spell->getElementName(), spell->getElementColor());
         } else {
-            slotText += "Empty";
-            display->drawText(slotText.c_str(), 30, yPos, 0x8410);
+            slotNames.setItem(i, WidgetText::format("Slot %d: Empty", i + 1), LIBRARY_GRAY);
+            slotElements.setItem(i, "", TFT_WHITE);
         }
     }
-}
-
-void LibraryRoomState::drawSpellSlotCursor(int slot) {
-    int yPos = 55 + (slot * 25);
-    display->drawText(">", 15, yPos, TFT_WHITE);
-}
-
-void LibraryRoomState::clearSpellSlotCursor(int slot) {
-    int yPos = 55 + (slot * 25);
-    display->fillRect(15, yPos, 12, 12, TFT_BLACK);
-}
-
-void LibraryRoomState::updateSpellManagementSelection() {
-    // Clear old cursor
-    if (lastSelectedOption >= 0 && lastSelectedOption < 4) {
-        clearSpellSlotCursor(lastSelectedOption);
-    }
-    
-    // Draw new cursor
-    drawSpellSlotCursor(selectedOption);
+    slotNames.layoutCursor(manageCursor, -15, 0);
     
-    lastSelectedOption = selectedOption;
-}
-
-void LibraryRoomState::drawKnownSpellsSummary() {
-    display->drawText("Known:", 10, 170, TFT_WHITE);
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
+    // Known spells summary
+    const auto& knownSpells = player->getSpellLibrary()->getKnownSpells();
     int knownCount = min(3, (int)knownSpells.size());
-    
+    knownList.setCount(knownCount);
     for (int i = 0; i < knownCount; i++) {
-        int yPos = 185 + (i * 15);
-        display->drawText(("- " + knownSpells[i]->getName()).c_str(), 15, yPos, TFT_WHITE, 1);
+        knownList.setItem(i, WidgetText::format("- %s", knownSpells[i]->getName().c_str()), TFT_WHITE);
     }
     
+    knownMore.setVisible(knownSpells.size() > 3);
     if (knownSpells.size() > 3) {
-        display->drawText(("... and " + String(knownSpells.size() - 3) + " more").c_str(), 
-                         15, 230, TFT_WHITE, 1);
+        knownMore.setText(WidgetText::format("... and %d more", (int)knownSpells.size() - 3));
     }
 }
 
-void LibraryRoomState::drawSpellReplacement() {
-    display->clear();
-    
-    display->drawText("EQUIP SPELL", 30, 15, TFT_WHITE, 2);
-    display->drawText(("To Slot " + String(selectedSpellSlot + 1)).c_str(), 50, 35, TFT_WHITE);
-    
-    // Show current spell in slot (static)
-    drawCurrentSpellInSlot();
-    
-    // Show available spells (static)
-    display->drawText("Available:", 10, 95, TFT_WHITE);
-    drawAvailableSpells();
-    
-    // Draw controls
-    display->drawText("A: Equip, B: Back", 20, 280, TFT_WHITE);
-    
-    // Draw initial cursor
-    drawSpellReplacementCursor(selectedOption);
-    
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
-}
-
-void LibraryRoomState::drawCurrentSpellInSlot() {
-    auto equippedSpells = player->getEquippedSpells();
-    if (selectedSpellSlot < equippedSpells.size() && equippedSpells[selectedSpellSlot]) {
-        display->drawText("Current:", 10, 55, TFT_WHITE);
-        display->drawText(equippedSpells[selectedSpellSlot]->getName().c_str(), 
-                         15, 70, equippedSpells[selectedSpellSlot]->getElementColor());
-    } else {
-        display->drawText("Current: Empty", 10, 55, 0x8410);
-    }
+void LibraryRoomState::showSpellReplacement() {
+    updateSpellReplacementWidgets();
+    replaceCursor.select(selectedOption);
+    replacePanel.show(display);
 }
 
-void LibraryRoomState::drawAvailableSpells() {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
+void LibraryRoomState::updateSpellReplacementWidgets() {
+    replaceSlot.setText(WidgetText::format("To Slot %d", selectedSpellSlot + 1));
     
-    for (int i = 0; i < knownSpells.size() && i < 7; i++) {
-        int yPos = 110 + (i * 20);
-        Spell* spell = knownSpells[i];
-        
-        display->drawText(spell->getName().c_str(), 30, yPos, TFT_WHITE);
-        display->drawText(spell->getElementName().c_str(), 100, yPos, spell->getElementColor());
-    }
-}
-
-void LibraryRoomState::drawSpellReplacementCursor(int spellIndex) {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
-    if (spellIndex >= 0 && spellIndex < knownSpells.size()) {
-        int yPos = 110 + (spellIndex * 20);
-        display->drawText(">", 15, yPos, TFT_WHITE);
-    }
-}
-
-void LibraryRoomState::clearSpellReplacementCursor(int spellIndex) {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
-    if (spellIndex >= 0 && spellIndex < knownSpells.size()) {
-        int yPos = 110 + (spellIndex * 20);
-        display->fillRect(15, yPos, 12, 12, TFT_BLACK);
+    // Current spell in slot
+    const Spell* current = player->getEquippedSpell(selectedSpellSlot);
+    if (current) {
+        currentLabel.set("Current:", TFT_WHITE);
+        currentName.set(current->getName(), current->getElementColor());
+        currentName.setVisible(true);
+    } else {
+        currentLabel.set("Current: Empty", LIBRARY_GRAY);
+        currentName.setVisible(false);
     }
-}
-
-void LibraryRoomState::updateSpellReplacementSelection() {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
     
-    // Clear old cursor
-    if (lastSelectedOption >= 0 && lastSelectedOption < knownSpells.size()) {
-        clearSpellReplacementCursor(lastSelectedOption);
+    // Available spells
+    const auto& knownSpells = player->getSpellLibrary()->getKnownSpells();
+    int shown = min((int)knownSpells.size(), MAX_KNOWN_SHOWN);
+    replaceNames.setCount(shown);
+    replaceElements.setCount(shown);
+    for (int i = 0; i < shown; i++) {
+        const Spell* spell = knownSpells[i];
+        replaceNames.setItem(i, spell->getName(), TFT_WHITE);
+        replaceElements.setItem(i, spell->getElementName(), spell->getElementColor());
     }
-    
-    // Draw new cursor
-    drawSpellReplacementCursor(selectedOption);
-    
-    lastSelectedOption = selectedOption;
+    replaceNames.layoutCursor(replaceCursor, -15, 0);
 }
 
 // ==============================================
@@ -565,25 +504,21 @@ void LibraryRoomState::updateSpellReplacementSelection() {
 void LibraryRoomState::readSelectedScroll() {
     if (selectedScrollIndex >= availableScrolls.size()) return;
     
-    Spell* scrollToRead = availableScrolls[selectedScrollIndex];
+    const Spell* scrollToRead = availableScrolls[selectedScrollIndex];
     
     if (player->getSpellLibrary()->hasSpell(scrollToRead->getID())) {
-        display->clear();
-        display->drawText("Already Known!", 30, 100, TFT_RED, 2);
-        display->drawText("You already know", 25, 130, TFT_WHITE);
-        display->drawText("this spell!", 40, 145, TFT_WHITE);
-        display->drawText("Press any button", 20, 170, TFT_WHITE);
+        knownPanel.show(display);
         
+        display->flush();  // NEW: Present the message before waiting
+
         while (true) {
             input->update();
-            if (input->wasPressed(Button::UP) || input->wasPressed(Button::DOWN) ||
-                input->wasPressed(Button::A) || input->wasPressed(Button::B)) {
+            if (input->wasAnyPressed()) {
                 break;
             }
             delay(10);
         }
         
-        delete scrollToRead;
         availableScrolls.erase(availableScrolls.begin() + selectedScrollIndex);
         
         if (selectedScrollIndex >= availableScrolls.size() && selectedScrollIndex > 0) {
@@ -609,11 +544,9 @@ void LibraryRoomState::readSelectedScroll() {
 void LibraryRoomState::returnToMainMenu() {
     currentScreen = SCREEN_MAIN_MENU;
     selectedOption = 0;
-    screenDrawn = false;
-    lastSelectedOption = -1;
     
     delay(100);
-    drawMainMenu();
+    showMainMenu();
 }
 
 void LibraryRoomState::completeRoom() {
@@ -631,62 +564,57 @@ void LibraryRoomState::completeRoom() {
 }
 
 void LibraryRoomState::performRest() {
+    const char* failure = restPlayer(player);
+    showRestResult(failure == nullptr, failure ? failure : "");
+    currentScreen = SCREEN_REST_RESULT;
+}
+
+const char* LibraryRoomState::restPlayer(Player* player) {
     if (player->getGold() < REST_COST) {
-        drawRestResult(false, "Need 20 gold to rest");
-        currentScreen = SCREEN_REST_RESULT;
-        return;
+        return "Need 20 gold to rest";
     }
     
     if (player->getCurrentHP() >= player->getMaxHP() && 
         player->getCurrentMana() >= player->getMaxMana()) {
-        drawRestResult(false, "Already at full health and mana");
-        currentScreen = SCREEN_REST_RESULT;
-        return;
+        return "Already at full health and mana";
     }
     
     player->spendGold(REST_COST);
     player->heal(player->getMaxHP());
     player->restoreAllMana();
     player->clearSpellEffects();
-    
-    drawRestResult(true, "");
-    currentScreen = SCREEN_REST_RESULT;
+    return nullptr;
 }
 
 void LibraryRoomState::openScrolls() {
     currentScreen = SCREEN_SCROLL_SELECTION;
     selectedScrollIndex = 0;
     selectedOption = 0; // Keep in sync
-    screenDrawn = false;
-    lastSelectedOption = -1;
-    drawScrollSelection();
+    showScrollSelection();
 }
 
 void LibraryRoomState::openSpellManagement() {
     currentScreen = SCREEN_SPELL_MANAGEMENT;
     selectedOption = 0;
-    screenDrawn = false;
-    lastSelectedOption = -1;
-    drawSpellManagement();
+    showSpellManagement();
 }
 
 void LibraryRoomState::equipSpellToSlot() {
-    auto knownSpells = player->getSpellLibrary()->getKnownSpells();
+    const auto& knownSpells = player->getSpellLibrary()->getKnownSpells();
     if (selectedOption >= knownSpells.size()) return;
     
-    Spell* spellToEquip = knownSpells[selectedOption];
+    const Spell* spellToEquip = knownSpells[selectedOption];
     
     if (player->getSpellLibrary()->equipSpell(spellToEquip->getID(), selectedSpellSlot)) {
-        display->clear();
-        display->drawText("Spell Equipped!", 25, 100, TFT_GREEN, 2);
-        display->drawText(spellToEquip->getName().c_str(), 20, 130, spellToEquip->getElementColor());
-        display->drawText(("to Slot " + String(selectedSpellSlot + 1)).c_str(), 35, 145, TFT_WHITE);
-        display->drawText("Press any button", 20, 170, TFT_WHITE);
+        equippedName.set(spellToEquip->getName(), spellToEquip->getElementColor());
+        equippedSlot.setText(WidgetText::format("to Slot %d", selectedSpellSlot + 1));
+        equippedPanel.show(display);
         
+        display->flush();  // NEW: Present the message before waiting
+
         while (true) {
             input->update();
-            if (input->wasPressed(Button::UP) || input->wasPressed(Button::DOWN) ||
-                input->wasPressed(Button::A) || input->wasPressed(Button::B)) {
+            if (input->wasAnyPressed()) {
                 break;
             }
             delay(10);
@@ -695,87 +623,100 @@ void LibraryRoomState::equipSpellToSlot() {
     
     currentScreen = SCREEN_SPELL_MANAGEMENT;
     selectedOption = selectedSpellSlot;
-    screenDrawn = false;
-    lastSelectedOption = -1;
-    drawSpellManagement();
+    showSpellManagement();
 }
 
-void LibraryRoomState::showSpellLearned(Spell* spell) {
-    display->clear();
-    
-    display->drawText("SPELL", 60, 30, TFT_WHITE, 2);
-    display->drawText("LEARNED!", 45, 45, TFT_WHITE, 2);
-    display->drawText(spell->getName().c_str(), 5, 100, spell->getElementColor(), 2);
-    display->drawText(spell->getElementName().c_str(), 10, 125, TFT_WHITE);
-    display->drawText(("Power: " + String(spell->getBasePower())).c_str(), 10, 140, TFT_WHITE);
-    
-    display->drawText("Added to grimoire!", 35, 175, TFT_WHITE);
-    display->drawText("Visit 'Manage Spells'", 30, 195, TFT_WHITE);
-    display->drawText("to equip it!", 55, 210, TFT_WHITE);
-    display->drawText("Press any button", 40, 235, TFT_WHITE);
+void LibraryRoomState::showSpellLearned(const Spell* spell) {
+    // Labels don't wrap: names too long for size 2 drop to size 1
+    FlashString name = spell->getName();
+    bool large = (5 + (int)name.length() * GLYPH_CELL_WIDTH * 2 <= SCREEN_WIDTH);
+    learnedName.set(name, spell->getElementColor());
+    learnedName.setSize(large ? 2 : 1);
+    learnedElement.setText(spell->getElementName());
+    learnedPower.setText(WidgetText::format("Power: %d", spell->getBasePower()));
+    learnedPanel.show(display);
     
+    display->flush();  // NEW: Present the message before waiting
+
     while (true) {
         input->update();
-        if (input->wasPressed(Button::UP) || input->wasPressed(Button::DOWN) ||
-            input->wasPressed(Button::A) || input->wasPressed(Button::B)) {
+        if (input->wasAnyPressed()) {
             break;
         }
         delay(10);
     }
 }
 
-void LibraryRoomState::drawRestResult(bool success, String message) {
-    display->clear();
-    
+void LibraryRoomState::showRestResult(bool success, const char* message) {
     if (success) {
-        display->drawText("Rest Complete", 25, 80, TFT_GREEN, 2);
-        display->drawText("Health & Mana", 25, 110, TFT_WHITE);
-        display->drawText("Fully Restored!", 20, 125, TFT_WHITE);
-        display->drawText(("Gold: " + String(player->getGold())).c_str(), 40, 145, TFT_WHITE);
+        restTitle.moveTo(25, 80);
+        restTitle.set("Rest Complete", TFT_GREEN);
+        restLine1.moveTo(25, 110);
+        restLine1.setText("Health & Mana");
+        restGold.setText(WidgetText::format("Gold: %d", player->getGold()));
     } else {
-        display->drawText("Cannot Rest", 30, 80, TFT_RED, 2);
-        display->drawText(message.c_str(), 20, 110, TFT_WHITE);
+        restTitle.moveTo(30, 80);
+        restTitle.set("Cannot Rest", TFT_RED);
+        restLine1.moveTo(20, 110);
+        
+        // Labels don't wrap: break long messages at a space onto line 2
+        int maxChars = (SCREEN_WIDTH - 20) / 6;
+        int split = -1;
+        if ((int)strlen(message) > maxChars) {
+            for (int i = maxChars; i >= 0; i--) {
+                if (message[i] == ' ') {
+                    split = i;
+                    break;
+                }
+            }
+        }
+        WidgetText line1;
+        line1.append(message, split > 0 ? split : strlen(message));
+        restLine1.setText(line1);
+        restLine2.setText(split > 0 ? message + split + 1 : "");
+    }
+    if (success) {
+        restLine2.setText("Fully Restored!");
     }
+    restGold.setVisible(success);
     
-    display->drawText("Press any button", 20, 160, TFT_WHITE);
-    display->drawText("to continue", 35, 175, TFT_WHITE);
+    restPanel.show(display);
 }
 
 // Scroll management methods (unchanged)
 void LibraryRoomState::giveScrollReward(int spellID) {
-    Spell* scroll = SpellFactory::createSpell(spellID);
+    const Spell* scroll = SpellFactory::getSpell(spellID);
     if (scroll) {
         addAvailableScroll(scroll);
-        Serial.println("Received scroll: " + scroll->getName());
+        LOG_INFO(ROOM, "Received scroll: %s", scroll->getName().c_str());
     }
 }
 
 void LibraryRoomState::giveBossScrollReward() {
-    Spell* bossScroll = SpellFactory::createRandomSpell(2, 3);
+    const Spell* bossScroll = SpellFactory::getRandomSpell(2, 3);
     if (bossScroll) {
         addAvailableScroll(bossScroll);
-        Serial.println("Boss dropped scroll: " + bossScroll->getName());
+        LOG_INFO(ROOM, "Boss dropped scroll: %s", bossScroll->getName().c_str());
     }
 }
 
 void LibraryRoomState::giveRandomScroll() {
-    Spell* randomScroll = SpellFactory::createRandomSpell(1, 2);
+    const Spell* randomScroll = SpellFactory::getRandomSpell(1, 2);
     if (randomScroll) {
         addAvailableScroll(randomScroll);
-        Serial.println("Found random scroll: " + randomScroll->getName());
+        LOG_INFO(ROOM, "Found random scroll: %s", randomScroll->getName().c_str());
     }
 }
 
-void LibraryRoomState::addAvailableScroll(Spell* spell) {
+void LibraryRoomState::addAvailableScroll(const Spell* spell) {
     if (spell) {
         availableScrolls.push_back(spell);
-        Serial.println("LibraryRoomState: Added scroll to available list: " + spell->getName());
+        LOG_INFO(ROOM, "LibraryRoomState: Added scroll to available list: %s", spell->getName().c_str());
     }
 }
 
 void LibraryRoomState::removeScroll(int index) {
     if (index >= 0 && index < availableScrolls.size()) {
-        delete availableScrolls[index];
         availableScrolls.erase(availableScrolls.begin() + index);
     }
 }
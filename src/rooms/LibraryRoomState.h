@@ -1,8 +1,9 @@
-// src/rooms/LibraryRoomState.h - Updated header with partial update methods
+// src/rooms/LibraryRoomState.h - Library screens built from retained widgets
 #ifndef LIBRARY_ROOM_STATE_H
 #define LIBRARY_ROOM_STATE_H
 
 #include "../game/GameState.h"
+#include "../ui/Widgets.h"
 #include <vector>
 
 // Forward declarations
@@ -36,14 +37,12 @@ private:
     GameStateManager* gameStateManager;
     
     // Available scrolls (found in chests/boss drops)
-    std::vector<Spell*> availableScrolls;
+    std::vector<const Spell*> availableScrolls;
     
     // UI state
     LibraryScreen currentScreen;
     int selectedOption;
     int maxOptions;
-    bool screenDrawn;
-    int lastSelectedOption;
     
     // Spell management state
     int selectedSpellSlot;      // Which slot to replace (0-3)
@@ -53,40 +52,76 @@ private:
     // Rest costs
     static const int REST_COST = 20;
     
-    // Full screen drawing methods
-    void drawMainMenu();
-    void drawScrollSelection();
-    void drawSpellManagement();
-    void drawSpellReplacement();
-    void drawRestResult(bool success, String message);
-    void showSpellLearned(Spell* spell);
-    
-    // NEW: Partial update drawing methods for main menu
-    void drawMainMenuOptions();
-    void drawMainMenuCursor(int option);
-    void clearMainMenuCursor(int option);
-    void updateMainMenuSelection();
-    void drawEquippedSpellsFooter();
-    
-    // NEW: Partial update methods for scroll selection
-    void drawScrollOptions();
-    void drawScrollCursor(int scrollIndex);
-    void clearScrollCursor(int scrollIndex);
-    void updateScrollSelection();
-    
-    // NEW: Partial update methods for spell management
-    void drawSpellSlots();
-    void drawSpellSlotCursor(int slot);
-    void clearSpellSlotCursor(int slot);
-    void updateSpellManagementSelection();
-    void drawKnownSpellsSummary();
-    
-    // NEW: Partial update methods for spell replacement
-    void drawCurrentSpellInSlot();
-    void drawAvailableSpells();
-    void drawSpellReplacementCursor(int spellIndex);
-    void clearSpellReplacementCursor(int spellIndex);
-    void updateSpellReplacementSelection();
+    // NEW: One retained widget panel per screen. Switching screens swaps
+    // panels (erasing only the old widgets); within a screen only widgets
+    // whose state changed are repainted.
+    
+    // Main menu
+    Panel mainPanel;
+    Label mainTitleTop, mainTitleBottom;
+    Label hpLabel, manaLabel;
+    ListWidget mainOptions;
+    Cursor mainCursor;
+    Label equippedHeader;
+    Label footerSlots[4], footerNames[4];
+    
+    // Scroll selection
+    Panel scrollPanel;
+    Label scrollTitle, scrollCount;
+    ListWidget scrollNames, scrollTiers, scrollElements;
+    Label scrollControls;
+    Cursor scrollCursor;
+    Label noScrollsTitle, noScrollsHint1, noScrollsHint2, noScrollsReturn;
+    
+    // Spell management
+    Panel managePanel;
+    Label manageTitle, manageEquipped;
+    ListWidget slotNames, slotElements;
+    Label knownHeader;
+    ListWidget knownList;
+    Label knownMore;
+    Label manageControls;
+    Cursor manageCursor;
+    
+    // Spell replacement
+    Panel replacePanel;
+    Label replaceTitle, replaceSlot;
+    Label currentLabel, currentName;
+    Label availableHeader;
+    ListWidget replaceNames, replaceElements;
+    Label replaceControls;
+    Cursor replaceCursor;
+    
+    // Rest result
+    Panel restPanel;
+    Label restTitle, restLine1, restLine2, restGold;
+    Label restPrompt1, restPrompt2;
+    
+    // Popups (shown until a button is pressed)
+    Panel knownPanel;
+    Label knownTitle, knownLine1, knownLine2, knownPrompt;
+    
+    Panel equippedPanel;
+    Label equippedTitle, equippedName, equippedSlot, equippedPrompt;
+    
+    Panel learnedPanel;
+    Label learnedTop, learnedBottom;
+    Label learnedName, learnedElement, learnedPower;
+    Label learnedHint1, learnedHint2, learnedHint3, learnedPrompt;
+    
+    // Screen switching (fills the widgets, then shows the panel)
+    void showMainMenu();
+    void showScrollSelection();
+    void showSpellManagement();
+    void showSpellReplacement();
+    void showRestResult(bool success, const char* message);
+    void showSpellLearned(const Spell* spell);
+    
+    // Widget updates from player / scroll state
+    void updateMainMenuWidgets();
+    void updateScrollWidgets();
+    void updateSpellManagementWidgets();
+    void updateSpellReplacementWidgets();
     
     // Input handling
     void handleMainMenuInput();
@@ -118,13 +153,17 @@ public:
     void exit() override;
     
     // Scroll management (called by other systems)
-    void addAvailableScroll(Spell* spell);
+    void addAvailableScroll(const Spell* spell);
     void giveScrollReward(int spellID);
     void giveBossScrollReward();
     void giveRandomScroll();
     
     // GameStateManager access
     void setGameStateManager(GameStateManager* gsm) { gameStateManager = gsm; }
+    
+    // NEW: Rest rule, shared with the host run simulator. Returns nullptr
+    // after resting, otherwise the reason the player couldn't.
+    static const char* restPlayer(Player* player);
 };
 
 #endif // LIBRARY_ROOM_STATE_H
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "RoomState.h"
+#include "../debug/Log.h"
 
 RoomState::RoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm, GameStateManager* gsm) 
     : GameState(disp, inp) {
@@ -12,7 +13,7 @@ RoomState::RoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonMana
 }
 
 void RoomState::enter() {
-    Serial.println("Entering Room State");
+    LOG_INFO(ROOM, "Entering Room State");
     roomCompleted = false;
     roomEntered = false;
     
@@ -22,11 +23,11 @@ void RoomState::enter() {
     }
     
     if (currentRoom) {
-        Serial.println("Entering: " + currentRoom->getRoomName());
+        LOG_INFO(ROOM, "Entering: %s", currentRoom->getRoomName().c_str());
         enterRoom(); // Call room-specific enter logic
         roomEntered = true;
     } else {
-        Serial.println("Error: No current room found!");
+        LOG_INFO(ROOM, "Error: No current room found!");
         returnToDoorChoice();
     }
 }
@@ -44,7 +45,7 @@ void RoomState::update() {
 }
 
 void RoomState::exit() {
-    Serial.println("Exiting Room State");
+    LOG_INFO(ROOM, "Exiting Room State");
     roomEntered = false;
 }
 
@@ -60,7 +61,7 @@ void RoomState::completeRoom() {
     if (dungeonManager) {
         dungeonManager->markRoomCompleted();
     }
-    Serial.println("Room completed!");
+    LOG_INFO(ROOM, "Room completed!");
 }
 
 void RoomState::returnToDoorChoice() {
@@ -1,15 +1,88 @@
 #include "ShopRoomState.h"
+#include "../utils/constants.h"
+#include "../debug/Log.h"
+
+#define SHOP_OPTIONS_Y 200
+#define SHOP_OPTION_SPACING 20
+
+ShopRoomState::OptionRow::OptionRow()
+    : box(5, 0, 160, 18),
+      cursor(10, 0, ">") {
+    box.setFilled(true);
+    box.add(&cursor);
+    box.add(&text);
+}
+
+void ShopRoomState::OptionRow::place(int y) {
+    box.moveTo(5, y - 3);
+    cursor.moveTo(10, y);
+    text.moveTo(25, y);
+}
+
+void ShopRoomState::OptionRow::setSelected(bool selected) {
+    box.setBackground(selected ? TFT_BLUE : TFT_BLACK);
+    cursor.setVisible(selected);
+}
 
 ShopRoomState::ShopRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
-    : RoomState(disp, inp, p, e, dm) {
+    : RoomState(disp, inp, p, e, dm),
+      shopPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      title(65, 15, "SHOP", TFT_WHITE, 2),
+      greeting(15, 40, "\"Welcome, traveler!\""),
+      merchant(10, 55, "- Mysterious Merchant"),
+      goldLabel(10, 80),
+      hpLabel(10, 95),
+      itemsHeader(10, 120, "Available Items:"),
+      goldWarning(10, 250, "(Not enough gold!)", TFT_RED),
+      navigateHint(10, 270, "UP/DOWN: Navigate"),
+      selectHint(10, 285, "A: Select, B: Leave"),
+      resultPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      resultTitle(0, 100, "", TFT_WHITE, 2),
+      resultMessage(30, 130),
+      resultGold(40, 150),
+      resultPotions(40, 165),
+      resultPrompt1(25, 190, "Press any button"),
+      resultPrompt2(40, 205, "to continue") {
     selectedOption = 0;
     maxOptions = 2; // Buy something, Leave
     screenDrawn = false;
-    lastSelectedOption = -1;
+    
+    // Shop items (placeholder)
+    itemLines[0].set("- Health Potion (25g)", TFT_GREEN);
+    itemLines[1].set("- Mystery Item (50g)", TFT_WHITE);
+    itemLines[2].set("- Gear Upgrade (100g)", TFT_BLUE);
+    
+    shopPanel.add(&title);
+    shopPanel.add(&greeting);
+    shopPanel.add(&merchant);
+    shopPanel.add(&goldLabel);
+    shopPanel.add(&hpLabel);
+    shopPanel.add(&itemsHeader);
+    for (int i = 0; i < 3; i++) {
+        itemLines[i].moveTo(15, 135 + i * 15);
+        shopPanel.add(&itemLines[i]);
+    }
+    
+    const char* optionText[2] = {"Buy Health Potion", "Leave Shop"};
+    for (int i = 0; i < 2; i++) {
+        options[i].place(SHOP_OPTIONS_Y + i * SHOP_OPTION_SPACING);
+        options[i].text.setText(optionText[i]);
+        shopPanel.add(&options[i].box);
+    }
+    shopPanel.add(&goldWarning);
+    shopPanel.add(&navigateHint);
+    shopPanel.add(&selectHint);
+    
+    resultPanel.add(&resultTitle);
+    resultPanel.add(&resultMessage);
+    resultPanel.add(&resultGold);
+    resultPanel.add(&resultPotions);
+    resultPanel.add(&resultPrompt1);
+    resultPanel.add(&resultPrompt2);
 }
 
 void ShopRoomState::enterRoom() {
-    Serial.println("Welcome to the mysterious shop...");
+    LOG_INFO(ROOM, "Welcome to the mysterious shop...");
     selectedOption = 0;
     screenDrawn = false;
     drawShopScreen();
@@ -18,65 +91,33 @@ void ShopRoomState::enterRoom() {
 void ShopRoomState::handleRoomInteraction() {
     handleShopInput();
     
-    // Redraw if selection changed
-    if (lastSelectedOption != selectedOption || !screenDrawn) {
-        drawShopScreen();
-    }
+    // Widgets only repaint what changed (usually just the selection)
+    drawShopScreen();
 }
 
 void ShopRoomState::exitRoom() {
-    Serial.println("You leave the shop behind...");
+    LOG_INFO(ROOM, "You leave the shop behind...");
 }
 
 void ShopRoomState::drawShopScreen() {
-    display->clear();
-    
-    // Title and atmosphere
-    display->drawText("SHOP", 65, 15, TFT_WHITE, 2);
-    display->drawText("\"Welcome, traveler!\"", 15, 40, TFT_WHITE);
-    display->drawText("- Mysterious Merchant", 10, 55, TFT_WHITE, 1);
-    
     // Player status
-    display->drawText(("Gold: " + String(player->getGold())).c_str(), 
-                     10, 80, TFT_WHITE);
-    display->drawText(("HP: " + String(player->getCurrentHP()) + "/" + String(player->getMaxHP())).c_str(), 
-                     10, 95, TFT_WHITE);
-    
-    // Shop items (placeholder)
-    display->drawText("Available Items:", 10, 120, TFT_WHITE);
-    display->drawText("- Health Potion (25g)", 15, 135, TFT_GREEN);
-    display->drawText("- Mystery Item (50g)", 15, 150, TFT_WHITE);
-    display->drawText("- Equipment Upgrade (100g)", 15, 165, TFT_BLUE);
-    
-    // Menu options
-    int yStart = 200;
-    int ySpacing = 20;
-    const char* options[2] = {"Buy Health Potion", "Leave Shop"};
+    goldLabel.setText(WidgetText::format("Gold: %d", player->getGold()));
+    hpLabel.setText(WidgetText::format("HP: %d/%d", player->getCurrentHP(), player->getMaxHP()));
     
+    // Highlight selected option
     for (int i = 0; i < maxOptions; i++) {
-        int yPos = yStart + (i * ySpacing);
-        
-        // Highlight selected option
-        if (i == selectedOption) {
-            display->fillRect(5, yPos - 3, 160, 18, TFT_BLUE);
-            display->drawText(">", 10, yPos, TFT_WHITE);
-            display->drawText(options[i], 25, yPos, TFT_WHITE);
-        } else {
-            display->drawText(options[i], 25, yPos, TFT_WHITE);
-        }
+        options[i].setSelected(i == selectedOption);
     }
     
     // Show affordability
-    if (selectedOption == 0 && player->getGold() < 25) {
-        display->drawText("(Not enough gold!)", 10, 250, TFT_RED);
-    }
-    
-    // Controls
-    display->drawText("UP/DOWN: Navigate", 10, 270, TFT_WHITE, 1);
-    display->drawText("A: Select, B: Leave", 10, 285, TFT_WHITE, 1);
+    goldWarning.setVisible(selectedOption == 0 && player->getGold() < HEALTH_POTION_COST);
     
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
+    if (screenDrawn) {
+        shopPanel.render(display);
+    } else {
+        shopPanel.show(display);
+        screenDrawn = true;
+    }
 }
 
 void ShopRoomState::handleShopInput() {
@@ -116,46 +157,47 @@ void ShopRoomState::handleShopInput() {
 }
 
 void ShopRoomState::buyHealthPotion() {
-    const int POTION_COST = 25;
-    
-    if (player->getGold() < POTION_COST) {
+    if (!purchaseHealthPotion(player)) {
         showPurchaseResult(false, "Not enough gold!");
         return;
     }
     
-    // Make the purchase
-    player->spendGold(POTION_COST);
-    player->addHealthPotions(1);
-    
     showPurchaseResult(true, "Bought Health Potion!");
-    Serial.println("Player bought health potion for " + String(POTION_COST) + " gold");
+    LOG_INFO(ROOM, "Player bought health potion for %d gold", HEALTH_POTION_COST);
 }
 
-void ShopRoomState::showPurchaseResult(bool success, String message) {
-    display->clear();
+bool ShopRoomState::purchaseHealthPotion(Player* player) {
+    if (player->getGold() < HEALTH_POTION_COST) {
+        return false;
+    }
     
+    player->spendGold(HEALTH_POTION_COST);
+    player->addHealthPotions(1);
+    return true;
+}
+
+void ShopRoomState::showPurchaseResult(bool success, const char* message) {
     if (success) {
-        display->drawText("Purchase Success!", 20, 100, TFT_GREEN, 2);
-        display->drawText(message.c_str(), 30, 130, TFT_WHITE);
-        display->drawText(("Gold: " + String(player->getGold())).c_str(), 
-                         40, 150, TFT_WHITE);
-        display->drawText(("Potions: " + String(player->getHealthPotions())).c_str(), 
-                         40, 165, TFT_WHITE);
+        resultTitle.moveTo(30, 100);
+        resultTitle.set("Purchased!", TFT_GREEN);
+        resultGold.setText(WidgetText::format("Gold: %d", player->getGold()));
+        resultPotions.setText(WidgetText::format("Potions: %d", player->getHealthPotions()));
     } else {
-        display->drawText("Cannot Buy!", 35, 100, TFT_RED, 2);
-        display->drawText(message.c_str(), 30, 130, TFT_WHITE);
+        resultTitle.moveTo(35, 100);
+        resultTitle.set("Cannot Buy!", TFT_RED);
     }
+    resultMessage.setText(message);
+    resultGold.setVisible(success);
+    resultPotions.setVisible(success);
     
-    display->drawText("Press any button", 25, 190, TFT_WHITE);
-    display->drawText("to continue", 40, 205, TFT_WHITE);
+    resultPanel.show(display);
     
+    display->flush();  // NEW: Present the message before waiting
+
     // Wait for input
     while (true) {
         input->update();
-        if (input->wasPressed(Button::UP) || 
-            input->wasPressed(Button::DOWN) ||
-            input->wasPressed(Button::A) || 
-            input->wasPressed(Button::B)) {
+        if (input->wasAnyPressed()) {
             break;
         }
         delay(10);
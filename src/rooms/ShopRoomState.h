@@ -2,6 +2,7 @@
 #define SHOP_ROOM_STATE_H
 
 #include "RoomState.h"
+#include "../ui/Widgets.h"
 
 enum class ShopAction {
     BUY_POTION = 0,
@@ -14,11 +15,35 @@ private:
     int selectedOption;
     int maxOptions;
     bool screenDrawn;
-    int lastSelectedOption;
+    
+    // NEW: One menu row: a box filled blue while selected, with the cursor
+    // and the option text inside
+    struct OptionRow {
+        Panel box;
+        Label cursor;
+        Label text;
+        
+        OptionRow();
+        void place(int y);
+        void setSelected(bool selected);
+    };
+    
+    // NEW: Retained screens - switching between them only erases widgets
+    Panel shopPanel;
+    Label title, greeting, merchant;
+    Label goldLabel, hpLabel;
+    Label itemsHeader, itemLines[3];
+    OptionRow options[2];
+    Label goldWarning;
+    Label navigateHint, selectHint;
+    
+    Panel resultPanel;
+    Label resultTitle, resultMessage, resultGold, resultPotions;
+    Label resultPrompt1, resultPrompt2;
     
     // Drawing methods
     void drawShopScreen();
-    void showPurchaseResult(bool success, String message);
+    void showPurchaseResult(bool success, const char* message);
     
     // Input handling
     void handleShopInput();
@@ -34,6 +59,10 @@ public:
     void enterRoom() override;
     void handleRoomInteraction() override;
     void exitRoom() override;
+    
+    // NEW: Purchase rule, shared with the host run simulator. Spends the gold
+    // and adds the potion; false if the player can't afford it.
+    static bool purchaseHealthPotion(Player* player);
 };
 
 #endif
\ No newline at end of file
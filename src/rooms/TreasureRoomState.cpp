@@ -2,9 +2,31 @@
 #include "../spells/spell.h"
 #include "../game/GameStateManager.h"
 #include "../dungeon/Floor.h"  // ADDED: Need Floor class for room completion
+#include "../debug/Log.h"
 
 TreasureRoomState::TreasureRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
-    : GameState(disp, inp) {
+    : GameState(disp, inp),
+      chestPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      titleTop(40, 15, "ANCIENT", TFT_BROWN, 2),
+      titleBottom(52, 30, "CHEST", TFT_BROWN, 2),
+      flavor1(30, 70, "Mystic energy fills"),
+      flavor2(55, 85, "the air..."),
+      seeHeader(10, 140, "You see:"),
+      options(25, 215, 0, 20),
+      emptyLine1(15, 150, "The room is empty now.", TFT_GREEN),
+      emptyLine2(20, 170, "Only dust remains...", TFT_GREEN),
+      leavePrompt1(0, 210, "Press any button"),
+      leavePrompt2(55, 225, "to leave"),
+      resultPanel(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT),
+      foundTitle(10, 50, "SCROLL FOUND!", TFT_WHITE, 2),
+      tierLabel(0, 120),
+      elementLabel(60, 120),
+      energy1(0, 135, "energy emminates from the"),
+      energy2(0, 150, "dusty scroll."),
+      visit1(25, 200, "Visit the Library"),
+      visit2(20, 215, "to read the scroll!"),
+      resultPrompt1(25, 240, "Press any button"),
+      resultPrompt2(40, 255, "to continue") {
     player = p;
     currentEnemy = e;
     dungeonManager = dm;
@@ -12,12 +34,48 @@ TreasureRoomState::TreasureRoomState(Display* disp, Input* inp, Player* p, Enemy
     selectedOption = 0;
     maxOptions = 2; // Take treasure, Leave
     screenDrawn = false;
-    lastSelectedOption = -1;
     treasureLooted = false;
+    
+    // Treasure description - CHANGED: Only show scroll
+    seeLines[0].setText("  Ancient scroll");
+    seeLines[1].setText("  glowing with");
+    seeLines[2].setText("  strange power");
+    
+    // Menu options, cursor left of each
+    options.setCount(maxOptions);
+    options.setItem(0, "Take Scroll");
+    options.setItem(1, "Leave Empty-Handed");
+    options.layoutCursor(cursor, -15, 0);
+    
+    chestPanel.add(&titleTop);
+    chestPanel.add(&titleBottom);
+    chestPanel.add(&flavor1);
+    chestPanel.add(&flavor2);
+    chestPanel.add(&seeHeader);
+    for (int i = 0; i < 3; i++) {
+        seeLines[i].moveTo(15, 155 + i * 15);
+        chestPanel.add(&seeLines[i]);
+    }
+    chestPanel.add(&options);
+    chestPanel.add(&cursor);
+    chestPanel.add(&emptyLine1);
+    chestPanel.add(&emptyLine2);
+    chestPanel.add(&leavePrompt1);
+    chestPanel.add(&leavePrompt2);
+    
+    resultPanel.add(&foundTitle);
+    resultPanel.add(&tierLabel);
+    resultPanel.add(&elementLabel);
+    resultPanel.add(&energy1);
+    resultPanel.add(&energy2);
+    resultPanel.add(&visit1);
+    resultPanel.add(&visit2);
+    resultPanel.add(&resultPrompt1);
+    resultPanel.add(&resultPrompt2);
 }
 
 void TreasureRoomState::enter() {
-    Serial.println("You discover a treasure room!");
+    LOG_INFO(ROOM, "You discover a treasure room!");
     selectedOption = 0;
     treasureLooted = false;
     screenDrawn = false;
@@ -27,72 +85,39 @@ void TreasureRoomState::enter() {
 void TreasureRoomState::update() {
     handleTreasureInput();
     
-    // Redraw if selection changed
-    if (lastSelectedOption != selectedOption || !screenDrawn) {
-        drawTreasureScreen();
-    }
+    // Widgets only repaint what changed (usually just the cursor)
+    drawTreasureScreen();
 }
 
 void TreasureRoomState::exit() {
-    Serial.println("You leave the treasure room behind...");
+    LOG_INFO(ROOM, "You leave the treasure room behind...");
 }
 
 void TreasureRoomState::drawTreasureScreen() {
-    display->clear();
-    
-    // Title and atmosphere
-    display->drawText("ANCIENT", 40, 15, TFT_BROWN, 2);
-    display->drawText("CHEST", 52, 30, TFT_BROWN, 2);
-    display->drawText("Mystic energy fills", 30, 70, TFT_WHITE);
-    display->drawText("the air...", 55, 85, TFT_WHITE);
-    
-    // Treasure description - CHANGED: Only show scroll
-    if (!treasureLooted) {
-        display->drawText("You see:", 10, 140, TFT_WHITE);
-        display->drawText("  Ancient scroll", 15, 155, TFT_WHITE);
-        display->drawText("  glowing with", 15, 170, TFT_WHITE);
-        display->drawText("  strange power", 15, 185, TFT_WHITE);
-        
-        // Menu options
-        int yStart = 215;
-        int ySpacing = 20;
-        const char* options[2] = {"Take Scroll", "Leave Empty-Handed"};
-        
-        for (int i = 0; i < maxOptions; i++) {
-            int yPos = yStart + (i * ySpacing);
-            
-            // Highlight selected option
-            if (i == selectedOption) {
-                display->drawText(">", 10, yPos, TFT_WHITE);
-                display->drawText(options[i], 25, yPos, TFT_WHITE);
-            } else {
-                display->drawText(options[i], 25, yPos, TFT_WHITE);
-            }
-        }
-    } else {
-        display->drawText("The room is empty now.", 15, 150, TFT_GREEN);
-        display->drawText("Only dust remains...", 20, 170, TFT_GREEN);
-        
-        display->drawText("Press any button", 0, 210, TFT_WHITE);
-        display->drawText("to leave", 55, 225, TFT_WHITE);
+    // Scroll and menu until looted, then the empty room
+    seeHeader.setVisible(!treasureLooted);
+    for (int i = 0; i < 3; i++) {
+        seeLines[i].setVisible(!treasureLooted);
     }
+    options.setVisible(!treasureLooted);
+    cursor.select(treasureLooted ? -1 : selectedOption);
+    emptyLine1.setVisible(treasureLooted);
+    emptyLine2.setVisible(treasureLooted);
+    leavePrompt1.setVisible(treasureLooted);
+    leavePrompt2.setVisible(treasureLooted);
     
-    // Controls
-    if (!treasureLooted) {
-        
+    if (screenDrawn) {
+        chestPanel.render(display);
+    } else {
+        chestPanel.show(display);
+        screenDrawn = true;
     }
-    
-    screenDrawn = true;
-    lastSelectedOption = selectedOption;
 }
 
 void TreasureRoomState::handleTreasureInput() {
     if (treasureLooted) {
         // Any button leaves after treasure is taken
-        if (input->wasPressed(Button::UP) || 
-            input->wasPressed(Button::DOWN) ||
-            input->wasPressed(Button::A) || 
-            input->wasPressed(Button::B)) {
+        if (input->wasAnyPressed()) {
             completeRoom();
         }
         return;
@@ -135,9 +160,9 @@ void TreasureRoomState::handleTreasureInput() {
 
 void TreasureRoomState::takeTreasure() {
     // CHANGED: Only generate scroll, no gold or potions
-    Spell* foundScroll = generateRandomScroll();
-    String scrollName = foundScroll ? foundScroll->getName() : "Unknown Scroll";
-    String elementName = foundScroll ? foundScroll->getElementName() : "Arcane";
+    const Spell* foundScroll = generateRandomScroll();
+    FlashString scrollName = foundScroll ? foundScroll->getName() : FlashString("Unknown Scroll");
+    const char* elementName = foundScroll ? foundScroll->getElementName() : "Arcane";
     
     // Show treasure result - CHANGED: Only show scroll
     showTreasureResult(foundScroll);
@@ -148,54 +173,48 @@ void TreasureRoomState::takeTreasure() {
     treasureLooted = true;
     screenDrawn = false; // Force redraw
     
-    Serial.println("Player found scroll: " + scrollName + " (" + elementName + ")");
+    LOG_INFO(ROOM, "Player found scroll: %s (%s)", scrollName.c_str(), elementName);
     
     // ADDED: Immediately complete the room after taking treasure
-    Serial.println("DEBUG: Treasure taken, completing room immediately");
+    LOG_DEBUG(ROOM, "Treasure taken, completing room immediately");
     completeRoom();
 }
 
-void TreasureRoomState::showTreasureResult(Spell* foundScroll) {
-    display->clear();
-    
-    display->drawText("SCROLL FOUND!", 10, 50, TFT_WHITE, 2);
-    
+void TreasureRoomState::showTreasureResult(const Spell* foundScroll) {
     if (foundScroll) {
-
-        display->drawText((foundScroll->getElementName()).c_str(), 60, 120, TFT_WHITE);
-        display->drawText("energy emminates from the", 0, 135, TFT_WHITE);
-        display->drawText("dusty scroll.", 0, 150, TFT_WHITE); 
-
+        elementLabel.setText(foundScroll->getElementName());
+        
         // Show tier information
-        String tier = "Weak";
+        const char* tier = "Weak";
         if (foundScroll->getBasePower() > 25) tier = "Intense";
         else if (foundScroll->getBasePower() > 20) tier = "Mid";
-        display->drawText(tier.c_str(), 0, 120, TFT_WHITE);
+        tierLabel.setText(tier);
     }
+    tierLabel.setVisible(foundScroll != nullptr);
+    elementLabel.setVisible(foundScroll != nullptr);
+    energy1.setVisible(foundScroll != nullptr);
+    energy2.setVisible(foundScroll != nullptr);
     
-    display->drawText("Visit the Library", 25, 200, TFT_WHITE);
-    display->drawText("to read the scroll!", 20, 215, TFT_WHITE);
-    
-    display->drawText("Press any button", 25, 240, TFT_WHITE);
-    display->drawText("to continue", 40, 255, TFT_WHITE);
+    resultPanel.show(display);
     
+    display->flush();  // NEW: Present the message before waiting
+
     // Wait for input
     while (true) {
         input->update();
-        if (input->wasPressed(Button::UP) || 
-            input->wasPressed(Button::DOWN) ||
-            input->wasPressed(Button::A) || 
-            input->wasPressed(Button::B)) {
+        if (input->wasAnyPressed()) {
             break;
         }
         delay(10);
     }
 }
 
-Spell* TreasureRoomState::generateRandomScroll() {
+const Spell* TreasureRoomState::generateRandomScroll() {
     // Generate scroll based on current floor for progression
-    int currentFloor = dungeonManager->getCurrentFloorNumber();
-    
+    return generateScrollForFloor(dungeonManager->getCurrentFloorNumber());
+}
+
+const Spell* TreasureRoomState::generateScrollForFloor(int currentFloor) {
     // Floor-based spell tier selection
     int minTier = 1;
     int maxTier = 1;
@@ -204,45 +223,43 @@ Spell* TreasureRoomState::generateRandomScroll() {
     if (currentFloor >= 4) maxTier = 3;  // Floor 4+ can drop tier 3 spells
     if (currentFloor >= 3) minTier = 2;  // Floor 3+ won't drop basic spells
     
-    return SpellFactory::createRandomSpell(minTier, maxTier);
+    return SpellFactory::getRandomSpell(minTier, maxTier);
 }
 
-void TreasureRoomState::giveScrollToLibrary(Spell* scroll) {
+void TreasureRoomState::giveScrollToLibrary(const Spell* scroll) {
     if (scroll && gameStateManager) {
-        Serial.println("TreasureRoom: Adding scroll to global inventory: " + scroll->getName());
+        LOG_INFO(ROOM, "TreasureRoom: Adding scroll to global inventory: %s", scroll->getName().c_str());
         gameStateManager->addScroll(scroll);
-        Serial.println("Scroll will be available in the Library!");
+        LOG_INFO(ROOM, "Scroll will be available in the Library!");
     } else if (scroll) {
-        Serial.println("WARNING: No GameStateManager reference, deleting scroll");
-        // Don't add to player directly - just delete it
-        delete scroll;
+        LOG_WARN(ROOM, "No GameStateManager reference, dropping scroll");
     }
 }
 
 void TreasureRoomState::completeRoom() {
-    Serial.println("=== DEBUG: TreasureRoomState::completeRoom() START ===");
+    LOG_DEBUG(ROOM, "=== TreasureRoomState::completeRoom() START ===");
     
     // Direct approach: Just increment the dungeon progress (same as library fix)
     if (dungeonManager) {
-        Serial.println("DEBUG: DungeonManager exists");
+        LOG_DEBUG(ROOM, "DungeonManager exists");
         Floor* currentFloor = dungeonManager->getCurrentFloor();
         if (currentFloor) {
-            Serial.println("DEBUG: Current floor exists");
-            Serial.println("DEBUG: Rooms completed BEFORE: " + String(currentFloor->getRoomsCompleted()));
+            LOG_DEBUG(ROOM, "Current floor exists");
+            LOG_DEBUG(ROOM, "Rooms completed BEFORE: %d", currentFloor->getRoomsCompleted());
             
             // Directly increment the room completion counter
             currentFloor->incrementRoomsCompleted();
             
-            Serial.println("DEBUG: Rooms completed AFTER: " + String(currentFloor->getRoomsCompleted()));
-            Serial.println("DEBUG: Treasure room completion - SUCCESS");
+            LOG_DEBUG(ROOM, "Rooms completed AFTER: %d", currentFloor->getRoomsCompleted());
+            LOG_DEBUG(ROOM, "Treasure room completion - SUCCESS");
         } else {
-            Serial.println("ERROR: No current floor found!");
+            LOG_ERROR(ROOM, "No current floor found!");
         }
     } else {
-        Serial.println("ERROR: No dungeon manager found!");
+        LOG_ERROR(ROOM, "No dungeon manager found!");
     }
     
-    Serial.println("=== DEBUG: TreasureRoomState::completeRoom() END ===");
-    Serial.println("TREASURE ROOM COMPLETED WITH PROGRESS");
+    LOG_DEBUG(ROOM, "=== TreasureRoomState::completeRoom() END ===");
+    LOG_INFO(ROOM, "TREASURE ROOM COMPLETED WITH PROGRESS");
     requestStateChange(StateTransition::DOOR_CHOICE);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "../entities/player.h"
 #include "../entities/enemy.h"
 #include "../dungeon/DungeonManager.h"
+#include "../ui/Widgets.h"
 
 // Forward declarations
 class Spell;
@@ -28,12 +29,25 @@ private:
     int selectedOption;
     int maxOptions;
     bool screenDrawn;
-    int lastSelectedOption;
     bool treasureLooted;
     
+    // NEW: Retained screens - switching between them only erases widgets
+    Panel chestPanel;
+    Label titleTop, titleBottom;
+    Label flavor1, flavor2;
+    Label seeHeader, seeLines[3];
+    ListWidget options;
+    Cursor cursor;
+    Label emptyLine1, emptyLine2, leavePrompt1, leavePrompt2;
+    
+    Panel resultPanel;
+    Label foundTitle;
+    Label tierLabel, elementLabel, energy1, energy2;
+    Label visit1, visit2, resultPrompt1, resultPrompt2;
+    
     // Drawing methods - UPDATED: Only show scroll result
     void drawTreasureScreen();
-    void showTreasureResult(Spell* foundScroll);  // CHANGED: Only scroll parameter
+    void showTreasureResult(const Spell* foundScroll);  // CHANGED: Only scroll parameter
     
     // Input handling
     void handleTreasureInput();
@@ -43,8 +57,8 @@ private:
     void completeRoom();
     
     // Scroll generation and management
-    Spell* generateRandomScroll();
-    void giveScrollToLibrary(Spell* scroll);
+    const Spell* generateRandomScroll();
+    void giveScrollToLibrary(const Spell* scroll);
     
 public:
     TreasureRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm);
@@ -57,6 +71,9 @@ public:
     
     // NEW: Set GameStateManager reference
     void setGameStateManager(GameStateManager* gsm) { gameStateManager = gsm; }
+    
+    // NEW: Scroll drop for a floor, shared with the host run simulator
+    static const Spell* generateScrollForFloor(int floorNumber);
 };
 
 #endif
\ No newline at end of file
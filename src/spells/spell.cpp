@@ -1,154 +1,195 @@
 #include "spell.h"
 #include "../entities/player.h"
 #include "../entities/enemy.h"
-#include "../combat/CombatTextBox.h"  // NEW: Include text box
 #include <TFT_eSPI.h>  // Add this for TFT color constants
+#include "../debug/Log.h"
+#include "../debug/Trace.h"
+#include "../utils/Rng.h"
+#include "../utils/constants.h"
 
 // Static member definition for Meditate
-int Meditate::consecutiveUses = 0;
+thread_local int Meditate::consecutiveUses = 0;
 
 //============================================================================
-// SPELL BASE CLASS IMPLEMENTATION
+// SPELL DEFINITIONS
 //============================================================================
 
-Spell::Spell(int id, String spellName, ElementType elem, SpellEffect effect, int power, int cost) {
-    spellID = id;
-    name = spellName;
-    element = elem;
-    primaryEffect = effect;
-    basePower = power;
-    manaCost = cost;
-    
-    hasSecondaryEffect = false;
-    secondaryEffect = EFFECT_DAMAGE;
-    secondaryPower = 0;
-    duration = 0;
-    
-    // Set default descriptions based on element and effect
-    description = "A " + getElementName() + " spell that " + getEffectName() + ".";
-}
+// Every spell in the game, in ID order (scroll drops pick from this order,
+// tier by tier, so keep it sorted)
+static constexpr Spell spellTable[] = {
+    // Fire spells
+    Spell(1, 1, "Fireball", ELEMENT_FIRE, EFFECT_DAMAGE, 25, 6,
+          "A blazing orb of fire that burns enemies."),
+    Spell(2, 2, "Ignite", ELEMENT_FIRE, EFFECT_DAMAGE_OVER_TIME, 8, 5,
+          "Sets the enemy ablaze, dealing damage over time.",
+          EFFECT_DAMAGE_OVER_TIME, 6, 3),   // 6 damage for 3 turns
+    Spell(3, 3, "Immolation", ELEMENT_FIRE, EFFECT_DAMAGE, 35, 12,
+          "A devastating fire spell that consumes everything."),
+    
+    // Ice spells
+    Spell(11, 1, "Frost Bolt", ELEMENT_ICE, EFFECT_DAMAGE, 20, 5,
+          "A shard of ice that pierces and slows enemies.",
+          EFFECT_DEBUFF, 3, 2, STAT_SPEED),     // -3 speed for 2 turns
+    Spell(12, 2, "Ice Barrier", ELEMENT_ICE, EFFECT_SHIELD, 15, 7,
+          "Creates a protective barrier of magical ice."),
+    Spell(13, 3, "Blizzard", ELEMENT_ICE, EFFECT_DAMAGE, 30, 11,
+          "A freezing storm that devastates the battlefield.",
+          EFFECT_DEBUFF, 5, 2, STAT_ATTACK),    // -5 attack for 2 turns
+    
+    // Lightning spells
+    Spell(21, 1, "Lightning Bolt", ELEMENT_LIGHTNING, EFFECT_DAMAGE, 28, 6,
+          "A crackling bolt of pure electrical energy."),
+    Spell(22, 2, "Chain Lightning", ELEMENT_LIGHTNING, EFFECT_DAMAGE, 22, 8,
+          "Lightning that jumps between targets with increasing power."),
+    Spell(23, 3, "Shock", ELEMENT_LIGHTNING, EFFECT_DEBUFF, 10, 9,
+          "Stuns the enemy, reducing their accuracy and speed.",
+          EFFECT_DEBUFF, 8, 3, STAT_SPEED),     // -10 attack (primary) and -8 speed for 3 turns
+    
+    // Arcane spells
+    Spell(31, 1, "Magic Missile", ELEMENT_ARCANE, EFFECT_DAMAGE, 18, 4,
+          "Reliable arcane projectiles that never miss."),
+    Spell(32, 2, "Arcane Shield", ELEMENT_ARCANE, EFFECT_SHIELD, 20, 8,
+          "A shimmering barrier of pure magical energy.",
+          EFFECT_BUFF, 5, 3),               // +5 to all resistances
+    Spell(33, 3, "Power Surge", ELEMENT_ARCANE, EFFECT_BUFF, 12, 10,
+          "Channels raw magic to enhance all abilities.",
+          EFFECT_BUFF, 8, 4),               // +8 to all stats for 4 turns
+    Spell(34, 1, "Meditate", ELEMENT_ARCANE, EFFECT_HEAL, 5, 0,
+          "Focus your mind to restore mana. Grows stronger with consecutive use.",
+          SPELL_HOOK_MEDITATE),
+    
+    // Earth spells
+    Spell(41, 1, "Stone Spear", ELEMENT_EARTH, EFFECT_DAMAGE, 24, 5,
+          "Conjures a sharp spear of hardened earth."),
+    Spell(42, 2, "Earth Wall", ELEMENT_EARTH, EFFECT_SHIELD, 25, 9,
+          "Raises a protective wall of solid stone.",
+          EFFECT_HEAL, 10, 0),              // Also heals 10 HP
+    Spell(43, 3, "Earthquake", ELEMENT_EARTH, EFFECT_DAMAGE, 32, 13,
+          "Shakes the very foundations of the battlefield.",
+          EFFECT_DEBUFF, 6, 3, STAT_DEFENSE),   // -6 defense for 3 turns
+    
+    // Shadow spells
+    Spell(51, 1, "Shadow Bolt", ELEMENT_SHADOW, EFFECT_DAMAGE, 22, 6,
+          "A bolt of pure darkness that drains life force.",
+          EFFECT_HEAL, 8, 0),               // Heals caster for 8 HP
+    Spell(52, 2, "Drain", ELEMENT_SHADOW, EFFECT_DAMAGE, 15, 7,
+          "Siphons health and energy from the enemy.",
+          EFFECT_HEAL, 15, 0),              // Heals equal to damage
+    Spell(53, 3, "Dark Ritual", ELEMENT_SHADOW, EFFECT_BUFF, 5, 15,
+          "A forbidden ritual that grants immense power.",
+          EFFECT_BUFF, 15, 5),              // +15 damage for 5 turns, but costs HP
+};
+
+#define SPELL_COUNT ((int)(sizeof(spellTable) / sizeof(spellTable[0])))
+
+static const int starterSpellIDs[STARTER_SPELL_COUNT] = {
+    31,  // Magic Missile - reliable damage spell
+    34   // Meditate - mana restoration spell
+};
 
-void Spell::addSecondaryEffect(SpellEffect effect, int power, int dur) {
-    hasSecondaryEffect = true;
-    secondaryEffect = effect;
-    secondaryPower = power;
-    duration = dur;
-}
+//============================================================================
+// SPELL IMPLEMENTATION
+//============================================================================
 
-bool Spell::cast(Player* caster, Enemy* target, const std::vector<Spell*>& otherSpells, CombatTextBox* textBox) {
+bool Spell::cast(Player* caster, Enemy* target, const CastHistory* history, int* synergyOut) const {
+    if (synergyOut) *synergyOut = 0;
+    if (hook == SPELL_HOOK_MEDITATE) {
+        return Meditate::cast(*this, caster, synergyOut);
+    }
+    
+    TRACE_SCOPE(trace, TRACE_SPELL_CAST, spellID);
     if (!caster || !target) return false;
     
     // Check mana cost
     if (caster->getCurrentMana() < manaCost) {
-        Serial.println("Not enough mana to cast " + getName() + "!");
+        LOG_INFO(SPELL, "Not enough mana to cast %s!", getName().c_str());
         return false;
     }
     
     // Reset Meditate consecutive uses if this isn't a Meditate spell
-    if (spellID != 34) {  // 34 is Meditate's ID
-        Meditate::resetConsecutiveUses();
-    }
+    // Any other spell breaks Meditate's streak
+    Meditate::resetConsecutiveUses();
     
     // Spend mana
     caster->spendMana(manaCost);
     
     // Calculate synergy bonus
-    int synergyBonus = calculateSynergyBonus(otherSpells);
+    int synergyBonus = history ? calculateSynergyBonus(*history) : 0;
     int totalPower = basePower + synergyBonus;
     
     // DEBUG: Add this debug output
-    Serial.println("DEBUG base Spell::cast() - spellName: " + getName());
-    Serial.println("DEBUG base Spell::cast() - synergyBonus: " + String(synergyBonus));
-    Serial.println("DEBUG base Spell::cast() - textBox pointer: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
-    
-    // Show synergy bonus in text box if present (ONLY ONCE!)
-    if (textBox && synergyBonus > 0) {
-        Serial.println("DEBUG base Spell::cast() - CALLING textBox->showSynergyBonus() ONCE");
-        textBox->showSynergyBonus(getName(), synergyBonus);
-    } else {
-        Serial.println("DEBUG base Spell::cast() - NOT calling showSynergyBonus - textBox: " + 
-                      String(textBox != nullptr ? "exists" : "null") + 
-                      ", synergyBonus: " + String(synergyBonus));
-    }
+    LOG_DEBUG(SPELL, "base Spell::cast() - spellName: %s", getName().c_str());
+    LOG_DEBUG(SPELL, "base Spell::cast() - synergyBonus: %d", synergyBonus);
+    if (synergyOut) *synergyOut = synergyBonus;
     
     // Apply primary effect
-    switch (primaryEffect) {
+    switch (getPrimaryEffect()) {
         case EFFECT_DAMAGE:
             target->takeDamage(totalPower);
-            Serial.println(getName() + " deals " + String(totalPower) + " damage!");
+            LOG_INFO(SPELL, "%s deals %d damage!", getName().c_str(), totalPower);
             if (synergyBonus > 0) {
-                Serial.println("Synergy bonus: +" + String(synergyBonus) + " damage!");
+                LOG_INFO(SPELL, "Synergy bonus: +%d damage!", synergyBonus);
             }
             break;
             
         case EFFECT_HEAL:
-            if (spellID == 34) {
-                // Special handling for Meditate - it restores mana, not HP
-                caster->restoreMana(totalPower);
-                Serial.println(getName() + " restores " + String(totalPower) + " mana!");
-                if (synergyBonus > 0) {
-                    Serial.println("Deep meditation bonus: +" + String(synergyBonus) + " mana!");
-                }
-            } else {
-                // Regular healing spells restore HP
-                caster->heal(totalPower);
-                Serial.println(getName() + " heals " + String(totalPower) + " HP!");
-            }
+            // Healing spells restore HP (Meditate's mana goes through its hook)
+            caster->heal(totalPower);
+            LOG_INFO(SPELL, "%s heals %d HP!", getName().c_str(), totalPower);
             break;
             
         case EFFECT_SHIELD:
             caster->addSpellEffect(EFFECT_SHIELD, totalPower, 3);
-            Serial.println(getName() + " grants " + String(totalPower) + " shield!");
+            LOG_INFO(SPELL, "%s grants %d shield!", getName().c_str(), totalPower);
             break;
             
         case EFFECT_BUFF:
             caster->addSpellEffect(EFFECT_BUFF, totalPower, duration);
-            Serial.println(getName() + " provides a magical enhancement!");
+            LOG_INFO(SPELL, "%s provides a magical enhancement!", getName().c_str());
             break;
             
         case EFFECT_DEBUFF:
-            // For now, apply debuff to enemy directly (would need enemy spell effect system)
-            Serial.println(getName() + " weakens the enemy!");
+            // Lowers the enemy's attack (accuracy) for the spell's duration
+            target->addSpellEffect(EFFECT_DEBUFF, totalPower, duration, getName(), STAT_ATTACK);
+            LOG_INFO(SPELL, "%s weakens the enemy (-%d attack)!", getName().c_str(), totalPower);
             break;
             
         case EFFECT_DAMAGE_OVER_TIME:
-            // For now, apply immediate damage (would need enemy spell effect system)
+            // The ignition hit; the burn itself is the secondary effect
             target->takeDamage(totalPower);
-            Serial.println(getName() + " inflicts burning damage!");
+            LOG_INFO(SPELL, "%s inflicts burning damage!", getName().c_str());
             break;
     }
     
     // Apply secondary effect if present
     if (hasSecondaryEffect) {
-        switch (secondaryEffect) {
+        switch (getSecondaryEffect()) {
             case EFFECT_HEAL:
-                if (spellID == 34) {
-                    caster->restoreMana(secondaryPower);
-                    Serial.println("  Also restores " + String(secondaryPower) + " mana!");
-                } else {
-                    caster->heal(secondaryPower);
-                    Serial.println("  Also heals " + String(secondaryPower) + " HP!");
-                }
+                caster->heal(secondaryPower);
+                LOG_INFO(SPELL, "  Also heals %d HP!", secondaryPower);
                 break;
             case EFFECT_DAMAGE_OVER_TIME:
-                target->takeDamage(secondaryPower);
-                Serial.println("  Also burns for " + String(secondaryPower) + " damage!");
+                target->addSpellEffect(EFFECT_DAMAGE_OVER_TIME, secondaryPower, duration, getName());
+                LOG_INFO(SPELL, "  Also burns for %d damage a turn for %d turns!", secondaryPower, duration);
                 break;
             case EFFECT_DEBUFF:
-                Serial.println("  Also applies debuff!");
+                target->addSpellEffect(EFFECT_DEBUFF, secondaryPower, duration, getName(), getDebuffStat());
+                LOG_INFO(SPELL, "  Also applies -%d %s for %d turns!", secondaryPower,
+                         getStatName(getDebuffStat()), duration);
                 break;
             case EFFECT_BUFF:
                 caster->addSpellEffect(EFFECT_BUFF, secondaryPower, duration);
-                Serial.println("  Also provides enhancement!");
+                LOG_INFO(SPELL, "  Also provides enhancement!");
                 break;
         }
     }
     
+    trace.setResult(synergyBonus);
     return true;
 }
 
-String Spell::getElementName() const {
-    switch (element) {
+const char* Spell::getElementName() const {
+    switch (getElement()) {
         case ELEMENT_FIRE: return "Fire";
         case ELEMENT_ICE: return "Ice";
         case ELEMENT_LIGHTNING: return "Lightning";
@@ -159,8 +200,8 @@ String Spell::getElementName() const {
     }
 }
 
-String Spell::getEffectName() const {
-    switch (primaryEffect) {
+const char* Spell::getEffectName() const {
+    switch (getPrimaryEffect()) {
         case EFFECT_DAMAGE: return "damages enemies";
         case EFFECT_HEAL: return "restores health";
         case EFFECT_SHIELD: return "provides protection";
@@ -171,8 +212,17 @@ String Spell::getEffectName() const {
     }
 }
 
+const char* Spell::getStatName(StatusStat stat) {
+    switch (stat) {
+        case STAT_ATTACK: return "attack";
+        case STAT_DEFENSE: return "defense";
+        case STAT_SPEED: return "speed";
+        default: return "all stats";
+    }
+}
+
 uint16_t Spell::getElementColor() const {
-    switch (element) {
+    switch (getElement()) {
         case ELEMENT_FIRE: return TFT_RED;
         case ELEMENT_ICE: return TFT_WHITE;
         case ELEMENT_LIGHTNING: return TFT_WHITE;
@@ -183,107 +233,108 @@ uint16_t Spell::getElementColor() const {
     }
 }
 
-int Spell::calculateSynergyBonus(const std::vector<Spell*>& recentSpells) const {
-    int bonus = 0;
-    
-    for (Spell* recentSpell : recentSpells) {
-        if (!recentSpell) continue;
-        
-        // Same element bonus
-        if (recentSpell->getElement() == element) {
-            bonus += 5; // +5 damage for same element
-        }
-        
-        // Specific synergies
-        ElementType recent = recentSpell->getElement();
-        
-        switch (element) {
-            case ELEMENT_FIRE:
-                if (recent == ELEMENT_ICE) bonus += 8; // Steam explosion
-                if (recent == ELEMENT_EARTH) bonus += 6; // Molten rock
-                break;
-            case ELEMENT_ICE:
-                if (recent == ELEMENT_FIRE) bonus += 8; // Steam explosion
-                if (recent == ELEMENT_LIGHTNING) bonus += 7; // Supercooled lightning
-                break;
-            case ELEMENT_LIGHTNING:
-                if (recent == ELEMENT_ICE) bonus += 7; // Supercooled lightning
-                if (recent == ELEMENT_ARCANE) bonus += 6; // Arcane storm
-                break;
-            case ELEMENT_ARCANE:
-                if (recent == ELEMENT_LIGHTNING) bonus += 6; // Arcane storm
-                if (recent == ELEMENT_SHADOW) bonus += 9; // Void magic
-                break;
-            case ELEMENT_EARTH:
-                if (recent == ELEMENT_FIRE) bonus += 6; // Molten rock
-                if (recent == ELEMENT_SHADOW) bonus += 5; // Cursed earth
-                break;
-            case ELEMENT_SHADOW:
-                if (recent == ELEMENT_ARCANE) bonus += 9; // Void magic
-                if (recent == ELEMENT_EARTH) bonus += 5; // Cursed earth
-                break;
-        }
+// Bonus power for casting the row's element once per recent cast of the
+// column's element; the pairs work in either order
+#define SAME SPELL_SYNERGY_BONUS
+static constexpr uint8_t elementSynergy[ELEMENT_COUNT][ELEMENT_COUNT] = {
+    // Fire  Ice  Ltng  Arcn  Erth  Shdw
+    {SAME,   8,    0,    0,    6,    0},     // Fire: steam explosion, molten rock
+    {8,      SAME, 7,    0,    0,    0},     // Ice: steam explosion, supercooled lightning
+    {0,      7,    SAME, 6,    0,    0},     // Lightning: supercooled lightning, arcane storm
+    {0,      0,    6,    SAME, 0,    9},     // Arcane: arcane storm, void magic
+    {6,      0,    0,    0,    SAME, 5},     // Earth: molten rock, cursed earth
+    {0,      0,    0,    9,    5,    SAME},  // Shadow: void magic, cursed earth
+};
+#undef SAME
+
+int Spell::calculateSynergyBonus(const CastHistory& history) const {
+    if (hook == SPELL_HOOK_MEDITATE) {
+        return Meditate::getSynergyBonus();
     }
     
+    const uint8_t* row = elementSynergy[element];
+    int bonus = 0;
+    for (int e = 0; e < ELEMENT_COUNT; e++) {
+        bonus += row[e] * history.countOf(e);
+    }
     return bonus;
 }
 
+//============================================================================
+// CAST HISTORY
+//============================================================================
+
+void CastHistory::record(ElementType element) {
+    if (size == SPELL_RECENT_CASTS) {
+        elementCounts[ring[head]]--;    // Oldest cast drops out
+    } else {
+        size++;
+    }
+    ring[head] = (uint8_t)element;
+    elementCounts[element]++;
+    head = (head + 1) % SPELL_RECENT_CASTS;
+}
+
+void CastHistory::clear() {
+    head = 0;
+    size = 0;
+    memset(elementCounts, 0, sizeof(elementCounts));
+}
+
+ElementType CastHistory::getElement(int age) const {
+    int slot = (head + SPELL_RECENT_CASTS - 1 - age) % SPELL_RECENT_CASTS;
+    return (ElementType)ring[slot];
+}
+
 //============================================================================
 // MEDITATE SPELL IMPLEMENTATION
 //============================================================================
 
-bool Meditate::cast(Player* caster, Enemy* target, const std::vector<Spell*>& otherSpells, CombatTextBox* textBox) {
+bool Meditate::cast(const Spell& spell, Player* caster, int* synergyOut) {
+    TRACE_SCOPE(trace, TRACE_SPELL_CAST, spell.getID());
     if (!caster) return false;
     
     // No mana cost for Meditate
     
     // DEBUG: Show current state
-    Serial.println("DEBUG Meditate::cast() - consecutiveUses BEFORE increment: " + String(consecutiveUses));
-    Serial.println("DEBUG Meditate::cast() - textBox pointer: " + String(textBox != nullptr ? "NOT NULL" : "NULL"));
+    LOG_DEBUG(SPELL, "Meditate::cast() - consecutiveUses BEFORE increment: %d", consecutiveUses);
     
     // Increment consecutive uses
     consecutiveUses++;
-    Serial.println("DEBUG Meditate::cast() - consecutiveUses AFTER increment: " + String(consecutiveUses));
+    LOG_DEBUG(SPELL, "Meditate::cast() - consecutiveUses AFTER increment: %d", consecutiveUses);
     
     // Calculate mana restoration with self-synergy
-    int baseManaRestore = basePower; // 5 mana
-    int synergyBonus = calculateSynergyBonus(otherSpells);
+    int baseManaRestore = spell.getBasePower(); // 5 mana
+    int synergyBonus = getSynergyBonus();
     int totalManaRestore = baseManaRestore + synergyBonus;
     
-    Serial.println("DEBUG Meditate::cast() - baseManaRestore: " + String(baseManaRestore));
-    Serial.println("DEBUG Meditate::cast() - synergyBonus: " + String(synergyBonus));
-    Serial.println("DEBUG Meditate::cast() - totalManaRestore: " + String(totalManaRestore));
+    LOG_DEBUG(SPELL, "Meditate::cast() - baseManaRestore: %d", baseManaRestore);
+    LOG_DEBUG(SPELL, "Meditate::cast() - synergyBonus: %d", synergyBonus);
+    LOG_DEBUG(SPELL, "Meditate::cast() - totalManaRestore: %d", totalManaRestore);
     
-    // Show synergy bonus in text box if present and there is a bonus
-    if (textBox && synergyBonus > 0) {
-        Serial.println("DEBUG Meditate::cast() - CALLING textBox->showSynergyBonus()");
-        textBox->showSynergyBonus(getName(), synergyBonus);
-    } else {
-        Serial.println("DEBUG Meditate::cast() - NOT calling showSynergyBonus - textBox: " + 
-                      String(textBox != nullptr ? "exists" : "null") + 
-                      ", synergyBonus: " + String(synergyBonus));
-    }
+    if (synergyOut) *synergyOut = synergyBonus;
     
     // Restore mana
     caster->restoreMana(totalManaRestore);
     
     // Show appropriate message based on consecutive uses
     if (consecutiveUses == 1) {
-        Serial.println("Meditate restores " + String(totalManaRestore) + " mana.");
+        LOG_INFO(SPELL, "Meditate restores %d mana.", totalManaRestore);
     } else if (consecutiveUses == 2) {
-        Serial.println("Deeper meditation restores " + String(totalManaRestore) + " mana.");
+        LOG_INFO(SPELL, "Deeper meditation restores %d mana.", totalManaRestore);
     } else {
-        Serial.println("Perfect focus restores " + String(totalManaRestore) + " mana!");
+        LOG_INFO(SPELL, "Perfect focus restores %d mana!", totalManaRestore);
     }
     
     if (synergyBonus > 0) {
-        Serial.println("Consecutive meditation bonus: +" + String(synergyBonus) + " mana!");
+        LOG_INFO(SPELL, "Consecutive meditation bonus: +%d mana!", synergyBonus);
     }
     
+    trace.setResult(synergyBonus);
     return true;
 }
 
-int Meditate::calculateSynergyBonus(const std::vector<Spell*>& recentSpells) const {
+int Meditate::getSynergyBonus() {
     // Self-synergy: Each consecutive use adds +5 mana, capping at +10 (total 15)
     // consecutiveUses: 1 = +0, 2 = +5, 3+ = +10
     
@@ -302,36 +353,29 @@ int Meditate::calculateSynergyBonus(const std::vector<Spell*>& recentSpells) con
 
 SpellLibrary::SpellLibrary() {
     knownSpells.clear();
-    equippedSpells.resize(MAX_EQUIPPED, nullptr);
-    recentCasts.clear();
+    for (int i = 0; i < MAX_EQUIPPED; i++) {
+        equippedSpells[i] = nullptr;
+    }
 }
 
 SpellLibrary::~SpellLibrary() {
-    // Clean up known spells
-    for (Spell* spell : knownSpells) {
-        delete spell;
-    }
-    knownSpells.clear();
-    
-    // Don't delete equipped spells - they're the same pointers as known spells
-    equippedSpells.clear();
-    recentCasts.clear();
+    // Nothing to free: the spells belong to the definition table
 }
 
-bool SpellLibrary::learnSpell(Spell* spell) {
+bool SpellLibrary::learnSpell(const Spell* spell) {
     if (!spell) return false;
     
     // Check if already known
-    for (Spell* known : knownSpells) {
+    for (const Spell* known : knownSpells) {
         if (known->getID() == spell->getID()) {
-            Serial.println("Spell already known: " + spell->getName());
+            LOG_INFO(SPELL, "Spell already known: %s", spell->getName().c_str());
             return false;
         }
     }
     
     // Learn the spell
     knownSpells.push_back(spell);
-    Serial.println("Learned spell: " + spell->getName());
+    LOG_INFO(SPELL, "Learned spell: %s", spell->getName().c_str());
     return true;
 }
 
@@ -345,8 +389,6 @@ bool SpellLibrary::forgetSpell(int spellID) {
                 }
             }
             
-            // Delete and remove from known spells
-            delete knownSpells[i];
             knownSpells.erase(knownSpells.begin() + i);
             return true;
         }
@@ -358,8 +400,8 @@ bool SpellLibrary::equipSpell(int spellID, int slot) {
     if (slot < 0 || slot >= MAX_EQUIPPED) return false;
     
     // Find the spell
-    Spell* spellToEquip = nullptr;
-    for (Spell* known : knownSpells) {
+    const Spell* spellToEquip = nullptr;
+    for (const Spell* known : knownSpells) {
         if (known->getID() == spellID) {
             spellToEquip = known;
             break;
@@ -370,7 +412,7 @@ bool SpellLibrary::equipSpell(int spellID, int slot) {
     
     // Equip the spell
     equippedSpells[slot] = spellToEquip;
-    Serial.println("Equipped " + spellToEquip->getName() + " to slot " + String(slot + 1));
+    LOG_INFO(SPELL, "Equipped %s to slot %d", spellToEquip->getName().c_str(), slot + 1);
     return true;
 }
 
@@ -378,39 +420,35 @@ bool SpellLibrary::unequipSpell(int slot) {
     if (slot < 0 || slot >= MAX_EQUIPPED) return false;
     
     equippedSpells[slot] = nullptr;
-    Serial.println("Unequipped spell from slot " + String(slot + 1));
+    LOG_INFO(SPELL, "Unequipped spell from slot %d", slot + 1);
     return true;
 }
 
-Spell* SpellLibrary::getEquippedSpell(int slot) const {
+const Spell* SpellLibrary::getEquippedSpell(int slot) const {
     if (slot < 0 || slot >= MAX_EQUIPPED) return nullptr;
     return equippedSpells[slot];
 }
 
-std::vector<Spell*> SpellLibrary::getEquippedSpells() const {
-    std::vector<Spell*> equipped;
-    for (Spell* spell : equippedSpells) {
-        equipped.push_back(spell); // Include nullptrs to maintain slot positions
-    }
-    return equipped;
+std::vector<const Spell*> SpellLibrary::getEquippedSpells() const {
+    // Include nullptrs to maintain slot positions
+    return std::vector<const Spell*>(equippedSpells, equippedSpells + MAX_EQUIPPED);
 }
 
-std::vector<Spell*> SpellLibrary::getKnownSpells() const {
+const std::vector<const Spell*>& SpellLibrary::getKnownSpells() const {
     return knownSpells;
 }
 
-std::vector<Spell*> SpellLibrary::getRecentCasts() const {
+const CastHistory& SpellLibrary::getRecentCasts() const {
     return recentCasts;
 }
 
-bool SpellLibrary::castSpell(int slot, Player* caster, Enemy* target, CombatTextBox* textBox) {
+bool SpellLibrary::castSpell(int slot, Player* caster, Enemy* target, int* synergyOut) {
     if (slot < 0 || slot >= MAX_EQUIPPED) return false;
     
-    Spell* spell = equippedSpells[slot];
+    const Spell* spell = equippedSpells[slot];
     if (!spell) return false;
     
-    // Cast the spell - Pass text box to spell casting (synergy display handled in Spell::cast())
-    if (spell->cast(caster, target, recentCasts, textBox)) {
+    if (spell->cast(caster, target, &recentCasts, synergyOut)) {
         recordCast(spell);
         return true;
     }
@@ -418,16 +456,11 @@ bool SpellLibrary::castSpell(int slot, Player* caster, Enemy* target, CombatText
     return false;
 }
 
-void SpellLibrary::recordCast(Spell* spell) {
+void SpellLibrary::recordCast(const Spell* spell) {
     if (!spell) return;
     
-    // Add to recent casts
-    recentCasts.push_back(spell);
-    
-    // Keep only the most recent casts
-    while (recentCasts.size() > MAX_RECENT) {
-        recentCasts.erase(recentCasts.begin());
-    }
+    // Overwrites the oldest once full
+    recentCasts.record(spell->getElement());
 }
 
 void SpellLibrary::clearRecentCasts() {
@@ -440,14 +473,14 @@ int SpellLibrary::getKnownSpellCount() const {
 
 int SpellLibrary::getEquippedSpellCount() const {
     int count = 0;
-    for (Spell* spell : equippedSpells) {
+    for (const Spell* spell : equippedSpells) {
         if (spell) count++;
     }
     return count;
 }
 
 bool SpellLibrary::hasSpell(int spellID) const {
-    for (Spell* spell : knownSpells) {
+    for (const Spell* spell : knownSpells) {
         if (spell->getID() == spellID) return true;
     }
     return false;
@@ -462,185 +495,85 @@ bool SpellLibrary::hasEquipSlot() const {
 }
 
 void SpellLibrary::displayKnownSpells() const {
-    Serial.println("=== SPELL GRIMOIRE ===");
-    Serial.println("Known spells: " + String(knownSpells.size()));
+    LOG_INFO(SPELL, "=== SPELL GRIMOIRE ===");
+    LOG_INFO(SPELL, "Known spells: %d", (int)knownSpells.size());
     
     for (int i = 0; i < knownSpells.size(); i++) {
-        Spell* spell = knownSpells[i];
-        Serial.println(String(i + 1) + ". " + spell->getName() + " (" + 
-                      spell->getElementName() + ") - Power: " + String(spell->getBasePower()));
-        Serial.println("   " + spell->getDescription());
+        const Spell* spell = knownSpells[i];
+        LOG_INFO(SPELL, "%d. %s (%s) - Power: %d",
+                 i + 1, spell->getName().c_str(), spell->getElementName(), spell->getBasePower());
+        LOG_INFO(SPELL, "   %s", spell->getDescription().c_str());
     }
 }
 
 void SpellLibrary::displayEquippedSpells() const {
-    Serial.println("=== EQUIPPED SPELLS ===");
+    LOG_INFO(SPELL, "=== EQUIPPED SPELLS ===");
     
     for (int i = 0; i < MAX_EQUIPPED; i++) {
-        Serial.print("Slot " + String(i + 1) + ": ");
         if (equippedSpells[i]) {
-            Serial.println(equippedSpells[i]->getName() + " (" + 
-                          equippedSpells[i]->getElementName() + ")");
+            LOG_INFO(SPELL, "Slot %d: %s (%s)", i + 1, equippedSpells[i]->getName().c_str(),
+                     equippedSpells[i]->getElementName());
         } else {
-            Serial.println("Empty");
+            LOG_INFO(SPELL, "Slot %d: Empty", i + 1);
         }
     }
 }
 
 void SpellLibrary::displaySpellDetails(int spellID) const {
-    for (Spell* spell : knownSpells) {
+    for (const Spell* spell : knownSpells) {
         if (spell->getID() == spellID) {
-            Serial.println("=== " + spell->getName() + " ===");
-            Serial.println("Element: " + spell->getElementName());
-            Serial.println("Power: " + String(spell->getBasePower()));
-            Serial.println("Mana Cost: " + String(spell->getManaCost()));
-            Serial.println("Effect: " + spell->getEffectName());
-            Serial.println("Description: " + spell->getDescription());
+            LOG_INFO(SPELL, "=== %s ===", spell->getName().c_str());
+            LOG_INFO(SPELL, "Element: %s", spell->getElementName());
+            LOG_INFO(SPELL, "Power: %d", spell->getBasePower());
+            LOG_INFO(SPELL, "Mana Cost: %d", spell->getManaCost());
+            LOG_INFO(SPELL, "Effect: %s", spell->getEffectName());
+            LOG_INFO(SPELL, "Description: %s", spell->getDescription().c_str());
             return;
         }
     }
-    Serial.println("Spell not found in grimoire.");
+    LOG_INFO(SPELL, "Spell not found in grimoire.");
 }
 
 //============================================================================
 // SPELL FACTORY IMPLEMENTATION
 //============================================================================
 
-Spell* SpellFactory::createSpell(int spellID) {
-    switch (spellID) {
-        // Fire spells
-        case 1: return new Fireball();
-        case 2: return new Ignite();
-        case 3: return new Immolation();
-        
-        // Ice spells
-        case 11: return new FrostBolt();
-        case 12: return new IceBarrier();
-        case 13: return new Blizzard();
-        
-        // Lightning spells
-        case 21: return new LightningBolt();
-        case 22: return new ChainLightning();
-        case 23: return new Shock();
-        
-        // Arcane spells
-        case 31: return new MagicMissile();
-        case 32: return new ArcaneShield();
-        case 33: return new PowerSurge();
-        case 34: return new Meditate();  // Meditate spell
-        
-        // Earth spells
-        case 41: return new StoneSpear();
-        case 42: return new EarthWall();
-        case 43: return new Earthquake();
-        
-        // Shadow spells
-        case 51: return new ShadowBolt();
-        case 52: return new Drain();
-        case 53: return new DarkRitual();
-        
-        default:
-            Serial.println("Unknown spell ID: " + String(spellID));
-            return nullptr;
+const Spell* SpellFactory::getSpell(int spellID) {
+    for (int i = 0; i < SPELL_COUNT; i++) {
+        if (spellTable[i].getID() == spellID) return &spellTable[i];
     }
+    LOG_INFO(SPELL, "Unknown spell ID: %d", spellID);
+    return nullptr;
 }
 
-Spell* SpellFactory::createRandomSpell(int minTier, int maxTier) {
-    std::vector<int> availableSpells;
-    
-    if (minTier <= 1 && maxTier >= 1) {
-        std::vector<int> tier1 = getTier1Spells();
-        availableSpells.insert(availableSpells.end(), tier1.begin(), tier1.end());
+const Spell* SpellFactory::getRandomSpell(int minTier, int maxTier) {
+    int candidates = 0;
+    for (int i = 0; i < SPELL_COUNT; i++) {
+        int tier = spellTable[i].getTier();
+        if (tier >= minTier && tier <= maxTier) candidates++;
     }
+    if (candidates == 0) return nullptr;
     
-    if (minTier <= 2 && maxTier >= 2) {
-        std::vector<int> tier2 = getTier2Spells();
-        availableSpells.insert(availableSpells.end(), tier2.begin(), tier2.end());
-    }
-    
-    if (minTier <= 3 && maxTier >= 3) {
-        std::vector<int> tier3 = getTier3Spells();
-        availableSpells.insert(availableSpells.end(), tier3.begin(), tier3.end());
-    }
-    
-    if (availableSpells.empty()) return nullptr;
-    
-    int randomIndex = random(0, availableSpells.size());
-    return createSpell(availableSpells[randomIndex]);
-}
-
-std::vector<Spell*> SpellFactory::createStarterSpells() {
-    std::vector<Spell*> starter;
-    starter.push_back(new MagicMissile()); // Reliable damage spell
-    starter.push_back(new Meditate());     // Mana restoration spell
-    return starter;
-}
-
-std::vector<Spell*> SpellFactory::createSpellsOfElement(ElementType element) {
-    std::vector<Spell*> elementSpells;
-    
-    switch (element) {
-        case ELEMENT_FIRE:
-            elementSpells.push_back(createSpell(1));
-            elementSpells.push_back(createSpell(2));
-            elementSpells.push_back(createSpell(3));
-            break;
-        case ELEMENT_ICE:
-            elementSpells.push_back(createSpell(11));
-            elementSpells.push_back(createSpell(12));
-            elementSpells.push_back(createSpell(13));
-            break;
-        case ELEMENT_LIGHTNING:
-            elementSpells.push_back(createSpell(21));
-            elementSpells.push_back(createSpell(22));
-            elementSpells.push_back(createSpell(23));
-            break;
-        case ELEMENT_ARCANE:
-            elementSpells.push_back(createSpell(31));
-            elementSpells.push_back(createSpell(32));
-            elementSpells.push_back(createSpell(33));
-            elementSpells.push_back(createSpell(34)); // Include Meditate
-            break;
-        case ELEMENT_EARTH:
-            elementSpells.push_back(createSpell(41));
-            elementSpells.push_back(createSpell(42));
-            elementSpells.push_back(createSpell(43));
-            break;
-        case ELEMENT_SHADOW:
-            elementSpells.push_back(createSpell(51));
-            elementSpells.push_back(createSpell(52));
-            elementSpells.push_back(createSpell(53));
-            break;
+    // Candidates are counted tier by tier, each tier in table order
+    int pick = Rng::roll(RNG_LOOT, 0, candidates);
+    for (int tier = max(minTier, 1); tier <= min(maxTier, 3); tier++) {
+        for (int i = 0; i < SPELL_COUNT; i++) {
+            if (spellTable[i].getTier() == tier && pick-- == 0) return &spellTable[i];
+        }
     }
-    
-    return elementSpells;
+    return nullptr;
 }
 
-std::vector<int> SpellFactory::getTier1Spells() {
-    return {1, 11, 21, 31, 34, 41, 51}; // Added 34 (Meditate) to tier 1
+const Spell* SpellFactory::getStarterSpell(int index) {
+    if (index < 0 || index >= STARTER_SPELL_COUNT) return nullptr;
+    return getSpell(starterSpellIDs[index]);
 }
 
-std::vector<int> SpellFactory::getTier2Spells() {
-    return {2, 12, 22, 32, 42, 52}; // Intermediate spells
+int SpellFactory::getSpellCount() {
+    return SPELL_COUNT;
 }
 
-std::vector<int> SpellFactory::getTier3Spells() {
-    return {3, 13, 23, 33, 43, 53}; // Advanced spells
+const Spell* SpellFactory::getSpellAt(int index) {
+    if (index < 0 || index >= SPELL_COUNT) return nullptr;
+    return &spellTable[index];
 }
-
-std::vector<Spell*> SpellFactory::createAllSpells() {
-    std::vector<Spell*> allSpells;
-    
-    // Create one of each spell
-    for (int id : getTier1Spells()) {
-        allSpells.push_back(createSpell(id));
-    }
-    for (int id : getTier2Spells()) {
-        allSpells.push_back(createSpell(id));
-    }
-    for (int id : getTier3Spells()) {
-        allSpells.push_back(createSpell(id));
-    }
-    
-    return allSpells;
-}
\ No newline at end of file
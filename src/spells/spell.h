@@ -5,70 +5,130 @@
 #include <vector>
 #include <TFT_eSPI.h>  // For color constants
 #include "spell_types.h"
+#include "../utils/FixedString.h"
 
 // Forward declarations
 class Player;
 class Enemy;
-class CombatTextBox;  // NEW: Forward declaration for text box
 
 struct SpellSynergy {
     ElementType element1;
     ElementType element2;
     int bonusDamage;
-    String description;
+    FlashString description;
 };
 
-class Spell {
+#define SPELL_RECENT_CASTS 3    // Casts remembered for synergies
+
+// The elements of the last few casts, for synergy bonuses. A fixed ring plus
+// a running count per element, so recording a cast and scoring one are both
+// a few loads and stores with no allocation.
+class CastHistory {
 private:
-    int spellID;
-    String name;
-    ElementType element;
-    SpellEffect primaryEffect;
+    uint8_t ring[SPELL_RECENT_CASTS];      // ElementType, oldest at head once full
+    uint8_t head;                          // Next slot to overwrite
+    uint8_t size;
+    uint8_t elementCounts[ELEMENT_COUNT];
     
-    // Mana cost
-    int manaCost;
+public:
+    CastHistory() { clear(); }
     
-    // Additional effects
-    bool hasSecondaryEffect;
-    SpellEffect secondaryEffect;
-    int secondaryPower;
-    int duration;
+    void record(ElementType element);
+    void clear();
     
-protected:
-    String description;  // Protected so subclasses can access it
-    int basePower;      // Made protected so Meditate can access it
+    int getSize() const { return size; }
+    int countOf(int element) const { return elementCounts[element]; }
+    ElementType getElement(int age) const;  // 0 = most recent
+};
+
+// Behaviour beyond the generic effects, picked by the definition table
+enum SpellHook {
+    SPELL_HOOK_NONE,
+    SPELL_HOOK_MEDITATE     // Restores mana, stronger with consecutive casts
+};
+
+// One spell's immutable definition. Every spell lives once in the constexpr
+// table in spell.cpp (flash on the device); scrolls, the grimoire and
+// equipped slots all point into it, so nothing is allocated, copied or
+// deleted per spell.
+class Spell {
+private:
+    FlashString name;
+    FlashString description;
+    uint8_t spellID;
+    uint8_t tier;           // 1-3, for scroll drops
+    uint8_t element;        // ElementType
+    uint8_t primaryEffect;  // SpellEffect
+    uint8_t basePower;
+    uint8_t manaCost;
     
-public:
-    // Constructor
-    Spell(int id, String spellName, ElementType elem, SpellEffect effect, int power, int cost = 0);
+    // Additional effects
+    bool hasSecondaryEffect;
+    uint8_t secondaryEffect;  // SpellEffect
+    uint8_t secondaryPower;
+    uint8_t duration;
+    uint8_t debuffStat;       // StatusStat a secondary debuff lowers
+    uint8_t hook;             // SpellHook
+    
+public:
+    constexpr Spell(int id, int spellTier, const char* spellName, ElementType elem, SpellEffect effect, int power,
+                    int cost, const char* spellDescription, SpellHook spellHook = SPELL_HOOK_NONE)
+        : name(spellName), description(spellDescription), spellID(id), tier(spellTier), element(elem),
+          primaryEffect(effect), basePower(power), manaCost(cost), hasSecondaryEffect(false),
+          secondaryEffect(EFFECT_DAMAGE), secondaryPower(0), duration(0), debuffStat(STAT_ALL), hook(spellHook) {}
+    
+    // With a secondary effect
+    constexpr Spell(int id, int spellTier, const char* spellName, ElementType elem, SpellEffect effect, int power,
+                    int cost, const char* spellDescription, SpellEffect secondary, int secondaryPow, int dur,
+                    StatusStat stat = STAT_ALL)
+        : name(spellName), description(spellDescription), spellID(id), tier(spellTier), element(elem),
+          primaryEffect(effect), basePower(power), manaCost(cost), hasSecondaryEffect(true),
+          secondaryEffect(secondary), secondaryPower(secondaryPow), duration(dur), debuffStat(stat),
+          hook(SPELL_HOOK_NONE) {}
     
     // Basic properties
     int getID() const { return spellID; }
-    String getName() const { return name; }
-    String getDescription() const { return description; }
-    ElementType getElement() const { return element; }
-    SpellEffect getPrimaryEffect() const { return primaryEffect; }
+    int getTier() const { return tier; }
+    FlashString getName() const { return name; }
+    FlashString getDescription() const { return description; }
+    ElementType getElement() const { return (ElementType)element; }
+    SpellEffect getPrimaryEffect() const { return (SpellEffect)primaryEffect; }
     int getBasePower() const { return basePower; }
     int getManaCost() const { return manaCost; }
+    SpellHook getHook() const { return (SpellHook)hook; }
     
     // Secondary effects
-    void addSecondaryEffect(SpellEffect effect, int power, int dur = 0);
     bool hasSecondary() const { return hasSecondaryEffect; }
-    SpellEffect getSecondaryEffect() const { return secondaryEffect; }
+    SpellEffect getSecondaryEffect() const { return (SpellEffect)secondaryEffect; }
     int getSecondaryPower() const { return secondaryPower; }
     int getDuration() const { return duration; }
+    StatusStat getDebuffStat() const { return (StatusStat)debuffStat; }
     
-    // Usage - UPDATED: Now takes text box parameter for synergy display
-    virtual bool cast(Player* caster, Enemy* target, const std::vector<Spell*>& otherSpells = {}, CombatTextBox* textBox = nullptr);
-    virtual String getElementName() const;
-    virtual String getEffectName() const;
-    virtual uint16_t getElementColor() const;
+    // Usage; synergyOut gets the synergy bonus applied (0 if none or not cast)
+    bool cast(Player* caster, Enemy* target, const CastHistory* history = nullptr,
+              int* synergyOut = nullptr) const;
+    const char* getElementName() const;
+    const char* getEffectName() const;
+    static const char* getStatName(StatusStat stat);
+    uint16_t getElementColor() const;
     
-    // Synergy calculation - Made virtual so it can be overridden
-    virtual int calculateSynergyBonus(const std::vector<Spell*>& recentSpells) const;
+    // Synergy calculation (hooks replace the element rules)
+    int calculateSynergyBonus(const CastHistory& history) const;
+};
+
+// Meditate's self-synergy (SPELL_HOOK_MEDITATE). One count per thread: the
+// game has a single combat, the host simulators run one per thread.
+class Meditate {
+private:
+    static thread_local int consecutiveUses;
     
-    // Virtual destructor
-    virtual ~Spell() {}
+public:
+    static bool cast(const Spell& spell, Player* caster, int* synergyOut);
+    static int getSynergyBonus();
+    
+    // Reset consecutive uses (called when other spells are cast)
+    static void resetConsecutiveUses() { consecutiveUses = 0; }
+    static int getConsecutiveUses() { return consecutiveUses; }
 };
 
 //============================================================================
@@ -77,31 +137,31 @@ public:
 
 class SpellLibrary {
 private:
-    std::vector<Spell*> knownSpells;
-    std::vector<Spell*> equippedSpells;  // Max 4 equipped
-    std::vector<Spell*> recentCasts;     // For synergy tracking
-    
     static const int MAX_EQUIPPED = 4;
-    static const int MAX_RECENT = 3;     // Track last 3 casts for synergies
+    
+    // Definitions live in the spell table; the library only points at them
+    std::vector<const Spell*> knownSpells;
+    const Spell* equippedSpells[MAX_EQUIPPED];
+    CastHistory recentCasts;     // For synergy tracking
     
 public:
     SpellLibrary();
     
     // Spell management
-    bool learnSpell(Spell* spell);
+    bool learnSpell(const Spell* spell);
     bool forgetSpell(int spellID);
     bool equipSpell(int spellID, int slot);
     bool unequipSpell(int slot);
     
     // Spell access
-    Spell* getEquippedSpell(int slot) const;
-    std::vector<Spell*> getEquippedSpells() const;
-    std::vector<Spell*> getKnownSpells() const;
-    std::vector<Spell*> getRecentCasts() const;
-    
-    // Combat integration - UPDATED: Now takes text box parameter
-    bool castSpell(int slot, Player* caster, Enemy* target, CombatTextBox* textBox = nullptr);
-    void recordCast(Spell* spell);
+    const Spell* getEquippedSpell(int slot) const;
+    std::vector<const Spell*> getEquippedSpells() const;
+    const std::vector<const Spell*>& getKnownSpells() const;
+    const CastHistory& getRecentCasts() const;
+    
+    // Combat integration; synergyOut as for Spell::cast
+    bool castSpell(int slot, Player* caster, Enemy* target, int* synergyOut = nullptr);
+    void recordCast(const Spell* spell);
     void clearRecentCasts(); // Called after combat
     
     // Information
@@ -120,191 +180,22 @@ public:
 };
 
 //============================================================================
-// SPECIFIC SPELL IMPLEMENTATIONS
+// SPELL FACTORY - Looks spells up in the definition table
 //============================================================================
 
-// ARCANE SPELLS (including Meditate)
-class MagicMissile : public Spell {
-public:
-    MagicMissile() : Spell(31, "Magic Missile", ELEMENT_ARCANE, EFFECT_DAMAGE, 18, 4) {
-        description = "Reliable arcane projectiles that never miss.";
-        // Always hits, good starter spell
-    }
-};
-
-// Meditate spell with self-synergy
-class Meditate : public Spell {
-private:
-    static int consecutiveUses; // Track consecutive uses across all instances
-    
-public:
-    Meditate() : Spell(34, "Meditate", ELEMENT_ARCANE, EFFECT_HEAL, 5, 0) {
-        description = "Focus your mind to restore mana. Grows stronger with consecutive use.";
-    }
-    
-    // Override cast method for special self-synergy logic - UPDATED: Now takes text box
-    bool cast(Player* caster, Enemy* target, const std::vector<Spell*>& otherSpells = {}, CombatTextBox* textBox = nullptr) override;
-    
-    // Custom synergy calculation for self-synergy - Now properly overrides
-    int calculateSynergyBonus(const std::vector<Spell*>& recentSpells) const override;
-    
-    // Reset consecutive uses (called when other spells are cast)
-    static void resetConsecutiveUses() { consecutiveUses = 0; }
-    static int getConsecutiveUses() { return consecutiveUses; }
-};
-
-class ArcaneShield : public Spell {
-public:
-    ArcaneShield() : Spell(32, "Arcane Shield", ELEMENT_ARCANE, EFFECT_SHIELD, 20, 8) {
-        description = "A shimmering barrier of pure magical energy.";
-        addSecondaryEffect(EFFECT_BUFF, 5, 3); // +5 to all resistances
-    }
-};
-
-class PowerSurge : public Spell {
-public:
-    PowerSurge() : Spell(33, "Power Surge", ELEMENT_ARCANE, EFFECT_BUFF, 12, 10) {
-        description = "Channels raw magic to enhance all abilities.";
-        addSecondaryEffect(EFFECT_BUFF, 8, 4); // +8 to all stats for 4 turns
-    }
-};
-
-// FIRE SPELLS
-class Fireball : public Spell {
-public:
-    Fireball() : Spell(1, "Fireball", ELEMENT_FIRE, EFFECT_DAMAGE, 25, 6) {
-        description = "A blazing orb of fire that burns enemies.";
-    }
-};
-
-class Ignite : public Spell {
-public:
-    Ignite() : Spell(2, "Ignite", ELEMENT_FIRE, EFFECT_DAMAGE_OVER_TIME, 8, 5) {
-        description = "Sets the enemy ablaze, dealing damage over time.";
-        addSecondaryEffect(EFFECT_DAMAGE_OVER_TIME, 6, 3); // 6 damage for 3 turns
-    }
-};
-
-class Immolation : public Spell {
-public:
-    Immolation() : Spell(3, "Immolation", ELEMENT_FIRE, EFFECT_DAMAGE, 35, 12) {
-        description = "A devastating fire spell that consumes everything.";
-    }
-};
-
-// ICE SPELLS  
-class FrostBolt : public Spell {
-public:
-    FrostBolt() : Spell(11, "Frost Bolt", ELEMENT_ICE, EFFECT_DAMAGE, 20, 5) {
-        description = "A shard of ice that pierces and slows enemies.";
-        addSecondaryEffect(EFFECT_DEBUFF, 3, 2); // -3 speed for 2 turns
-    }
-};
-
-class IceBarrier : public Spell {
-public:
-    IceBarrier() : Spell(12, "Ice Barrier", ELEMENT_ICE, EFFECT_SHIELD, 15, 7) {
-        description = "Creates a protective barrier of magical ice.";
-    }
-};
-
-class Blizzard : public Spell {
-public:
-    Blizzard() : Spell(13, "Blizzard", ELEMENT_ICE, EFFECT_DAMAGE, 30, 11) {
-        description = "A freezing storm that devastates the battlefield.";
-        addSecondaryEffect(EFFECT_DEBUFF, 5, 2); // -5 attack for 2 turns
-    }
-};
-
-// LIGHTNING SPELLS
-class LightningBolt : public Spell {
-public:
-    LightningBolt() : Spell(21, "Lightning Bolt", ELEMENT_LIGHTNING, EFFECT_DAMAGE, 28, 6) {
-        description = "A crackling bolt of pure electrical energy.";
-    }
-};
-
-class ChainLightning : public Spell {
-public:
-    ChainLightning() : Spell(22, "Chain Lightning", ELEMENT_LIGHTNING, EFFECT_DAMAGE, 22, 8) {
-        description = "Lightning that jumps between targets with increasing power.";
-        // Bonus damage based on recent lightning spells
-    }
-};
-
-class Shock : public Spell {
-public:
-    Shock() : Spell(23, "Shock", ELEMENT_LIGHTNING, EFFECT_DEBUFF, 10, 9) {
-        description = "Stuns the enemy, reducing their accuracy and speed.";
-        addSecondaryEffect(EFFECT_DEBUFF, 8, 3); // Major debuff for 3 turns
-    }
-};
-
-// EARTH SPELLS
-class StoneSpear : public Spell {
-public:
-    StoneSpear() : Spell(41, "Stone Spear", ELEMENT_EARTH, EFFECT_DAMAGE, 24, 5) {
-        description = "Conjures a sharp spear of hardened earth.";
-    }
-};
-
-class EarthWall : public Spell {
-public:
-    EarthWall() : Spell(42, "Earth Wall", ELEMENT_EARTH, EFFECT_SHIELD, 25, 9) {
-        description = "Raises a protective wall of solid stone.";
-        addSecondaryEffect(EFFECT_HEAL, 10, 0); // Also heals 10 HP
-    }
-};
-
-class Earthquake : public Spell {
-public:
-    Earthquake() : Spell(43, "Earthquake", ELEMENT_EARTH, EFFECT_DAMAGE, 32, 13) {
-        description = "Shakes the very foundations of the battlefield.";
-        addSecondaryEffect(EFFECT_DEBUFF, 6, 3); // -6 defense for 3 turns
-    }
-};
-
-// SHADOW SPELLS
-class ShadowBolt : public Spell {
-public:
-    ShadowBolt() : Spell(51, "Shadow Bolt", ELEMENT_SHADOW, EFFECT_DAMAGE, 22, 6) {
-        description = "A bolt of pure darkness that drains life force.";
-        addSecondaryEffect(EFFECT_HEAL, 8, 0); // Heals caster for 8 HP
-    }
-};
-
-class Drain : public Spell {
-public:
-    Drain() : Spell(52, "Drain", ELEMENT_SHADOW, EFFECT_DAMAGE, 15, 7) {
-        description = "Siphons health and energy from the enemy.";
-        addSecondaryEffect(EFFECT_HEAL, 15, 0); // Heals equal to damage
-    }
-};
-
-class DarkRitual : public Spell {
-public:
-    DarkRitual() : Spell(53, "Dark Ritual", ELEMENT_SHADOW, EFFECT_BUFF, 5, 15) {
-        description = "A forbidden ritual that grants immense power.";
-        addSecondaryEffect(EFFECT_BUFF, 15, 5); // +15 damage for 5 turns, but costs HP
-    }
-};
-
-//============================================================================
-// SPELL FACTORY - Creates spells by ID
-//============================================================================
+#define STARTER_SPELL_COUNT 2   // Magic Missile + Meditate
 
 class SpellFactory {
 public:
-    static Spell* createSpell(int spellID);
-    static Spell* createRandomSpell(int minTier = 1, int maxTier = 3);
-    static std::vector<Spell*> createStarterSpells(); // Returns Magic Missile + Meditate
-    static std::vector<Spell*> createSpellsOfElement(ElementType element);
-    static std::vector<Spell*> createAllSpells();
+    // nullptr for an unknown ID
+    static const Spell* getSpell(int spellID);
+    // Uniform over the spells of the given tiers, in table order
+    static const Spell* getRandomSpell(int minTier = 1, int maxTier = 3);
+    static const Spell* getStarterSpell(int index);
     
-    // Spell tiers for progression
-    static std::vector<int> getTier1Spells(); // Basic spells
-    static std::vector<int> getTier2Spells(); // Intermediate spells  
-    static std::vector<int> getTier3Spells(); // Advanced spells
+    // The whole table, in ID order
+    static int getSpellCount();
+    static const Spell* getSpellAt(int index);
 };
 
 #endif // SPELL_H
\ No newline at end of file
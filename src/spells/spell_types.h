@@ -12,6 +12,7 @@ enum ElementType {
     ELEMENT_EARTH,
     ELEMENT_SHADOW
 };
+#define ELEMENT_COUNT 6
 
 enum SpellEffect {
     EFFECT_DAMAGE,           // Direct damage
@@ -21,5 +22,15 @@ enum SpellEffect {
     EFFECT_BUFF,             // Stat boosts
     EFFECT_DEBUFF            // Enemy stat reduction
 };
+#define SPELL_EFFECT_COUNT 6
+
+// The stat a debuff lowers (buffs and the player's debuffs apply to all)
+enum StatusStat {
+    STAT_ALL,
+    STAT_ATTACK,
+    STAT_DEFENSE,
+    STAT_SPEED
+};
+#define STATUS_STAT_COUNT 4
 
 #endif // SPELL_TYPES_H
\ No newline at end of file
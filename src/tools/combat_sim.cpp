@@ -0,0 +1,411 @@
+// Monte Carlo combat simulator (native env only): runs the real
+// CombatManager headless, many fights per (loadout, policy, floor) cell, and
+// reports win rate, turns to kill and the mana curve for each enemy type.
+//
+//   pio run -e combat_sim
+//   .pio/build/combat_sim/program --loadout 31,34 --loadout 1,11,31,34
+//       --policy greedy --policy careful --fights 200000 --csv combat.csv
+//
+// (one command line)
+//
+// Fights are split into fixed chunks, each seeded from (seed, cell, chunk),
+// so the numbers are the same for any --threads. Enemies are rolled with the
+// floor's own weights (Floor::rollEnemyForFloor) unless --enemy forces one.
+
+#include <Arduino.h>
+#include "../combat/combat_manager.h"
+#include "../dungeon/Floor.h"
+#include "../spells/spell.h"
+#include "../utils/constants.h"
+#include "../utils/Rng.h"
+#include "sim/CombatPolicy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define ENEMY_TYPES      6      // IDs 1-6, see Enemy::createEnemyByID
+#define FIGHTS_PER_CHUNK 4096
+#define MANA_CURVE_TURNS 20     // Mana tracked at the end of turns 1-20
+#define DEFAULT_MAX_TURNS 100   // Fights still going after this are timeouts
+
+struct Options {
+    std::vector<std::vector<int>> loadouts;
+    std::vector<std::string> policies;
+    std::vector<int> floors;
+    int enemy = 0;              // 0: roll per floor
+    long fightsPerCell = 100000;
+    int threads = 0;            // 0: hardware concurrency
+    unsigned long seed = 1;
+    int maxTurns = DEFAULT_MAX_TURNS;
+    const char* csvPath = nullptr;
+};
+
+struct Cell {
+    int loadout;
+    int policy;
+    int floor;
+};
+
+// Totals for one (cell, enemy type); plain sums so merge order doesn't matter
+struct Stats {
+    uint64_t fights = 0;
+    uint64_t wins = 0;
+    uint64_t losses = 0;
+    uint64_t timeouts = 0;
+    uint64_t winTurns = 0;
+    uint64_t hpLeft = 0;                    // Summed over wins
+    std::vector<uint64_t> turnsToKill;      // Wins by turn count
+    uint64_t manaSum[MANA_CURVE_TURNS] = {};
+    uint64_t manaCount[MANA_CURVE_TURNS] = {};
+
+    void merge(const Stats& other) {
+        fights += other.fights;
+        wins += other.wins;
+        losses += other.losses;
+        timeouts += other.timeouts;
+        winTurns += other.winTurns;
+        hpLeft += other.hpLeft;
+        if (turnsToKill.size() < other.turnsToKill.size()) turnsToKill.resize(other.turnsToKill.size());
+        for (size_t t = 0; t < other.turnsToKill.size(); t++) turnsToKill[t] += other.turnsToKill[t];
+        for (int t = 0; t < MANA_CURVE_TURNS; t++) {
+            manaSum[t] += other.manaSum[t];
+            manaCount[t] += other.manaCount[t];
+        }
+    }
+
+    // Smallest turn count with at least `fraction` of the wins
+    int winTurnPercentile(double fraction) const {
+        uint64_t target = (uint64_t)(wins * fraction + 0.5);
+        uint64_t seen = 0;
+        for (size_t t = 0; t < turnsToKill.size(); t++) {
+            seen += turnsToKill[t];
+            if (seen >= target && seen > 0) return (int)t;
+        }
+        return 0;
+    }
+};
+
+static int statsIndex(int cell, int enemyID) {
+    return cell * ENEMY_TYPES + (enemyID - 1);
+}
+
+//============================================================================
+// SIMULATION
+//============================================================================
+
+// One player per loadout and one enemy per type, reused for every fight
+class Arena {
+private:
+    Player player;
+    Enemy enemies[ENEMY_TYPES];
+    Enemy templates[ENEMY_TYPES];
+    CombatManager combat;
+
+public:
+    Arena(const std::vector<int>& loadout)
+        : player("Sim", WIZARD_START_HP, WIZARD_START_ATK, WIZARD_START_DEF, WIZARD_START_SPD, WIZARD_START_MANA) {
+        SpellLibrary* library = player.getSpellLibrary();
+        for (size_t slot = 0; slot < loadout.size(); slot++) {
+            library->learnSpell(SpellFactory::getSpell(loadout[slot]));
+            library->equipSpell(loadout[slot], (int)slot);
+        }
+        for (int i = 0; i < ENEMY_TYPES; i++) {
+            templates[i] = Enemy::createEnemyByID(i + 1);
+            enemies[i] = templates[i];
+        }
+    }
+
+    void fight(int enemyID, CombatPolicy* policy, int maxTurns, Stats& stats) {
+        player.setStats(WIZARD_START_HP, WIZARD_START_ATK, WIZARD_START_DEF, WIZARD_START_SPD);
+        player.resetMana();
+        player.clearSpellEffects();
+        Meditate::resetConsecutiveUses();
+
+        const Enemy& source = templates[enemyID - 1];
+        Enemy* enemy = &enemies[enemyID - 1];
+        enemy->setStats(source.getMaxHP(), source.getAttack(), source.getDefense(), source.getSpeed());
+        enemy->clearSpellEffects();
+
+        policy->reset();
+        combat.startCombat(&player, enemy);
+
+        CombatResult result = RESULT_ONGOING;
+        int turn = 0;
+        while (result == RESULT_ONGOING && turn < maxTurns) {
+            turn++;
+            result = combat.processTurn(policy->chooseAction(&player, enemy, turn)).outcome;
+            if (turn <= MANA_CURVE_TURNS) {
+                stats.manaSum[turn - 1] += player.getCurrentMana();
+                stats.manaCount[turn - 1]++;
+            }
+        }
+        combat.endCombat();
+
+        stats.fights++;
+        if (result == RESULT_VICTORY) {
+            stats.wins++;
+            stats.winTurns += turn;
+            stats.hpLeft += player.getCurrentHP();
+            if ((int)stats.turnsToKill.size() <= turn) stats.turnsToKill.resize(turn + 1);
+            stats.turnsToKill[turn]++;
+        } else if (result == RESULT_DEFEAT) {
+            stats.losses++;
+        } else {
+            stats.timeouts++;
+        }
+    }
+};
+
+struct WorkUnit {
+    int cell;
+    long firstFight;
+    long count;
+};
+
+static void runWorker(const Options& options, const std::vector<Cell>& cells,
+                      const std::vector<WorkUnit>& units, std::atomic<size_t>& nextUnit,
+                      std::vector<Stats>& totals, std::mutex& totalsLock) {
+    std::vector<Arena*> arenas(options.loadouts.size(), nullptr);
+    std::vector<CombatPolicy*> policies;
+    for (const std::string& name : options.policies) policies.push_back(CombatPolicy::create(name.c_str()));
+    std::vector<Stats> local(totals.size());
+
+    for (size_t u = nextUnit++; u < units.size(); u = nextUnit++) {
+        const WorkUnit& unit = units[u];
+        const Cell& cell = cells[unit.cell];
+        if (!arenas[cell.loadout]) arenas[cell.loadout] = new Arena(options.loadouts[cell.loadout]);
+
+        // Chunk seed depends only on what is simulated, never on the thread.
+        // Game code draws from the Rng streams, the policies from random().
+        uint32_t chunkSeed = (uint32_t)(options.seed * 1000003UL + (unsigned long)unit.cell * 7919UL + (unsigned long)(unit.firstFight / FIGHTS_PER_CHUNK));
+        Rng::seedRun(chunkSeed);
+        randomSeed(chunkSeed);
+
+        for (long i = 0; i < unit.count; i++) {
+            int enemyID = options.enemy ? options.enemy : Floor::rollEnemyForFloor(cell.floor);
+            arenas[cell.loadout]->fight(enemyID, policies[cell.policy], options.maxTurns,
+                                        local[statsIndex(unit.cell, enemyID)]);
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(totalsLock);
+    for (size_t i = 0; i < totals.size(); i++) totals[i].merge(local[i]);
+
+    for (Arena* arena : arenas) delete arena;
+    for (CombatPolicy* policy : policies) delete policy;
+}
+
+//============================================================================
+// REPORTING
+//============================================================================
+
+static std::string loadoutName(const std::vector<int>& loadout) {
+    std::string name;
+    for (size_t i = 0; i < loadout.size(); i++) {
+        if (i) name += ",";
+        name += std::to_string(loadout[i]);
+    }
+    return name;
+}
+
+static FlashString enemyName(int enemyID) {
+    return Enemy::createEnemyByID(enemyID).getName();
+}
+
+static void printSummary(const Options& options, const std::vector<Cell>& cells, const std::vector<Stats>& totals) {
+    printf("%-14s %-8s %5s %-10s %9s %7s %7s %7s %6s %4s %4s %6s %6s\n",
+           "loadout", "policy", "floor", "enemy", "fights", "win%", "lose%", "t/o%",
+           "turns", "p50", "p90", "hp", "mana5");
+    for (size_t c = 0; c < cells.size(); c++) {
+        const Cell& cell = cells[c];
+        for (int id = 1; id <= ENEMY_TYPES; id++) {
+            const Stats& s = totals[statsIndex((int)c, id)];
+            if (s.fights == 0) continue;
+            double fights = (double)s.fights;
+            // Mana at the end of turn 5; "-" when every fight was over sooner
+            char mana5[16] = "-";
+            if (s.manaCount[4]) snprintf(mana5, sizeof(mana5), "%.1f", (double)s.manaSum[4] / s.manaCount[4]);
+            printf("%-14s %-8s %5d %-10s %9llu %6.2f%% %6.2f%% %6.2f%% %6.2f %4d %4d %6.1f %6s\n",
+                   loadoutName(options.loadouts[cell.loadout]).c_str(), options.policies[cell.policy].c_str(),
+                   cell.floor, enemyName(id).c_str(), (unsigned long long)s.fights,
+                   100.0 * s.wins / fights, 100.0 * s.losses / fights, 100.0 * s.timeouts / fights,
+                   s.wins ? (double)s.winTurns / s.wins : 0.0,
+                   s.winTurnPercentile(0.5), s.winTurnPercentile(0.9),
+                   s.wins ? (double)s.hpLeft / s.wins : 0.0, mana5);
+        }
+    }
+}
+
+static bool writeCsv(const char* path, const Options& options, const std::vector<Cell>& cells,
+                     const std::vector<Stats>& totals) {
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+
+    fprintf(out, "loadout,policy,floor,enemy_id,enemy,fights,wins,losses,timeouts,avg_turns,p50_turns,p90_turns,avg_hp_left");
+    for (int t = 1; t <= MANA_CURVE_TURNS; t++) fprintf(out, ",mana_t%d", t);
+    fprintf(out, "\n");
+
+    for (size_t c = 0; c < cells.size(); c++) {
+        const Cell& cell = cells[c];
+        for (int id = 1; id <= ENEMY_TYPES; id++) {
+            const Stats& s = totals[statsIndex((int)c, id)];
+            if (s.fights == 0) continue;
+            fprintf(out, "\"%s\",%s,%d,%d,%s,%llu,%llu,%llu,%llu,%.3f,%d,%d,%.2f",
+                    loadoutName(options.loadouts[cell.loadout]).c_str(), options.policies[cell.policy].c_str(),
+                    cell.floor, id, enemyName(id).c_str(),
+                    (unsigned long long)s.fights, (unsigned long long)s.wins,
+                    (unsigned long long)s.losses, (unsigned long long)s.timeouts,
+                    s.wins ? (double)s.winTurns / s.wins : 0.0,
+                    s.winTurnPercentile(0.5), s.winTurnPercentile(0.9),
+                    s.wins ? (double)s.hpLeft / s.wins : 0.0);
+            // Empty once no fight lasted that long
+            for (int t = 0; t < MANA_CURVE_TURNS; t++) {
+                if (s.manaCount[t]) {
+                    fprintf(out, ",%.2f", (double)s.manaSum[t] / s.manaCount[t]);
+                } else {
+                    fprintf(out, ",");
+                }
+            }
+            fprintf(out, "\n");
+        }
+    }
+    fclose(out);
+    return true;
+}
+
+//============================================================================
+// COMMAND LINE
+//============================================================================
+
+static void usage() {
+    fprintf(stderr,
+            "usage: combat_sim [--loadout ID,ID,..]... [--policy NAME]... [--floor N]...\n"
+            "                  [--enemy ID] [--fights N] [--threads N] [--seed N]\n"
+            "                  [--max-turns N] [--csv PATH]\n"
+            "  loadout: up to 4 spell IDs, equipped in order (default 31,34)\n"
+            "  policy:  %s (default greedy)\n"
+            "  floor:   1-%d (default all); enemy: 1-%d forces one type\n"
+            "  fights:  per loadout/policy/floor (default 100000)\n",
+            CombatPolicy::listNames(), FLOORS_PER_DUNGEON, ENEMY_TYPES);
+}
+
+static bool parseLoadout(const char* text, std::vector<int>& loadout) {
+    std::string list(text);
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) end = list.size();
+        int id = atoi(list.substr(start, end - start).c_str());
+        if (!SpellFactory::getSpell(id)) return false;
+        loadout.push_back(id);
+        start = end + 1;
+    }
+    return !loadout.empty() && loadout.size() <= 4;
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--loadout") == 0 && value) {
+            std::vector<int> loadout;
+            if (!parseLoadout(value, loadout)) {
+                fprintf(stderr, "combat_sim: bad loadout %s\n", value);
+                return false;
+            }
+            options.loadouts.push_back(loadout);
+        } else if (strcmp(arg, "--policy") == 0 && value) {
+            CombatPolicy* policy = CombatPolicy::create(value);
+            if (!policy) {
+                fprintf(stderr, "combat_sim: unknown policy %s\n", value);
+                return false;
+            }
+            delete policy;
+            options.policies.push_back(value);
+        } else if (strcmp(arg, "--floor") == 0 && value) {
+            int floor = atoi(value);
+            if (floor < 1 || floor > FLOORS_PER_DUNGEON) return false;
+            options.floors.push_back(floor);
+        } else if (strcmp(arg, "--enemy") == 0 && value) {
+            options.enemy = atoi(value);
+            if (options.enemy < 1 || options.enemy > ENEMY_TYPES) return false;
+        } else if (strcmp(arg, "--fights") == 0 && value) {
+            options.fightsPerCell = atol(value);
+        } else if (strcmp(arg, "--threads") == 0 && value) {
+            options.threads = atoi(value);
+        } else if (strcmp(arg, "--seed") == 0 && value) {
+            options.seed = strtoul(value, nullptr, 10);
+        } else if (strcmp(arg, "--max-turns") == 0 && value) {
+            options.maxTurns = atoi(value);
+        } else if (strcmp(arg, "--csv") == 0 && value) {
+            options.csvPath = value;
+        } else {
+            return false;
+        }
+        i++;  // Every option takes a value
+    }
+
+    if (options.loadouts.empty()) options.loadouts.push_back({31, 34});
+    if (options.policies.empty()) options.policies.push_back("greedy");
+    if (options.floors.empty()) {
+        for (int floor = 1; floor <= FLOORS_PER_DUNGEON; floor++) options.floors.push_back(floor);
+    }
+    if (options.threads <= 0) options.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    return options.fightsPerCell > 0 && options.maxTurns > 0;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 1;
+    }
+
+    std::vector<Cell> cells;
+    for (int l = 0; l < (int)options.loadouts.size(); l++) {
+        for (int p = 0; p < (int)options.policies.size(); p++) {
+            for (int floor : options.floors) cells.push_back({l, p, floor});
+        }
+    }
+
+    std::vector<WorkUnit> units;
+    for (int c = 0; c < (int)cells.size(); c++) {
+        for (long first = 0; first < options.fightsPerCell; first += FIGHTS_PER_CHUNK) {
+            units.push_back({c, first, std::min((long)FIGHTS_PER_CHUNK, options.fightsPerCell - first)});
+        }
+    }
+
+    std::vector<Stats> totals(cells.size() * ENEMY_TYPES);
+    std::atomic<size_t> nextUnit(0);
+    std::mutex totalsLock;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; t++) {
+        workers.emplace_back(runWorker, std::cref(options), std::cref(cells), std::cref(units),
+                             std::ref(nextUnit), std::ref(totals), std::ref(totalsLock));
+    }
+    for (std::thread& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printSummary(options, cells, totals);
+
+    uint64_t fights = 0;
+    for (const Stats& s : totals) fights += s.fights;
+    fprintf(stderr, "combat_sim: %llu fights in %.2f s on %d threads (%.0f fights/s)\n",
+            (unsigned long long)fights, seconds, options.threads, seconds > 0 ? fights / seconds : 0.0);
+
+    if (options.csvPath && !writeCsv(options.csvPath, options, cells, totals)) {
+        fprintf(stderr, "combat_sim: can't write %s\n", options.csvPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,478 @@
+// Full-run dungeon simulator (native env only): plays whole runs headless,
+// from the first door on floor 1 to death or the floor FLOORS_PER_DUNGEON
+// boss, through the real DungeonManager, Floor, CombatManager and the room
+// rules (treasure scrolls, shop, library rest).
+//
+//   pio run -e dungeon_sim
+//   .pio/build/dungeon_sim/program --policy fighter --policy explorer
+//       --runs 50000 --csv survival.csv --json runs.json
+//
+// (one command line). Reports survival per door on every floor, the floor
+// reached, and gold / HP / mana on arrival at each floor. Every run gets a
+// game seed from (seed, policy, run) and policies are seeded per chunk, so
+// the numbers are the same for any --threads.
+
+#include <Arduino.h>
+#include "../combat/combat_manager.h"
+#include "../dungeon/DungeonManager.h"
+#include "../rooms/LibraryRoomState.h"
+#include "../rooms/ShopRoomState.h"
+#include "../rooms/TreasureRoomState.h"
+#include "../spells/spell.h"
+#include "../utils/constants.h"
+#include "../utils/Rng.h"
+#include "sim/CombatPolicy.h"
+#include "sim/RunPolicy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define RUNS_PER_CHUNK   256
+#define DOORS_PER_FLOOR  (ROOMS_PER_FLOOR + 1)  // Regular doors, then the boss
+#define ENEMY_TYPES      6
+#define DEFAULT_MAX_TURNS 200   // A fight still going after this ends the run
+
+struct Options {
+    std::vector<std::string> policies;
+    std::string combatPolicy = "careful";
+    long runs = 20000;
+    int threads = 0;            // 0: hardware concurrency
+    unsigned long seed = 1;
+    int maxTurns = DEFAULT_MAX_TURNS;
+    const char* csvPath = nullptr;
+    const char* jsonPath = nullptr;
+};
+
+enum RunEnd {
+    RUN_DIED,
+    RUN_STALLED,                // Fight hit --max-turns
+    RUN_CLEARED
+};
+
+// Totals for one run policy; plain sums so merge order doesn't matter
+struct Stats {
+    uint64_t runs = 0;
+    uint64_t died = 0;
+    uint64_t stalled = 0;
+    uint64_t cleared = 0;
+    uint64_t reachedDoor[FLOORS_PER_DUNGEON][DOORS_PER_FLOOR] = {};
+    uint64_t floorReached[FLOORS_PER_DUNGEON + 1] = {};     // [0] unused
+    uint64_t deathsByEnemy[ENEMY_TYPES + 1] = {};          // By enemy ID
+
+    // On arrival at each floor (first door choice, after the library)
+    uint64_t arrivals[FLOORS_PER_DUNGEON] = {};
+    uint64_t goldSum[FLOORS_PER_DUNGEON] = {};
+    uint64_t hpSum[FLOORS_PER_DUNGEON] = {};
+    uint64_t manaSum[FLOORS_PER_DUNGEON] = {};
+    uint64_t knownSpellsSum[FLOORS_PER_DUNGEON] = {};
+
+    uint64_t fights = 0;
+    uint64_t turns = 0;
+    uint64_t scrollsFound = 0;
+    uint64_t spellsLearned = 0;
+    uint64_t potionsBought = 0;
+    uint64_t rests = 0;
+    uint64_t goldSpent = 0;
+
+    void merge(const Stats& other) {
+        const uint64_t* from = &other.runs;
+        uint64_t* to = &runs;
+        for (size_t i = 0; i < sizeof(Stats) / sizeof(uint64_t); i++) to[i] += from[i];
+    }
+};
+
+static_assert(sizeof(Stats) % sizeof(uint64_t) == 0, "Stats::merge adds it up as uint64_t");
+
+//============================================================================
+// SIMULATION
+//============================================================================
+
+// Mirrors what the room states do between door choices, without the screens
+class RunSimulator {
+private:
+    RunPolicy* policy;
+    CombatPolicy* combatPolicy;
+    int maxTurns;
+    CombatManager combat;
+    Enemy enemy;
+
+    // Fights until one side drops; false if it hit maxTurns first
+    bool fight(Player* player, Room* room, Stats& stats, CombatResult& result) {
+        enemy = room->createEnemy();
+        combatPolicy->reset();
+        combat.startCombat(player, &enemy);
+
+        result = RESULT_ONGOING;
+        int turn = 0;
+        while (result == RESULT_ONGOING && turn < maxTurns) {
+            turn++;
+            result = combat.processTurn(combatPolicy->chooseAction(player, &enemy, turn)).outcome;
+        }
+        combat.endCombat();
+
+        stats.fights++;
+        stats.turns += turn;
+        return result != RESULT_ONGOING;
+    }
+
+    // LibraryRoomState after a boss: read every scroll, re-equip, maybe rest
+    void visitLibrary(Player* player, std::vector<const Spell*>& scrolls, Stats& stats) {
+        for (const Spell* scroll : scrolls) {
+            if (!player->getSpellLibrary()->hasSpell(scroll->getID()) && player->learnSpell(scroll)) {
+                stats.spellsLearned++;
+            }
+        }
+        scrolls.clear();
+
+        policy->equipSpells(player);
+
+        if (policy->wantsRest(player) && LibraryRoomState::restPlayer(player) == nullptr) {
+            stats.rests++;
+        }
+    }
+
+public:
+    RunSimulator(RunPolicy* runPolicy, CombatPolicy* turnPolicy, int turnLimit)
+        : policy(runPolicy), combatPolicy(turnPolicy), maxTurns(turnLimit) {}
+
+    RunEnd run(Stats& stats) {
+        Player player("Hero");
+        DungeonManager dungeon(&player);
+        std::vector<const Spell*> scrolls;     // GameStateManager's pending scrolls
+        Meditate::resetConsecutiveUses();
+
+        int startGold = player.getGold();
+        int arrivedFloor = 0;
+        RunEnd end = RUN_DIED;
+        bool running = true;
+
+        while (running) {
+            std::vector<DoorChoice> choices = dungeon.getAvailableRooms();
+            int floor = dungeon.getCurrentFloorNumber();
+            Floor* currentFloor = dungeon.getCurrentFloor();
+
+            if (floor != arrivedFloor) {
+                arrivedFloor = floor;
+                stats.arrivals[floor - 1]++;
+                stats.goldSum[floor - 1] += player.getGold();
+                stats.hpSum[floor - 1] += player.getCurrentHP();
+                stats.manaSum[floor - 1] += player.getCurrentMana();
+                stats.knownSpellsSum[floor - 1] += player.getSpellLibrary()->getKnownSpellCount();
+            }
+            stats.reachedDoor[floor - 1][min(currentFloor->getRoomsCompleted(), ROOMS_PER_FLOOR)]++;
+
+            Room* room = dungeon.selectRoom(policy->chooseDoor(choices, &player, floor));
+            if (!room) break;
+
+            switch (room->getType()) {
+                case ROOM_ENEMY:
+                case ROOM_BOSS: {
+                    CombatResult result;
+                    if (!fight(&player, room, stats, result)) {
+                        end = RUN_STALLED;
+                        running = false;
+                    } else if (result == RESULT_DEFEAT) {
+                        stats.deathsByEnemy[room->getEnemyType()]++;
+                        end = RUN_DIED;
+                        running = false;
+                    } else if (room->getType() == ROOM_BOSS) {
+                        // CombatRoomState: complete, next floor, straight to the library
+                        dungeon.markRoomCompleted();
+                        if (floor == FLOORS_PER_DUNGEON) {
+                            end = RUN_CLEARED;
+                            running = false;
+                            break;
+                        }
+                        dungeon.advanceToNextFloor();
+                        visitLibrary(&player, scrolls, stats);
+                        // LibraryRoomState::completeRoom counts toward the new floor
+                        dungeon.getCurrentFloor()->incrementRoomsCompleted();
+                    } else {
+                        dungeon.markRoomCompleted();
+                    }
+                    break;
+                }
+
+                case ROOM_TREASURE:
+                    scrolls.push_back(TreasureRoomState::generateScrollForFloor(floor));
+                    stats.scrollsFound++;
+                    // TreasureRoomState::completeRoom bypasses DungeonManager
+                    currentFloor->incrementRoomsCompleted();
+                    break;
+
+                case ROOM_SHOP:
+                    while (policy->wantsPotion(&player) && ShopRoomState::purchaseHealthPotion(&player)) {
+                        stats.potionsBought++;
+                    }
+                    dungeon.markRoomCompleted();
+                    break;
+            }
+        }
+
+        stats.runs++;
+        stats.floorReached[arrivedFloor]++;
+        stats.goldSpent += startGold - player.getGold();
+        if (end == RUN_CLEARED) stats.cleared++;
+        else if (end == RUN_STALLED) stats.stalled++;
+        else stats.died++;
+        return end;
+    }
+};
+
+// Game seed for one run (FNV-1a over the inputs)
+static uint32_t runSeed(unsigned long seed, int policy, long run) {
+    uint32_t hash = 2166136261u;
+    uint32_t parts[3] = {(uint32_t)seed, (uint32_t)policy, (uint32_t)run};
+    for (uint32_t part : parts) {
+        for (int i = 0; i < 4; i++) {
+            hash = (hash ^ ((part >> (i * 8)) & 0xFF)) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+struct WorkUnit {
+    int policy;
+    long firstRun;
+    long count;
+};
+
+static void runWorker(const Options& options, const std::vector<WorkUnit>& units,
+                      std::atomic<size_t>& nextUnit, std::vector<Stats>& totals, std::mutex& totalsLock) {
+    std::vector<RunPolicy*> policies;
+    for (const std::string& name : options.policies) policies.push_back(RunPolicy::create(name.c_str()));
+    CombatPolicy* combatPolicy = CombatPolicy::create(options.combatPolicy.c_str());
+    std::vector<Stats> local(totals.size());
+
+    for (size_t u = nextUnit++; u < units.size(); u = nextUnit++) {
+        const WorkUnit& unit = units[u];
+
+        // Seeds depend only on what is simulated, never on the thread. Each
+        // run gets its own game seed; the policies draw from random().
+        randomSeed(options.seed * 1000003UL + (unsigned long)unit.policy * 7919UL + (unsigned long)(unit.firstRun / RUNS_PER_CHUNK));
+
+        RunSimulator simulator(policies[unit.policy], combatPolicy, options.maxTurns);
+        for (long i = 0; i < unit.count; i++) {
+            Rng::seedRun(runSeed(options.seed, unit.policy, unit.firstRun + i));
+            simulator.run(local[unit.policy]);
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(totalsLock);
+    for (size_t i = 0; i < totals.size(); i++) totals[i].merge(local[i]);
+
+    for (RunPolicy* policy : policies) delete policy;
+    delete combatPolicy;
+}
+
+//============================================================================
+// REPORTING
+//============================================================================
+
+static double average(uint64_t sum, uint64_t count) {
+    return count ? (double)sum / count : 0.0;
+}
+
+static void printSummary(const Options& options, const std::vector<Stats>& totals) {
+    for (size_t p = 0; p < totals.size(); p++) {
+        const Stats& s = totals[p];
+        double runs = (double)s.runs;
+        printf("policy %s (combat: %s): %llu runs, cleared %.2f%%, died %.2f%%, stalled %.2f%%\n",
+               options.policies[p].c_str(), options.combatPolicy.c_str(), (unsigned long long)s.runs,
+               100.0 * s.cleared / runs, 100.0 * s.died / runs, 100.0 * s.stalled / runs);
+        printf("  floor  reached  boss%%  died here   gold     hp   mana  spells\n");
+        for (int f = 0; f < FLOORS_PER_DUNGEON; f++) {
+            uint64_t diedHere = s.floorReached[f + 1];
+            if (f + 1 == FLOORS_PER_DUNGEON) diedHere -= s.cleared;
+            printf("  %5d  %6.2f%% %5.1f%%  %8llu  %5.1f  %5.1f  %5.1f  %6.2f\n", f + 1,
+                   100.0 * s.arrivals[f] / runs,
+                   100.0 * s.reachedDoor[f][ROOMS_PER_FLOOR] / runs,
+                   (unsigned long long)diedHere,
+                   average(s.goldSum[f], s.arrivals[f]), average(s.hpSum[f], s.arrivals[f]),
+                   average(s.manaSum[f], s.arrivals[f]), average(s.knownSpellsSum[f], s.arrivals[f]));
+        }
+        printf("  per run: %.1f fights, %.1f turns, %.2f scrolls, %.2f learned, %.2f potions, %.2f rests, %.1f gold spent\n\n",
+               average(s.fights, s.runs), average(s.turns, s.runs), average(s.scrollsFound, s.runs),
+               average(s.spellsLearned, s.runs), average(s.potionsBought, s.runs),
+               average(s.rests, s.runs), average(s.goldSpent, s.runs));
+    }
+}
+
+// Survival curve: share of runs that got to pick each door
+static bool writeCsv(const char* path, const Options& options, const std::vector<Stats>& totals) {
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+
+    fprintf(out, "policy,floor,door,boss,reached,survival\n");
+    for (size_t p = 0; p < totals.size(); p++) {
+        const Stats& s = totals[p];
+        for (int f = 0; f < FLOORS_PER_DUNGEON; f++) {
+            for (int d = 0; d < DOORS_PER_FLOOR; d++) {
+                fprintf(out, "%s,%d,%d,%d,%llu,%.5f\n", options.policies[p].c_str(), f + 1, d + 1,
+                        d == ROOMS_PER_FLOOR ? 1 : 0, (unsigned long long)s.reachedDoor[f][d],
+                        average(s.reachedDoor[f][d], s.runs));
+            }
+        }
+    }
+    fclose(out);
+    return true;
+}
+
+static void writeJsonArray(FILE* out, const char* name, const uint64_t* values, int count, bool last = false) {
+    fprintf(out, "      \"%s\": [", name);
+    for (int i = 0; i < count; i++) fprintf(out, "%s%llu", i ? ", " : "", (unsigned long long)values[i]);
+    fprintf(out, "]%s\n", last ? "" : ",");
+}
+
+static bool writeJson(const char* path, const Options& options, const std::vector<Stats>& totals) {
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+
+    fprintf(out, "{\n  \"floors\": %d,\n  \"doorsPerFloor\": %d,\n  \"seed\": %lu,\n  \"combatPolicy\": \"%s\",\n  \"policies\": [\n",
+            FLOORS_PER_DUNGEON, DOORS_PER_FLOOR, options.seed, options.combatPolicy.c_str());
+    for (size_t p = 0; p < totals.size(); p++) {
+        const Stats& s = totals[p];
+        fprintf(out, "    {\n      \"name\": \"%s\",\n", options.policies[p].c_str());
+        fprintf(out, "      \"runs\": %llu, \"cleared\": %llu, \"died\": %llu, \"stalled\": %llu,\n",
+                (unsigned long long)s.runs, (unsigned long long)s.cleared,
+                (unsigned long long)s.died, (unsigned long long)s.stalled);
+        fprintf(out, "      \"reachedDoor\": [");
+        for (int f = 0; f < FLOORS_PER_DUNGEON; f++) {
+            fprintf(out, "%s[", f ? ", " : "");
+            for (int d = 0; d < DOORS_PER_FLOOR; d++) {
+                fprintf(out, "%s%llu", d ? ", " : "", (unsigned long long)s.reachedDoor[f][d]);
+            }
+            fprintf(out, "]");
+        }
+        fprintf(out, "],\n");
+        writeJsonArray(out, "floorReached", s.floorReached + 1, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "arrivals", s.arrivals, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "goldOnArrival", s.goldSum, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "hpOnArrival", s.hpSum, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "manaOnArrival", s.manaSum, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "knownSpellsOnArrival", s.knownSpellsSum, FLOORS_PER_DUNGEON);
+        writeJsonArray(out, "deathsByEnemy", s.deathsByEnemy + 1, ENEMY_TYPES);
+        fprintf(out, "      \"fights\": %llu, \"turns\": %llu, \"scrollsFound\": %llu, \"spellsLearned\": %llu,\n",
+                (unsigned long long)s.fights, (unsigned long long)s.turns,
+                (unsigned long long)s.scrollsFound, (unsigned long long)s.spellsLearned);
+        fprintf(out, "      \"potionsBought\": %llu, \"rests\": %llu, \"goldSpent\": %llu\n",
+                (unsigned long long)s.potionsBought, (unsigned long long)s.rests, (unsigned long long)s.goldSpent);
+        fprintf(out, "    }%s\n", p + 1 < totals.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    fclose(out);
+    return true;
+}
+
+//============================================================================
+// COMMAND LINE
+//============================================================================
+
+static void usage() {
+    fprintf(stderr,
+            "usage: dungeon_sim [--policy NAME]... [--combat NAME] [--runs N] [--threads N]\n"
+            "                   [--seed N] [--max-turns N] [--csv PATH] [--json PATH]\n"
+            "  policy: %s (default: all)\n"
+            "  combat: %s (default careful)\n"
+            "  runs:   per policy (default 20000)\n"
+            "  csv:    survival per door; json: everything\n",
+            RunPolicy::listNames(), CombatPolicy::listNames());
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--policy") == 0 && value) {
+            RunPolicy* policy = RunPolicy::create(value);
+            if (!policy) {
+                fprintf(stderr, "dungeon_sim: unknown policy %s\n", value);
+                return false;
+            }
+            delete policy;
+            options.policies.push_back(value);
+        } else if (strcmp(arg, "--combat") == 0 && value) {
+            CombatPolicy* policy = CombatPolicy::create(value);
+            if (!policy) {
+                fprintf(stderr, "dungeon_sim: unknown combat policy %s\n", value);
+                return false;
+            }
+            delete policy;
+            options.combatPolicy = value;
+        } else if (strcmp(arg, "--runs") == 0 && value) {
+            options.runs = atol(value);
+        } else if (strcmp(arg, "--threads") == 0 && value) {
+            options.threads = atoi(value);
+        } else if (strcmp(arg, "--seed") == 0 && value) {
+            options.seed = strtoul(value, nullptr, 10);
+        } else if (strcmp(arg, "--max-turns") == 0 && value) {
+            options.maxTurns = atoi(value);
+        } else if (strcmp(arg, "--csv") == 0 && value) {
+            options.csvPath = value;
+        } else if (strcmp(arg, "--json") == 0 && value) {
+            options.jsonPath = value;
+        } else {
+            return false;
+        }
+        i++;  // Every option takes a value
+    }
+
+    if (options.policies.empty()) {
+        for (const char* name : {"left", "random", "fighter", "explorer"}) options.policies.push_back(name);
+    }
+    if (options.threads <= 0) options.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    return options.runs > 0 && options.maxTurns > 0;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 1;
+    }
+
+    std::vector<WorkUnit> units;
+    for (int p = 0; p < (int)options.policies.size(); p++) {
+        for (long first = 0; first < options.runs; first += RUNS_PER_CHUNK) {
+            units.push_back({p, first, std::min((long)RUNS_PER_CHUNK, options.runs - first)});
+        }
+    }
+
+    std::vector<Stats> totals(options.policies.size());
+    std::atomic<size_t> nextUnit(0);
+    std::mutex totalsLock;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; t++) {
+        workers.emplace_back(runWorker, std::cref(options), std::cref(units),
+                             std::ref(nextUnit), std::ref(totals), std::ref(totalsLock));
+    }
+    for (std::thread& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printSummary(options, totals);
+
+    uint64_t runs = 0;
+    for (const Stats& s : totals) runs += s.runs;
+    fprintf(stderr, "dungeon_sim: %llu runs in %.2f s on %d threads (%.0f runs/min)\n",
+            (unsigned long long)runs, seconds, options.threads, seconds > 0 ? runs * 60.0 / seconds : 0.0);
+
+    if (options.csvPath && !writeCsv(options.csvPath, options, totals)) {
+        fprintf(stderr, "dungeon_sim: can't write %s\n", options.csvPath);
+        return 1;
+    }
+    if (options.jsonPath && !writeJson(options.jsonPath, options, totals)) {
+        fprintf(stderr, "dungeon_sim: can't write %s\n", options.jsonPath);
+        return 1;
+    }
+    return 0;
+}
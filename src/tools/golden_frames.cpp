@@ -0,0 +1,376 @@
+// Golden-frame check (native env only): replays an input recording through
+// the real game at full speed, hashes the panel each time a batch of
+// replayed button events arrives, and compares the hashes with a checked-in
+// list. Meant to run before and after rendering changes (dirty rects, glyph
+// caches, DMA): any pixel that ends up different on the panel shows up.
+//
+//   pio run -e golden_frames && .pio/build/golden_frames/program
+//   .pio/build/golden_frames/program --ppm frames/      (images of mismatches)
+//   .pio/build/golden_frames/program --update --ppm frames/
+//
+// --update rewrites the golden list (and with --ppm writes every snapshot,
+// to eyeball the new goldens). Paths default to golden/session.rec and
+// golden/session.txt, relative to the project root.
+//
+// The replay also runs with heap accounting in assert mode: code marked
+// ALLOC_FORBID_SCOPE that allocates (e.g. a combat turn, in
+// CombatManager::processTurn) aborts the check. --heap prints the per-state
+// and per-scope heap report at the end.
+//
+// Snapshots show the screen as the player saw it when pressing a button
+// (an in-flight present is allowed to land first), so they include screens
+// that block in their own input loop, plus one of the settled screen after
+// the last event. Only the game state and the hash are compared; the loop
+// and event counts in the list are there to find the spot in the session.
+//
+// The session in golden/ starts at boot and covers the title screen, door
+// choices, treasure, combat, the library (reached through the floor's shop
+// door) and game over. ShopRoomState has no way in from the game right now
+// - shop doors open the library - so it shows up as SHOP=0. The session was
+// recorded with
+//   .pio/build/native/program --fs golden --seed 3 --max-ms 600000
+//       --console w --keys "$(cat golden/session.keys)" --serial x
+// (one command line; then move golden/input.rec to golden/session.rec and
+// run --update)
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+#include "../graphics/Display.h"
+#include "../game/GameStateManager.h"
+#include "../input/InputRecording.h"
+#include "../debug/AllocTracker.h"
+#include "../debug/Log.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define DEFAULT_RECORDING "golden/session.rec"
+#define DEFAULT_GOLDEN    "golden/session.txt"
+#define DEFAULT_MAX_FRAMES 200000
+#define DEFAULT_MAX_MS     (60 * 60 * 1000UL)  // Virtual time
+
+// The game's globals and loop, from main.cpp
+extern Display display;
+extern GameStateManager gameState;
+
+// Those globals already log from their constructors; keep that out of the
+// report (main() turns Serial back on for --verbose)
+struct QuietBeforeGlobals {
+    QuietBeforeGlobals() { HostRuntime::setQuiet(true); }
+};
+static QuietBeforeGlobals quietBeforeGlobals __attribute__((init_priority(101)));
+
+struct Options {
+    const char* recordingPath = DEFAULT_RECORDING;
+    const char* goldenPath = DEFAULT_GOLDEN;
+    const char* ppmDir = nullptr;
+    bool update = false;
+    bool verbose = false;
+    bool heap = false;
+    unsigned long maxFrames = DEFAULT_MAX_FRAMES;
+    uint64_t maxMs = DEFAULT_MAX_MS;
+};
+
+struct Snapshot {
+    unsigned long loop;
+    uint32_t events;
+    std::string state;
+    uint64_t hash;
+};
+
+// Screens the session is expected to show
+static const StateTransition requiredScreens[] = {
+    StateTransition::MAIN_MENU, StateTransition::DOOR_CHOICE, StateTransition::COMBAT,
+    StateTransition::LIBRARY, StateTransition::SHOP, StateTransition::TREASURE,
+    StateTransition::GAME_OVER,
+};
+
+static const char* stateName(StateTransition state) {
+    switch (state) {
+        case StateTransition::MAIN_MENU: return "MAIN_MENU";
+        case StateTransition::DOOR_CHOICE: return "DOOR_CHOICE";
+        case StateTransition::COMBAT: return "COMBAT";
+        case StateTransition::LIBRARY: return "LIBRARY";
+        case StateTransition::SHOP: return "SHOP";
+        case StateTransition::TREASURE: return "TREASURE";
+        case StateTransition::GAME_OVER: return "GAME_OVER";
+        default: return "NONE";
+    }
+}
+
+static void usage() {
+    fprintf(stderr,
+            "usage: golden_frames [--rec PATH] [--golden PATH] [--update] [--ppm DIR]\n"
+            "                     [--frames N] [--max-ms N] [--heap] [--verbose]\n"
+            "  rec:    input recording to replay (default %s)\n"
+            "  golden: snapshot list to check or rewrite (default %s)\n"
+            "  ppm:    write mismatching snapshots (all of them with --update)\n"
+            "  frames, max-ms: give up after N loops (default %d) or N ms of\n"
+            "          virtual time (default %lu)\n"
+            "  heap:   print the heap report at the end\n",
+            DEFAULT_RECORDING, DEFAULT_GOLDEN, DEFAULT_MAX_FRAMES, DEFAULT_MAX_MS);
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--update") == 0) {
+            options.update = true;
+            continue;
+        } else if (strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+            continue;
+        } else if (strcmp(arg, "--heap") == 0) {
+            options.heap = true;
+            continue;
+        } else if (strcmp(arg, "--rec") == 0 && value) {
+            options.recordingPath = value;
+        } else if (strcmp(arg, "--golden") == 0 && value) {
+            options.goldenPath = value;
+        } else if (strcmp(arg, "--ppm") == 0 && value) {
+            options.ppmDir = value;
+        } else if (strcmp(arg, "--frames") == 0 && value) {
+            options.maxFrames = strtoul(value, nullptr, 10);
+        } else if (strcmp(arg, "--max-ms") == 0 && value) {
+            options.maxMs = strtoull(value, nullptr, 10);
+        } else {
+            return false;
+        }
+        i++;
+    }
+    return options.maxFrames > 0 && options.maxMs > 0;
+}
+
+//============================================================================
+// SNAPSHOTS
+//============================================================================
+
+// FNV-1a over the panel's RGB565 pixels
+static uint64_t hashPanel() {
+    const uint16_t* pixels = display.getTFT().hostPixels();
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < Display::WIDTH * Display::HEIGHT; i++) {
+        hash = (hash ^ (pixels[i] & 0xFF)) * 0x100000001B3ULL;
+        hash = (hash ^ (pixels[i] >> 8)) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static bool writePpm(const char* dir, size_t index, const Snapshot& snapshot) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%04zu_%s.ppm", dir, index, snapshot.state.c_str());
+    FILE* out = fopen(path, "wb");
+    if (!out) return false;
+
+    const uint16_t* pixels = display.getTFT().hostPixels();
+    fprintf(out, "P6\n%d %d\n255\n", Display::WIDTH, Display::HEIGHT);
+    for (int i = 0; i < Display::WIDTH * Display::HEIGHT; i++) {
+        uint16_t c = pixels[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, out);
+    }
+    fclose(out);
+    return true;
+}
+
+static bool readGolden(const char* path, std::vector<Snapshot>& golden) {
+    FILE* in = fopen(path, "r");
+    if (!in) return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), in)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        size_t index;
+        unsigned long loop;
+        unsigned long events;
+        char state[32];
+        unsigned long long hash;
+        if (sscanf(line, "%zu %lu %lu %31s %llx", &index, &loop, &events, state, &hash) == 5) {
+            golden.push_back({loop, (uint32_t)events, state, (uint64_t)hash});
+        }
+    }
+    fclose(in);
+    return true;
+}
+
+static bool writeGolden(const char* path, const Options& options, const std::vector<Snapshot>& snapshots) {
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+
+    fprintf(out, "# golden_frames snapshots of %s\n", options.recordingPath);
+    fprintf(out, "# index loop events state fnv1a64\n");
+    for (size_t i = 0; i < snapshots.size(); i++) {
+        const Snapshot& s = snapshots[i];
+        fprintf(out, "%zu %lu %lu %s %016llx\n", i, s.loop, (unsigned long)s.events, s.state.c_str(),
+                (unsigned long long)s.hash);
+    }
+    fclose(out);
+    return true;
+}
+
+//============================================================================
+// REPLAY
+//============================================================================
+
+// LittleFS paths are rooted at --fs; split the recording path to match
+static bool startReplay(const char* recordingPath) {
+    static std::string root;
+    std::string path(recordingPath);
+    size_t slash = path.rfind('/');
+    root = slash == std::string::npos ? "." : path.substr(0, slash);
+    std::string name = "/" + (slash == std::string::npos ? path : path.substr(slash + 1));
+
+    HostRuntime::setFsRoot(root.c_str());
+    return InputRecording::startReplay(false, name.c_str());
+}
+
+struct Session {
+    Options options;
+    std::vector<Snapshot> golden;
+    std::vector<Snapshot> snapshots;
+    unsigned long loops = 0;
+    int mismatches = 0;
+    std::chrono::steady_clock::time_point start;
+};
+
+static Session session;
+
+// Compared as they are taken: the panel only holds the current frame, so
+// this is the one chance to write its image
+static void takeSnapshot() {
+    // Let an in-flight present land; the panel is what we compare
+    while (display.isPresenting()) {
+        display.serviceDelay(1);
+    }
+
+    size_t index = session.snapshots.size();
+    session.snapshots.push_back({session.loops, InputRecording::getEventsReplayed(),
+                                 stateName(gameState.getCurrentStateId()), hashPanel()});
+    const Snapshot& got = session.snapshots.back();
+
+    bool writeImage = session.options.update;
+    if (!session.options.update) {
+        if (index >= session.golden.size()) {
+            printf("  #%zu loop %lu: %s %016llx, not in the golden list\n", index, got.loop, got.state.c_str(),
+                   (unsigned long long)got.hash);
+            session.mismatches++;
+            writeImage = true;
+        } else {
+            const Snapshot& want = session.golden[index];
+            if (got.state != want.state || got.hash != want.hash) {
+                printf("  #%zu loop %lu: %s %016llx, expected %s %016llx\n", index, got.loop, got.state.c_str(),
+                       (unsigned long long)got.hash, want.state.c_str(), (unsigned long long)want.hash);
+                session.mismatches++;
+                writeImage = true;
+            }
+        }
+    }
+
+    if (writeImage && session.options.ppmDir && !writePpm(session.options.ppmDir, index, got)) {
+        fprintf(stderr, "golden_frames: can't write images to %s\n", session.options.ppmDir);
+    }
+}
+
+// Normal end of the session, or HostRuntime's time limit firing inside a
+// screen that blocks waiting for input the recording no longer has
+static void finishSession() {
+    HostRuntime::setTimeLimitMs(0);     // takeSnapshot() may still delay()
+    takeSnapshot();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - session.start).count();
+
+    if (InputRecording::isReplaying()) {
+        printf("  replay still running after %lu loops\n", session.loops);
+        session.mismatches++;
+    }
+    if (!session.options.update && session.snapshots.size() < session.golden.size()) {
+        printf("  session ended after %zu of %zu snapshots\n", session.snapshots.size(), session.golden.size());
+        session.mismatches++;
+    }
+
+    printf("screens:");
+    for (StateTransition screen : requiredScreens) {
+        int seen = 0;
+        for (const Snapshot& s : session.snapshots) {
+            if (s.state == stateName(screen)) seen++;
+        }
+        printf(" %s=%d", stateName(screen), seen);
+    }
+    printf("\n");
+    printf("golden_frames: %zu snapshots, %lu frames in %.3f s (%.0f frames/s), %d mismatches\n",
+           session.snapshots.size(), session.loops, seconds, seconds > 0 ? session.loops / seconds : 0.0,
+           session.mismatches);
+#if ALLOC_TRACKING
+    if (session.options.heap) {
+        Log::flush();   // Queued game lines stay behind --verbose
+        HostRuntime::setQuiet(false);
+        AllocTracker::printReport();
+        HostRuntime::setQuiet(!session.options.verbose);
+    }
+#endif
+
+    int status = session.mismatches == 0 ? 0 : 1;
+    if (session.options.update) {
+        status = 0;
+        if (writeGolden(session.options.goldenPath, session.options, session.snapshots)) {
+            printf("golden_frames: wrote %s\n", session.options.goldenPath);
+        } else {
+            fprintf(stderr, "golden_frames: can't write %s\n", session.options.goldenPath);
+            status = 1;
+        }
+    }
+    fflush(stdout);
+    exit(status);
+}
+
+static void runSession() {
+    for (session.loops = 0; session.loops < session.options.maxFrames; session.loops++) {
+        loop();
+        HostRuntime::countFrame();
+
+        // After the last event, run until the screen stops changing
+        if (!InputRecording::isReplaying() && display.getBytesFlushedLastFrame() == 0 &&
+            !display.isPresenting()) {
+            return;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Options& options = session.options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 1;
+    }
+    HostRuntime::setQuiet(!options.verbose);
+#if ALLOC_TRACKING
+    AllocTracker::setAssertMode(true);
+#endif
+
+    if (!options.update && !readGolden(options.goldenPath, session.golden)) {
+        fprintf(stderr, "golden_frames: can't read %s (run with --update to create it)\n", options.goldenPath);
+        return 1;
+    }
+
+    setup();
+    if (!startReplay(options.recordingPath)) {
+        fprintf(stderr, "golden_frames: can't replay %s\n", options.recordingPath);
+        return 1;
+    }
+
+    InputRecording::setReplayListener(takeSnapshot);
+    HostRuntime::setTimeLimitMs(options.maxMs);
+    HostRuntime::setFinishHandler(finishSession);
+    session.start = std::chrono::steady_clock::now();
+    runSession();
+    finishSession();
+}
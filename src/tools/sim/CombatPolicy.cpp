@@ -0,0 +1,109 @@
+#include "CombatPolicy.h"
+#include "../../spells/spell.h"
+#include <string.h>
+
+#define EQUIPPED_SLOTS 4
+
+static bool canCast(Player* player, const Spell* spell) {
+    return spell && player->hasEnoughMana(spell->getManaCost());
+}
+
+static bool dealsDamage(const Spell* spell) {
+    return spell->getPrimaryEffect() == EFFECT_DAMAGE ||
+           spell->getPrimaryEffect() == EFFECT_DAMAGE_OVER_TIME;
+}
+
+static bool protects(const Spell* spell) {
+    return spell->getPrimaryEffect() == EFFECT_SHIELD ||
+           (spell->hasSecondary() && spell->getSecondaryEffect() == EFFECT_HEAL);
+}
+
+//============================================================================
+// POLICIES
+//============================================================================
+
+class SlotOnePolicy : public CombatPolicy {
+public:
+    const char* getName() const override { return "slot1"; }
+    PlayerAction chooseAction(Player* player, Enemy* enemy, int turn) override {
+        return ACTION_CAST_SPELL_1;
+    }
+};
+
+class RandomPolicy : public CombatPolicy {
+public:
+    const char* getName() const override { return "random"; }
+    PlayerAction chooseAction(Player* player, Enemy* enemy, int turn) override {
+        SpellLibrary* library = player->getSpellLibrary();
+        int slots[EQUIPPED_SLOTS];
+        int count = 0;
+        for (int i = 0; i < EQUIPPED_SLOTS; i++) {
+            if (library->getEquippedSpell(i)) slots[count++] = i;
+        }
+        int pick = random(0, count + 1);
+        return pick < count ? (PlayerAction)(ACTION_CAST_SPELL_1 + slots[pick]) : ACTION_DEFEND;
+    }
+};
+
+class GreedyPolicy : public CombatPolicy {
+public:
+    const char* getName() const override { return "greedy"; }
+    PlayerAction chooseAction(Player* player, Enemy* enemy, int turn) override {
+        SpellLibrary* library = player->getSpellLibrary();
+        int best = -1;
+        int bestPower = 0;
+        int meditate = -1;
+        for (int i = 0; i < EQUIPPED_SLOTS; i++) {
+            const Spell* spell = library->getEquippedSpell(i);
+            if (!spell) continue;
+            if (spell->getHook() == SPELL_HOOK_MEDITATE) meditate = i;
+            if (!canCast(player, spell) || !dealsDamage(spell)) continue;
+
+            int power = spell->getBasePower();
+            if (spell->hasSecondary() && spell->getSecondaryEffect() == EFFECT_DAMAGE_OVER_TIME) {
+                power += spell->getSecondaryPower();
+            }
+            if (power > bestPower) {
+                best = i;
+                bestPower = power;
+            }
+        }
+        if (best >= 0) return (PlayerAction)(ACTION_CAST_SPELL_1 + best);
+        if (meditate >= 0) return (PlayerAction)(ACTION_CAST_SPELL_1 + meditate);
+        return ACTION_DEFEND;
+    }
+};
+
+class CarefulPolicy : public GreedyPolicy {
+public:
+    const char* getName() const override { return "careful"; }
+    PlayerAction chooseAction(Player* player, Enemy* enemy, int turn) override {
+        if (player->getCurrentHP() * 100 < player->getMaxHP() * 40 && !player->hasActiveEffect(EFFECT_SHIELD)) {
+            SpellLibrary* library = player->getSpellLibrary();
+            for (int i = 0; i < EQUIPPED_SLOTS; i++) {
+                const Spell* spell = library->getEquippedSpell(i);
+                if (canCast(player, spell) && protects(spell)) {
+                    return (PlayerAction)(ACTION_CAST_SPELL_1 + i);
+                }
+            }
+            return ACTION_DEFEND;
+        }
+        return GreedyPolicy::chooseAction(player, enemy, turn);
+    }
+};
+
+//============================================================================
+// REGISTRY
+//============================================================================
+
+CombatPolicy* CombatPolicy::create(const char* name) {
+    if (strcmp(name, "slot1") == 0) return new SlotOnePolicy();
+    if (strcmp(name, "random") == 0) return new RandomPolicy();
+    if (strcmp(name, "greedy") == 0) return new GreedyPolicy();
+    if (strcmp(name, "careful") == 0) return new CarefulPolicy();
+    return nullptr;
+}
+
+const char* CombatPolicy::listNames() {
+    return "slot1, random, greedy, careful";
+}
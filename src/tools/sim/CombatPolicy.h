@@ -0,0 +1,29 @@
+#ifndef COMBAT_POLICY_H
+#define COMBAT_POLICY_H
+
+#include "../../entities/player.h"
+#include "../../entities/enemy.h"
+
+// Host simulators only: picks the player's action each combat turn, standing
+// in for the buttons. Policies may keep per-fight state (reset() is called
+// before every fight) and use random(), which is per thread on the host.
+//
+//   slot1   - always the spell in slot 1, like mashing A
+//   random  - any equipped spell or defend, uniformly
+//   greedy  - strongest affordable damage spell; Meditate when dry; defend
+//   careful - greedy, but shields up / heals below 40% HP
+class CombatPolicy {
+public:
+    virtual ~CombatPolicy() {}
+
+    virtual const char* getName() const = 0;
+    virtual void reset() {}
+    virtual PlayerAction chooseAction(Player* player, Enemy* enemy, int turn) = 0;
+
+    // nullptr for an unknown name
+    static CombatPolicy* create(const char* name);
+    // Comma separated, for usage messages
+    static const char* listNames();
+};
+
+#endif
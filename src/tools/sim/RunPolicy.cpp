@@ -0,0 +1,108 @@
+#include "RunPolicy.h"
+#include "../../spells/spell.h"
+#include <algorithm>
+#include <string.h>
+
+#define EQUIPPED_SLOTS 4
+#define DAMAGE_SLOTS 3  // The last slot goes to Meditate when it's known
+
+static int damagePower(const Spell* spell) {
+    if (spell->getPrimaryEffect() != EFFECT_DAMAGE && spell->getPrimaryEffect() != EFFECT_DAMAGE_OVER_TIME) {
+        return 0;
+    }
+    int power = spell->getBasePower();
+    if (spell->hasSecondary() && spell->getSecondaryEffect() == EFFECT_DAMAGE_OVER_TIME) {
+        power += spell->getSecondaryPower();
+    }
+    return power;
+}
+
+static int findDoor(const std::vector<DoorChoice>& choices, DoorIcon icon) {
+    for (size_t i = 0; i < choices.size(); i++) {
+        if (choices[i].icon == icon) return (int)i;
+    }
+    return 0;
+}
+
+// Strongest damage spells first, then Meditate, then whatever else is known
+void RunPolicy::equipSpells(Player* player) {
+    SpellLibrary* library = player->getSpellLibrary();
+    std::vector<const Spell*> known = library->getKnownSpells();
+    std::stable_sort(known.begin(), known.end(), [](const Spell* a, const Spell* b) {
+        return damagePower(a) > damagePower(b);
+    });
+
+    std::vector<const Spell*> loadout;
+    for (const Spell* spell : known) {
+        if ((int)loadout.size() < DAMAGE_SLOTS && damagePower(spell) > 0) loadout.push_back(spell);
+    }
+    for (const Spell* spell : known) {
+        if (spell->getHook() == SPELL_HOOK_MEDITATE) loadout.push_back(spell);
+    }
+    for (const Spell* spell : known) {
+        if ((int)loadout.size() >= EQUIPPED_SLOTS) break;
+        if (std::find(loadout.begin(), loadout.end(), spell) == loadout.end()) loadout.push_back(spell);
+    }
+
+    for (int slot = 0; slot < EQUIPPED_SLOTS; slot++) {
+        library->unequipSpell(slot);
+    }
+    for (size_t slot = 0; slot < loadout.size() && slot < EQUIPPED_SLOTS; slot++) {
+        library->equipSpell(loadout[slot]->getID(), (int)slot);
+    }
+}
+
+//============================================================================
+// POLICIES
+//============================================================================
+
+class LeftDoorPolicy : public RunPolicy {
+public:
+    const char* getName() const override { return "left"; }
+    int chooseDoor(const std::vector<DoorChoice>& choices, Player* player, int floor) override {
+        return 0;
+    }
+    void equipSpells(Player* player) override {}
+};
+
+class RandomRunPolicy : public RunPolicy {
+public:
+    const char* getName() const override { return "random"; }
+    int chooseDoor(const std::vector<DoorChoice>& choices, Player* player, int floor) override {
+        return random(0, (long)choices.size());
+    }
+    bool wantsPotion(Player* player) override { return random(0, 2) == 0; }
+    bool wantsRest(Player* player) override { return random(0, 2) == 0; }
+};
+
+class FighterPolicy : public RunPolicy {
+public:
+    const char* getName() const override { return "fighter"; }
+    int chooseDoor(const std::vector<DoorChoice>& choices, Player* player, int floor) override {
+        return findDoor(choices, ICON_SWORD);
+    }
+};
+
+class ExplorerPolicy : public RunPolicy {
+public:
+    const char* getName() const override { return "explorer"; }
+    int chooseDoor(const std::vector<DoorChoice>& choices, Player* player, int floor) override {
+        return findDoor(choices, ICON_QUESTION);
+    }
+};
+
+//============================================================================
+// REGISTRY
+//============================================================================
+
+RunPolicy* RunPolicy::create(const char* name) {
+    if (strcmp(name, "left") == 0) return new LeftDoorPolicy();
+    if (strcmp(name, "random") == 0) return new RandomRunPolicy();
+    if (strcmp(name, "fighter") == 0) return new FighterPolicy();
+    if (strcmp(name, "explorer") == 0) return new ExplorerPolicy();
+    return nullptr;
+}
+
+const char* RunPolicy::listNames() {
+    return "left, random, fighter, explorer";
+}
@@ -0,0 +1,35 @@
+#ifndef RUN_POLICY_H
+#define RUN_POLICY_H
+
+#include "../../dungeon/Floor.h"
+#include "../../entities/player.h"
+#include <vector>
+
+// Host simulators only: the out-of-combat decisions of a dungeon run. Door
+// choices only see the icons, like the player does on screen; combat turns
+// are left to a CombatPolicy.
+//
+//   left     - always the left door, keeps the starting spells, rests
+//   random   - any door, random shop and rest decisions
+//   fighter  - prefers sword doors, equips the strongest spells, rests
+//   explorer - prefers "?" doors, equips the strongest spells, rests
+class RunPolicy {
+public:
+    virtual ~RunPolicy() {}
+
+    virtual const char* getName() const = 0;
+    // Index into choices
+    virtual int chooseDoor(const std::vector<DoorChoice>& choices, Player* player, int floor) = 0;
+    // Asked again after every purchase until it says no or gold runs out
+    virtual bool wantsPotion(Player* player) { return false; }
+    // Library, after the scrolls are read
+    virtual bool wantsRest(Player* player) { return true; }
+    virtual void equipSpells(Player* player);
+
+    // nullptr for an unknown name
+    static RunPolicy* create(const char* name);
+    // Comma separated, for usage messages
+    static const char* listNames();
+};
+
+#endif
@@ -0,0 +1,132 @@
+// Spell synergy benchmark (native env only): synergy bonuses per second for
+// the original recent-cast scan (a vector of the last three spells, trimmed
+// from the front, walked through a switch per element) versus CastHistory
+// and the element synergy matrix, plus a check that both give the same bonus
+// on every cast.
+//
+//   pio run -e synergy_bench && .pio/build/synergy_bench/program [--casts N] [--seed S]
+//
+// Each step scores one cast against the history and then records it, as
+// SpellLibrary::castSpell does. Times are host CPU time.
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+#include "../spells/spell.h"
+#include "../utils/Rng.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define LEGACY_MAX_RECENT 3
+
+// Spell::calculateSynergyBonus before the matrix
+static int legacySynergyBonus(const Spell* spell, const std::vector<const Spell*>& recentSpells) {
+    int bonus = 0;
+    for (const Spell* recentSpell : recentSpells) {
+        if (!recentSpell) continue;
+        if (recentSpell->getElement() == spell->getElement()) {
+            bonus += 5;
+        }
+        ElementType recent = recentSpell->getElement();
+        switch (spell->getElement()) {
+            case ELEMENT_FIRE:
+                if (recent == ELEMENT_ICE) bonus += 8;
+                if (recent == ELEMENT_EARTH) bonus += 6;
+                break;
+            case ELEMENT_ICE:
+                if (recent == ELEMENT_FIRE) bonus += 8;
+                if (recent == ELEMENT_LIGHTNING) bonus += 7;
+                break;
+            case ELEMENT_LIGHTNING:
+                if (recent == ELEMENT_ICE) bonus += 7;
+                if (recent == ELEMENT_ARCANE) bonus += 6;
+                break;
+            case ELEMENT_ARCANE:
+                if (recent == ELEMENT_LIGHTNING) bonus += 6;
+                if (recent == ELEMENT_SHADOW) bonus += 9;
+                break;
+            case ELEMENT_EARTH:
+                if (recent == ELEMENT_FIRE) bonus += 6;
+                if (recent == ELEMENT_SHADOW) bonus += 5;
+                break;
+            case ELEMENT_SHADOW:
+                if (recent == ELEMENT_ARCANE) bonus += 9;
+                if (recent == ELEMENT_EARTH) bonus += 5;
+                break;
+        }
+    }
+    return bonus;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int casts = 10000000;
+    uint32_t seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--casts") == 0 && i + 1 < argc) {
+            casts = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--casts N] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+    HostRuntime::setQuiet(true);
+
+    // The cast sequence is rolled up front so neither timing includes the RNG.
+    // Hook spells score through their hook, not the matrix, so they're left out.
+    std::vector<const Spell*> pool;
+    for (int i = 0; i < SpellFactory::getSpellCount(); i++) {
+        const Spell* spell = SpellFactory::getSpellAt(i);
+        if (spell->getHook() == SPELL_HOOK_NONE) pool.push_back(spell);
+    }
+    Rng rng;
+    rng.seed(seed, 0);
+    std::vector<const Spell*> sequence(casts);
+    for (int i = 0; i < casts; i++) {
+        sequence[i] = pool[rng.range(0, (long)pool.size())];
+    }
+    std::vector<int> legacyBonus(casts);
+    std::vector<int> matrixBonus(casts);
+
+    std::vector<const Spell*> recentCasts;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < casts; i++) {
+        legacyBonus[i] = legacySynergyBonus(sequence[i], recentCasts);
+        recentCasts.push_back(sequence[i]);
+        while (recentCasts.size() > LEGACY_MAX_RECENT) {
+            recentCasts.erase(recentCasts.begin());
+        }
+    }
+    double legacySeconds = secondsSince(start);
+
+    CastHistory history;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < casts; i++) {
+        matrixBonus[i] = sequence[i]->calculateSynergyBonus(history);
+        history.record(sequence[i]->getElement());
+    }
+    double matrixSeconds = secondsSince(start);
+
+    int mismatches = 0;
+    long long totalBonus = 0;
+    for (int i = 0; i < casts; i++) {
+        if (legacyBonus[i] != matrixBonus[i]) mismatches++;
+        totalBonus += matrixBonus[i];
+    }
+
+    printf("synergy_bench: %d casts from %d spells, seed %lu, mean bonus %.2f\n", casts, (int)pool.size(),
+           (unsigned long)seed, casts > 0 ? (double)totalBonus / casts : 0.0);
+    printf("  vector + switch : %8.3f s  %12.0f casts/s\n", legacySeconds, casts / legacySeconds);
+    printf("  ring + matrix   : %8.3f s  %12.0f casts/s  (%.1fx)\n", matrixSeconds, casts / matrixSeconds,
+           legacySeconds / matrixSeconds);
+    printf("  bonus mismatches: %d\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+// Text rendering benchmark (native env only): glyphs/sec for the original
+// TFT_eSPI print() path versus Display's cached text-run renderer, plus a
+// pixel comparison of the two.
+//
+//   pio run -e text_bench && .pio/build/text_bench/program [--iterations N]
+//
+// Times are host CPU time for rasterizing into the back buffer; they show
+// the relative cost, not ESP32 numbers. A last check draws one unwrapped
+// run starting off the left edge (as scrolling widgets do) through both
+// paths.
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+#include "../graphics/Display.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+struct TextCase {
+    const char* text;
+    int x, y;
+    uint16_t color;
+    uint8_t size;
+};
+
+// Roughly what the combat, shop and library screens draw each update
+static const TextCase textCases[] = {
+    {"WIZARD", 10, 20, TFT_WHITE, 1},
+    {"HP: 40/40", 10, 35, TFT_WHITE, 1},
+    {"MP: 25/50", 10, 50, TFT_BLUE, 1},
+    {"DEF: 6 (+4 shield)", 10, 65, TFT_WHITE, 1},
+    {"Goblin", 100, 20, TFT_RED, 1},
+    {"AI: Aggressive", 100, 80, 0x8410, 1},
+    {"Turn: 12", 10, 180, TFT_WHITE, 1},
+    {"You cast Fireball for 14 damage!", 10, 210, TFT_WHITE, 1},
+    {"Goblin attacks you for 3 damage.", 10, 222, TFT_YELLOW, 1},
+    {"SHOP", 55, 10, TFT_YELLOW, 2},
+    {"Gold: 120", 10, 40, TFT_YELLOW, 1},
+    {"> Health Potion   25g", 5, 70, TFT_GREEN, 1},
+    {"  Mana Potion     30g", 5, 85, TFT_WHITE, 1},
+    {"LIBRARY", 30, 10, TFT_CYAN, 2},
+    {"Ready your", 30, 80, TFT_WHITE, 2},
+    {"VICTORY!", 25, 60, TFT_GREEN, 3},
+    {"Line one\nLine two wraps around the right edge", 4, 290, TFT_WHITE, 1},
+};
+static const int TEXT_CASE_COUNT = sizeof(textCases) / sizeof(textCases[0]);
+
+static uint64_t countGlyphs() {
+    uint64_t glyphs = 0;
+    for (int i = 0; i < TEXT_CASE_COUNT; i++) {
+        for (const char* c = textCases[i].text; *c; c++) {
+            if (*c != '\n' && *c != '\r') glyphs++;
+        }
+    }
+    return glyphs;
+}
+
+static void drawPass(Display& display) {
+    for (int i = 0; i < TEXT_CASE_COUNT; i++) {
+        const TextCase& t = textCases[i];
+        display.drawText(t.text, t.x, t.y, t.color, t.size);
+    }
+}
+
+// drawTextRun doesn't wrap: this run from x = -5 is clipped at both edges,
+// a part glyph at each end. TFT_eSPI wraps the glyph that would cross the
+// right edge instead, so only the columns before the last can be compared.
+#define CLIPPED_RUN_TEXT "Scrolled off the left edge and on past the right one"
+#define CLIPPED_RUN_X    -5
+#define CLIPPED_RUN_Y    240
+
+static int checkClippedRun(Display& display, const uint16_t* panel) {
+    std::vector<uint16_t> reference[2];
+    for (int pass = 0; pass < 2; pass++) {
+        display.clear();
+        display.setTextRunsEnabled(pass == 1);
+        display.drawTextRun(CLIPPED_RUN_TEXT, CLIPPED_RUN_X, CLIPPED_RUN_Y, TFT_WHITE, TFT_BLACK, 1);
+        display.flush();
+        reference[pass].assign(panel, panel + Display::WIDTH * Display::HEIGHT);
+    }
+    
+    int mismatches = 0;
+    for (int y = CLIPPED_RUN_Y; y < CLIPPED_RUN_Y + GLYPH_CELL_HEIGHT; y++) {
+        for (int x = 0; x < Display::WIDTH - 1; x++) {
+            if (reference[0][y * Display::WIDTH + x] != reference[1][y * Display::WIDTH + x]) mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int iterations = 20000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+    HostRuntime::setQuiet(true);
+
+    Display display;
+    display.init();
+    const uint16_t* panel = display.getTFT().hostPixels();
+    uint64_t glyphsPerPass = countGlyphs();
+
+    // Original path first; keep its output as the reference image
+    display.setTextRunsEnabled(false);
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < iterations; pass++) {
+        drawPass(display);
+    }
+    double legacySeconds = secondsSince(start);
+    display.flush();
+    std::vector<uint16_t> reference(panel, panel + Display::WIDTH * Display::HEIGHT);
+
+    display.clear();
+    display.flush();
+    display.setTextRunsEnabled(true);
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < iterations; pass++) {
+        drawPass(display);
+    }
+    double runSeconds = secondsSince(start);
+    display.flush();
+
+    int mismatches = 0;
+    for (int i = 0; i < Display::WIDTH * Display::HEIGHT; i++) {
+        if (panel[i] != reference[i]) mismatches++;
+    }
+    int clippedMismatches = checkClippedRun(display, panel);
+
+    double totalGlyphs = (double)glyphsPerPass * iterations;
+    GlyphCache& cache = display.getGlyphCache();
+    printf("text_bench: %d strings, %llu glyphs per pass, %d passes\n",
+           TEXT_CASE_COUNT, (unsigned long long)glyphsPerPass, iterations);
+    printf("  TFT_eSPI print  : %8.3f s  %12.0f glyphs/s\n", legacySeconds, totalGlyphs / legacySeconds);
+    printf("  text runs       : %8.3f s  %12.0f glyphs/s  (%.1fx)\n",
+           runSeconds, totalGlyphs / runSeconds, legacySeconds / runSeconds);
+    printf("  style cache     : %u hits, %u misses\n", cache.getHits(), cache.getMisses());
+    printf("  pixel mismatches: %d\n", mismatches);
+    printf("  clipped run     : %d mismatches\n", clippedMismatches);
+    return (mismatches == 0 && clippedMismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+// Trace decoder (native env only): turns a serial capture containing a
+// Trace::dump() block into Chrome trace-event JSON.
+//
+//   pio run -e trace_decode
+//   .pio/build/trace_decode/program capture.log > trace.json
+//
+// Open the result in chrome://tracing or ui.perfetto.dev. The capture may
+// hold other output around the dump; the last complete dump is used.
+
+#include "../debug/Trace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(TraceRecord) == 20, "dump format expects 20-byte records");
+
+struct ArgNames {
+    const char* event;
+    const char* begin[TRACE_MAX_ARGS];
+    const char* result;     // Single arg on the end record
+};
+
+// Matches the arg comments on TraceEvent; unknown events get arg0..arg2
+static const ArgNames argNames[] = {
+    {"state_change", {"from", "to", nullptr}, nullptr},
+    {"combat_turn", {"turn", "action", nullptr}, "result"},
+    {"spell_cast", {"spell", nullptr, nullptr}, "synergy"},
+    {"door_choices", {"floor", "rooms_completed", nullptr}, "choices"},
+    {"display_flush", {"rects", nullptr, nullptr}, "bytes"},
+};
+
+static const ArgNames* findArgNames(const std::string& event) {
+    for (const ArgNames& names : argNames) {
+        if (event == names.event) return &names;
+    }
+    return nullptr;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool parseRecord(const char* hex, TraceRecord& record) {
+    uint8_t bytes[sizeof(TraceRecord)];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        int high = hexValue(hex[i * 2]);
+        int low = high < 0 ? -1 : hexValue(hex[i * 2 + 1]);
+        if (low < 0) return false;
+        bytes[i] = (uint8_t)(high << 4 | low);
+    }
+    // ESP32 and the host are both little endian
+    memcpy(&record, bytes, sizeof(record));
+    return true;
+}
+
+struct Dump {
+    std::vector<std::string> eventNames;
+    std::vector<TraceRecord> records;
+    unsigned long recorded = 0;
+};
+
+// Reads the last complete dump; false if there is none
+static bool readDump(FILE* in, Dump& dump) {
+    char line[256];
+    Dump current;
+    bool inside = false;
+    bool found = false;
+
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        // Serial monitors may prefix lines (timestamps); search, don't anchor
+        const char* begin = strstr(line, TRACE_DUMP_BEGIN);
+        if (begin) {
+            current = Dump();
+            const char* recorded = strstr(begin, "recorded=");
+            if (recorded) current.recorded = strtoul(recorded + 9, nullptr, 10);
+            inside = true;
+            continue;
+        }
+        if (!inside) continue;
+
+        if (strstr(line, TRACE_DUMP_END)) {
+            dump = current;
+            inside = false;
+            found = true;
+        } else if (line[0] == 'N' && line[1] == ' ') {
+            char* rest = nullptr;
+            long id = strtol(line + 2, &rest, 10);
+            if (id >= 0 && rest && *rest == ' ') {
+                if ((size_t)id >= current.eventNames.size()) current.eventNames.resize(id + 1);
+                current.eventNames[id] = rest + 1;
+            }
+        } else if (line[0] == 'T' && line[1] == ' ' && strlen(line + 2) >= sizeof(TraceRecord) * 2) {
+            TraceRecord record;
+            if (parseRecord(line + 2, record)) current.records.push_back(record);
+        }
+    }
+    return found;
+}
+
+static void printArgs(FILE* out, const TraceRecord& record, const ArgNames* names) {
+    fprintf(out, ",\"args\":{");
+    for (int i = 0; i < record.argCount && i < TRACE_MAX_ARGS; i++) {
+        const char* name = nullptr;
+        bool isEnd = record.phase == TRACE_PHASE_END || record.phase == TRACE_PHASE_ASYNC_END;
+        if (names) name = isEnd ? names->result : names->begin[i];
+        if (name) {
+            fprintf(out, "%s\"%s\":%ld", i ? "," : "", name, (long)record.args[i]);
+        } else {
+            fprintf(out, "%s\"arg%d\":%ld", i ? "," : "", i, (long)record.args[i]);
+        }
+    }
+    fprintf(out, "}");
+}
+
+static void writeJson(FILE* out, const Dump& dump) {
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"dungeon-rush\"}}");
+
+    // micros() wraps every ~71 minutes; rebuild a 64-bit timeline from deltas
+    uint64_t time = 0;
+    uint32_t lastUs = dump.records.empty() ? 0 : dump.records[0].timeUs;
+
+    // Ends whose begin was overwritten by the ring would confuse the viewer
+    std::vector<int> depth(256, 0);
+
+    for (const TraceRecord& record : dump.records) {
+        time += (uint32_t)(record.timeUs - lastUs);
+        lastUs = record.timeUs;
+
+        if (record.phase == TRACE_PHASE_BEGIN) {
+            depth[record.core]++;
+        } else if (record.phase == TRACE_PHASE_END) {
+            if (depth[record.core] == 0) continue;
+            depth[record.core]--;
+        }
+
+        std::string name = record.event < dump.eventNames.size() && !dump.eventNames[record.event].empty()
+            ? dump.eventNames[record.event]
+            : "event" + std::to_string(record.event);
+
+        fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"game\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":0,\"tid\":%u",
+                name.c_str(), (char)record.phase, (unsigned long long)time, record.core);
+        if (record.phase == TRACE_PHASE_INSTANT) {
+            fprintf(out, ",\"s\":\"t\"");
+        } else if (record.phase == TRACE_PHASE_ASYNC_BEGIN || record.phase == TRACE_PHASE_ASYNC_END) {
+            fprintf(out, ",\"id\":%u", record.event);
+        }
+        printArgs(out, record, findArgNames(name));
+        fprintf(out, "}");
+    }
+    fprintf(out, "\n]}\n");
+}
+
+int main(int argc, char** argv) {
+    FILE* in = stdin;
+    if (argc > 1 && strcmp(argv[1], "-") != 0) {
+        in = fopen(argv[1], "r");
+        if (!in) {
+            fprintf(stderr, "trace_decode: can't open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    Dump dump;
+    bool found = readDump(in, dump);
+    if (in != stdin) fclose(in);
+    if (!found) {
+        fprintf(stderr, "trace_decode: no complete trace dump in input\n");
+        return 1;
+    }
+
+    writeJson(stdout, dump);
+    fprintf(stderr, "trace_decode: %lu records (%lu recorded, %lu lost to wraparound)\n",
+            (unsigned long)dump.records.size(), dump.recorded,
+            dump.recorded > dump.records.size() ? dump.recorded - (unsigned long)dump.records.size() : 0UL);
+    return 0;
+}
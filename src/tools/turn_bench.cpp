@@ -0,0 +1,179 @@
+// Turn scheduler benchmark (native env only): rounds per second through
+// TurnQueue for 1v1 up to 1v8 encounters, against a plain scan of an
+// unsorted array that picks the next actor each time, plus a check that
+// both pick the same actors in the same order.
+//
+//   pio run -e turn_bench && .pio/build/turn_bench/program [--rounds N] [--seed S]
+//
+// Every round schedules the player and each enemy with a random priority
+// and speed and takes the first actor. Then, like a FrostBolt landing and a
+// summoner acting, it slows one combatant by 3 (if it hasn't acted yet)
+// and, when there's room, schedules a summon. The rest of the round is
+// drained. Times are host CPU time.
+
+#include <Arduino.h>
+#include "../combat/turn_queue.h"
+#include "../utils/Rng.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define MAX_ENEMIES      8
+#define SPEED_DEBUFF     3
+#define SUMMON_ID        (MAX_COMBATANTS - 1)
+
+// One round's rolls, made up front so neither timing includes the RNG
+struct RoundPlan {
+    uint8_t priority[MAX_COMBATANTS];
+    int16_t speed[MAX_COMBATANTS];
+    uint8_t slowed;             // Combatant hit by the debuff
+    bool summon;
+};
+
+// The reference: an unsorted array, scanned for the next actor each time,
+// comparing the fields one by one rather than through the packed key
+class ScanQueue {
+private:
+    TurnEntry entries[MAX_COMBATANTS];
+    int count;
+    int scheduled;
+
+    static bool goesBefore(const TurnEntry& a, const TurnEntry& b) {
+        if (a.priority != b.priority) return a.priority < b.priority;
+        if (a.speed != b.speed) return a.speed > b.speed;
+        return a.order < b.order;
+    }
+
+    int find(int combatant) const {
+        for (int i = 0; i < count; i++) {
+            if (entries[i].combatant == combatant) return i;
+        }
+        return -1;
+    }
+
+public:
+    void clear() {
+        count = 0;
+        scheduled = 0;
+    }
+    int size() const { return count; }
+    bool schedule(int combatant, ActionPriority priority, int speed) {
+        if (count == MAX_COMBATANTS) return false;
+        TurnEntry& entry = entries[count++];
+        entry.combatant = (uint8_t)combatant;
+        entry.priority = (uint8_t)priority;
+        entry.order = (uint8_t)scheduled++;
+        entry.speed = (int16_t)speed;
+        return true;
+    }
+    TurnEntry next() {
+        int best = 0;
+        for (int i = 1; i < count; i++) {
+            if (goesBefore(entries[i], entries[best])) best = i;
+        }
+        TurnEntry first = entries[best];
+        entries[best] = entries[--count];
+        return first;
+    }
+    bool setSpeed(int combatant, int speed) {
+        int index = find(combatant);
+        if (index < 0) return false;
+        entries[index].speed = (int16_t)speed;
+        return true;
+    }
+};
+
+// One round; writes the actors in the order they acted
+template <typename Queue>
+static void runRound(Queue& queue, const RoundPlan& plan, int combatants, uint8_t* order) {
+    queue.clear();
+    for (int c = 0; c < combatants; c++) {
+        queue.schedule(c, (ActionPriority)plan.priority[c], plan.speed[c]);
+    }
+
+    int taken = 0;
+    order[taken++] = queue.next().combatant;
+
+    // No effect if the slowed combatant already acted
+    int slowed = plan.slowed % combatants;
+    queue.setSpeed(slowed, plan.speed[slowed] - SPEED_DEBUFF);
+    if (plan.summon && combatants < MAX_COMBATANTS) {
+        queue.schedule(SUMMON_ID, PRIORITY_ATTACK, plan.speed[SUMMON_ID]);
+    }
+
+    while (queue.size() > 0) {
+        order[taken++] = queue.next().combatant;
+    }
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int rounds = 1000000;
+    uint32_t seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            rounds = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--rounds N] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    Rng rng;
+    rng.seed(seed, 0);
+    std::vector<RoundPlan> plans(rounds);
+    for (RoundPlan& plan : plans) {
+        for (int c = 0; c < MAX_COMBATANTS; c++) {
+            // Mostly attacks, like the game's enemies; speeds 1-20 so ties happen
+            plan.priority[c] = rng.range(0, 4) == 0 ? PRIORITY_DEFEND : PRIORITY_ATTACK;
+            plan.speed[c] = (int16_t)rng.range(1, 21);
+        }
+        plan.slowed = (uint8_t)rng.range(0, MAX_COMBATANTS);
+        plan.summon = rng.range(0, 4) == 0;
+    }
+
+    printf("turn_bench: %d rounds per encounter, seed %lu\n", rounds, (unsigned long)seed);
+    printf("  %-5s %12s %12s %7s %10s\n", "size", "queue r/s", "scan r/s", "ratio", "mismatches");
+
+    int totalMismatches = 0;
+    std::vector<uint8_t> queueOrder((size_t)rounds * MAX_COMBATANTS);
+    std::vector<uint8_t> scanOrder((size_t)rounds * MAX_COMBATANTS);
+    for (int enemies = 1; enemies <= MAX_ENEMIES; enemies++) {
+        int combatants = enemies + 1;
+        TurnQueue queue;
+        ScanQueue scan;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            runRound(queue, plans[r], combatants, &queueOrder[(size_t)r * MAX_COMBATANTS]);
+        }
+        double queueSeconds = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            runRound(scan, plans[r], combatants, &scanOrder[(size_t)r * MAX_COMBATANTS]);
+        }
+        double scanSeconds = secondsSince(start);
+
+        int mismatches = 0;
+        for (int r = 0; r < rounds; r++) {
+            if (memcmp(&queueOrder[(size_t)r * MAX_COMBATANTS], &scanOrder[(size_t)r * MAX_COMBATANTS],
+                       MAX_COMBATANTS) != 0) {
+                mismatches++;
+            }
+        }
+        totalMismatches += mismatches;
+
+        printf("  1v%-3d %12.0f %12.0f %6.2fx %10d\n", enemies, rounds / queueSeconds, rounds / scanSeconds,
+               scanSeconds / queueSeconds, mismatches);
+    }
+    return totalMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,626 @@
+#include "Widgets.h"
+#include "../debug/Log.h"
+
+static const DirtyRect EMPTY_RECT = {0, 0, 0, 0};
+
+static bool rectEmpty(const DirtyRect& r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+static bool rectsOverlap(const DirtyRect& a, const DirtyRect& b) {
+    if (rectEmpty(a) || rectEmpty(b)) return false;
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static bool rectContains(const DirtyRect& outer, const DirtyRect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.w <= outer.x + outer.w && inner.y + inner.h <= outer.y + outer.h;
+}
+
+static bool rectsEqual(const DirtyRect& a, const DirtyRect& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+static DirtyRect rectUnion(const DirtyRect& a, const DirtyRect& b) {
+    if (rectEmpty(a)) return b;
+    if (rectEmpty(b)) return a;
+    int left = min(a.x, b.x);
+    int top = min(a.y, b.y);
+    int right = max(a.x + a.w, b.x + b.w);
+    int bottom = max(a.y + a.h, b.y + b.h);
+    return {left, top, right - left, bottom - top};
+}
+
+//============================================================================
+// WIDGET
+//============================================================================
+
+Widget::Widget(int x, int y, int w, int h) {
+    bounds = {x, y, w, h};
+    drawnBounds = EMPTY_RECT;
+    visible = true;
+    dirty = true;
+    drawn = false;
+    repaintOnly = false;
+    erasedArea = EMPTY_RECT;
+    paintedArea = EMPTY_RECT;
+}
+
+void Widget::setBounds(int x, int y, int w, int h) {
+    DirtyRect next = {x, y, w, h};
+    if (!rectsEqual(bounds, next)) {
+        bounds = next;
+        dirty = true;
+    }
+}
+
+void Widget::moveTo(int x, int y) {
+    setBounds(x, y, bounds.w, bounds.h);
+}
+
+void Widget::setVisible(bool show) {
+    if (visible != show) {
+        visible = show;
+        dirty = true;
+    }
+}
+
+DirtyRect Widget::render(Display* display, uint16_t background) {
+    erasedArea = EMPTY_RECT;
+    paintedArea = EMPTY_RECT;
+    if (!dirty) return EMPTY_RECT;
+    dirty = false;
+
+    bool willDraw = visible && !rectEmpty(bounds);
+
+    // Old pixels only need erasing if the new paint won't cover them
+    bool covered = willDraw && coversBounds(background) && rectContains(bounds, drawnBounds);
+    bool keepOld = repaintOnly && rectsEqual(bounds, drawnBounds);
+    if (drawn && !covered && !keepOld) {
+        erasedArea = drawnBounds;
+        erase(display, background);
+    }
+    repaintOnly = false;
+    drawn = false;
+
+    if (willDraw) {
+        draw(display, background);
+        drawnBounds = bounds;
+        drawn = true;
+        paintedArea = bounds;
+    }
+    return rectUnion(erasedArea, paintedArea);
+}
+
+void Widget::erase(Display* display, uint16_t background) {
+    if (drawn) {
+        display->fillRect(drawnBounds.x, drawnBounds.y, drawnBounds.w, drawnBounds.h, background);
+        drawn = false;
+    }
+}
+
+void Widget::forget() {
+    drawn = false;
+    dirty = true;
+}
+
+void Widget::requestRepaintOnly() {
+    // Only when nothing else is pending; real changes still erase
+    if (!needsRender()) {
+        dirty = true;
+        repaintOnly = true;
+    }
+}
+
+//============================================================================
+// PANEL
+//============================================================================
+
+Panel* Panel::screenOwner = nullptr;
+
+Panel::Panel(int x, int y, int w, int h, uint16_t backgroundColor) : Widget(x, y, w, h) {
+    childCount = 0;
+    background = backgroundColor;
+    borderColor = TFT_WHITE;
+    hasBorder = false;
+    filled = false;
+    shown = false;
+    drawnAtClear = 0;
+}
+
+void Panel::add(Widget* child) {
+    if (childCount >= MAX_PANEL_CHILDREN) {
+        LOG_INFO(UI, "Panel: too many children, widget ignored");
+        return;
+    }
+    children[childCount++] = child;
+}
+
+void Panel::setFilled(bool fill) {
+    if (filled != fill) {
+        filled = fill;
+        dirty = true;
+    }
+}
+
+void Panel::setBorder(uint16_t color) {
+    if (!hasBorder || borderColor != color) {
+        hasBorder = true;
+        borderColor = color;
+        dirty = true;
+    }
+}
+
+void Panel::clearBorder() {
+    if (hasBorder) {
+        hasBorder = false;
+        dirty = true;
+    }
+}
+
+void Panel::setBackground(uint16_t color) {
+    if (background != color) {
+        background = color;
+        dirty = true;
+    }
+}
+
+void Panel::invalidate() {
+    dirty = true;
+}
+
+bool Panel::needsRender() const {
+    if (dirty) return true;
+    for (int i = 0; i < childCount; i++) {
+        if (children[i]->needsRender()) return true;
+    }
+    return false;
+}
+
+void Panel::draw(Display* display, uint16_t parentBackground) {
+    if (filled) {
+        display->fillRect(bounds.x, bounds.y, bounds.w, bounds.h, background);
+    }
+    if (hasBorder) {
+        display->drawRect(bounds.x, bounds.y, bounds.w, bounds.h, borderColor);
+    }
+}
+
+DirtyRect Panel::render(Display* display, uint16_t parentBackground) {
+    erasedArea = EMPTY_RECT;
+    paintedArea = EMPTY_RECT;
+
+    if (dirty) {
+        dirty = false;
+
+        // Moving or hiding: clear the old footprint first
+        if (drawn && (!visible || !rectsEqual(bounds, drawnBounds))) {
+            erasedArea = drawnBounds;
+            erase(display, parentBackground);
+        }
+        if (!visible) {
+            repaintOnly = false;
+            return erasedArea;
+        }
+
+        draw(display, parentBackground);
+        for (int i = 0; i < childCount; i++) {
+            if (filled) {
+                children[i]->forget();  // Background fill wiped them
+            } else if (repaintOnly) {
+                children[i]->requestRepaintOnly();
+            } else {
+                children[i]->invalidate();
+            }
+        }
+        repaintOnly = false;
+        drawn = true;
+        drawnBounds = bounds;
+        if (filled || hasBorder) {
+            paintedArea = bounds;
+        }
+    }
+
+    if (!visible) return erasedArea;
+
+    for (int i = 0; i < childCount; i++) {
+        Widget* child = children[i];
+        if (!child->needsRender()) continue;
+
+        child->render(display, background);
+        const DirtyRect& erased = child->lastErased();
+        const DirtyRect& painted = child->lastPainted();
+        paintedArea = rectUnion(paintedArea, painted);
+        if (!filled) {
+            erasedArea = rectUnion(erasedArea, erased);  // Parent background shows through
+        } else {
+            paintedArea = rectUnion(paintedArea, erased);
+        }
+
+        // Later siblings that overlap go back on top
+        for (int j = i + 1; j < childCount; j++) {
+            const DirtyRect& other = children[j]->getBounds();
+            if (children[j]->isVisible() && (rectsOverlap(other, painted) || rectsOverlap(other, erased))) {
+                children[j]->requestRepaintOnly();
+            }
+        }
+
+        // Erasing may have cut into earlier siblings: redraw those and carry
+        // on from the first of them
+        if (!rectEmpty(erased)) {
+            int restart = i + 1;
+            for (int j = 0; j < i; j++) {
+                if (children[j]->isVisible() && rectsOverlap(children[j]->getBounds(), erased)) {
+                    children[j]->requestRepaintOnly();
+                    restart = min(restart, j);
+                }
+            }
+            i = restart - 1;
+        }
+    }
+    return rectUnion(erasedArea, paintedArea);
+}
+
+DirtyRect Panel::render(Display* display) {
+    if (drawnAtClear != display->getClearCount()) {
+        forget();  // Screen was wiped since we last drew
+    }
+    DirtyRect touched = render(display, background);
+    drawnAtClear = display->getClearCount();
+    return touched;
+}
+
+void Panel::erase(Display* display, uint16_t parentBackground) {
+    if (!drawn) return;
+
+    if (filled || hasBorder) {
+        display->fillRect(drawnBounds.x, drawnBounds.y, drawnBounds.w, drawnBounds.h, parentBackground);
+        for (int i = 0; i < childCount; i++) {
+            children[i]->forget();
+        }
+    } else {
+        for (int i = 0; i < childCount; i++) {
+            children[i]->erase(display, parentBackground);
+            children[i]->forget();
+        }
+    }
+    drawn = false;
+}
+
+void Panel::forget() {
+    Widget::forget();
+    for (int i = 0; i < childCount; i++) {
+        children[i]->forget();
+    }
+}
+
+void Panel::show(Display* display) {
+    uint32_t clears = display->getClearCount();
+    bool onScreen = (screenOwner == this && shown && drawnAtClear == clears);
+
+    if (!onScreen) {
+        // Take over from the previous screen: erase only its widgets if it
+        // is still intact, otherwise we don't know what's there
+        if (screenOwner != nullptr && screenOwner != this &&
+            screenOwner->shown && screenOwner->drawnAtClear == clears) {
+            screenOwner->hide(display);
+        } else {
+            if (screenOwner != nullptr) {
+                screenOwner->shown = false;
+                screenOwner->forget();
+            }
+            display->clear();
+        }
+        forget();
+        screenOwner = this;
+        shown = true;
+    }
+
+    render(display);
+}
+
+void Panel::hide(Display* display) {
+    if (shown && drawnAtClear == display->getClearCount()) {
+        erase(display, background);
+    }
+    forget();
+    shown = false;
+    if (screenOwner == this) {
+        screenOwner = nullptr;
+    }
+}
+
+//============================================================================
+// LABEL / CURSOR
+//============================================================================
+
+Label::Label(int x, int y, const char* labelText, uint16_t textColor, uint8_t textSize)
+    : Widget(x, y, 0, 0) {
+    text = labelText;
+    color = textColor;
+    size = textSize;
+    updateBounds();
+}
+
+void Label::updateBounds() {
+    setBounds(bounds.x, bounds.y, text.length() * GLYPH_CELL_WIDTH * size, GLYPH_CELL_HEIGHT * size);
+}
+
+void Label::setText(const char* labelText) {
+    if (text != labelText) {
+        text = labelText;
+        dirty = true;
+        updateBounds();
+    }
+}
+
+void Label::setColor(uint16_t textColor) {
+    if (color != textColor) {
+        color = textColor;
+        dirty = true;
+    }
+}
+
+void Label::setSize(uint8_t textSize) {
+    if (size != textSize) {
+        size = textSize;
+        dirty = true;
+        updateBounds();
+    }
+}
+
+void Label::draw(Display* display, uint16_t background) {
+    display->drawTextRun(text.c_str(), bounds.x, bounds.y, color, background, size);
+}
+
+Cursor::Cursor(const char* glyph, uint16_t glyphColor, uint8_t glyphSize)
+    : Label(0, 0, glyph, glyphColor, glyphSize) {
+    stopCount = 0;
+    selected = -1;
+    visible = false;
+}
+
+void Cursor::setStop(int index, int x, int y) {
+    if (index < 0 || index >= MAX_CURSOR_STOPS) return;
+    stopX[index] = x;
+    stopY[index] = y;
+    if (index >= stopCount) stopCount = index + 1;
+    if (index == selected) moveTo(x, y);
+}
+
+void Cursor::setStopCount(int count) {
+    stopCount = constrain(count, 0, MAX_CURSOR_STOPS);
+    if (selected >= stopCount) select(selected);
+}
+
+void Cursor::select(int index) {
+    selected = index;
+    if (index >= 0 && index < stopCount) {
+        moveTo(stopX[index], stopY[index]);
+        setVisible(true);
+    } else {
+        setVisible(false);
+    }
+}
+
+//============================================================================
+// LIST
+//============================================================================
+
+ListWidget::ListWidget(int x, int y, int itemStepX, int itemStepY, uint8_t textSize)
+    : Widget(x, y, 0, 0) {
+    originX = x;
+    originY = y;
+    stepX = itemStepX;
+    stepY = itemStepY;
+    size = textSize;
+    count = 0;
+    selected = -1;
+    boxHighlight = false;
+    boxW = boxH = 0;
+    boxColor = TFT_WHITE;
+    boxTextColor = TFT_BLACK;
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        colors[i] = TFT_WHITE;
+        itemDirty[i] = false;
+        itemDrawn[i] = false;
+        itemDrawnRects[i] = EMPTY_RECT;
+    }
+}
+
+DirtyRect ListWidget::itemRect(int index) const {
+    if (boxHighlight) {
+        return {itemX(index) - 2, itemY(index) - 2, boxW, boxH};
+    }
+    return {itemX(index), itemY(index),
+            (int)items[index].length() * GLYPH_CELL_WIDTH * size, GLYPH_CELL_HEIGHT * size};
+}
+
+void ListWidget::updateBounds() {
+    DirtyRect area = {originX, originY, 0, 0};
+    for (int i = 0; i < count; i++) {
+        area = rectUnion(area, itemRect(i));
+    }
+    bounds = area;
+}
+
+void ListWidget::setCount(int itemCount) {
+    itemCount = constrain(itemCount, 0, MAX_LIST_ITEMS);
+    if (itemCount == count) return;
+    for (int i = min(count, itemCount); i < max(count, itemCount); i++) {
+        itemDirty[i] = true;
+    }
+    count = itemCount;
+    updateBounds();
+}
+
+void ListWidget::setItem(int index, const char* text, uint16_t color) {
+    if (index < 0 || index >= MAX_LIST_ITEMS) return;
+    if (index >= count) setCount(index + 1);
+    if (items[index] != text || colors[index] != color) {
+        items[index] = text;
+        colors[index] = color;
+        itemDirty[index] = true;
+        updateBounds();
+    }
+}
+
+void ListWidget::setHighlightBox(int w, int h, uint16_t color, uint16_t textColor) {
+    boxHighlight = true;
+    boxW = w;
+    boxH = h;
+    boxColor = color;
+    boxTextColor = textColor;
+    updateBounds();
+    dirty = true;
+}
+
+void ListWidget::select(int index) {
+    if (index == selected) return;
+    if (boxHighlight) {
+        if (selected >= 0 && selected < MAX_LIST_ITEMS) itemDirty[selected] = true;
+        if (index >= 0 && index < MAX_LIST_ITEMS) itemDirty[index] = true;
+    }
+    selected = index;
+}
+
+void ListWidget::layoutCursor(Cursor& cursor, int offsetX, int offsetY) const {
+    cursor.setStopCount(count);
+    for (int i = 0; i < count; i++) {
+        cursor.setStop(i, itemX(i) + offsetX, itemY(i) + offsetY);
+    }
+}
+
+void ListWidget::drawItem(Display* display, int index, uint16_t background) {
+    if (!boxHighlight) {
+        display->drawTextRun(items[index].c_str(), itemX(index), itemY(index), colors[index], background, size);
+        return;
+    }
+
+    // The box is always painted so items can swap highlight in place
+    DirtyRect box = itemRect(index);
+    bool highlighted = (index == selected);
+    uint16_t fill = highlighted ? boxColor : background;
+    display->fillRect(box.x, box.y, box.w, box.h, fill);
+    display->drawTextRun(items[index].c_str(), itemX(index), itemY(index),
+                         highlighted ? boxTextColor : colors[index], fill, size);
+}
+
+void ListWidget::draw(Display* display, uint16_t background) {
+    for (int i = 0; i < count; i++) {
+        drawItem(display, i, background);
+    }
+}
+
+void ListWidget::invalidate() {
+    dirty = true;
+}
+
+bool ListWidget::needsRender() const {
+    if (dirty) return true;
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        if (itemDirty[i]) return true;
+    }
+    return false;
+}
+
+DirtyRect ListWidget::render(Display* display, uint16_t background) {
+    erasedArea = EMPTY_RECT;
+    paintedArea = EMPTY_RECT;
+
+    if (dirty) {
+        dirty = false;
+        for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+            itemDirty[i] = true;
+        }
+    }
+
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        if (!itemDirty[i]) continue;
+        itemDirty[i] = false;
+
+        bool willDraw = visible && i < count;
+        DirtyRect rect = willDraw ? itemRect(i) : EMPTY_RECT;
+        bool covered = willDraw && (boxHighlight || colors[i] != background) &&
+                       rectContains(rect, itemDrawnRects[i]);
+        bool keepOld = repaintOnly && rectsEqual(rect, itemDrawnRects[i]);
+        if (itemDrawn[i] && !covered && !keepOld) {
+            const DirtyRect& old = itemDrawnRects[i];
+            display->fillRect(old.x, old.y, old.w, old.h, background);
+            erasedArea = rectUnion(erasedArea, old);
+        }
+        itemDrawn[i] = false;
+
+        if (willDraw && !rectEmpty(rect)) {
+            drawItem(display, i, background);
+            itemDrawnRects[i] = rect;
+            itemDrawn[i] = true;
+            paintedArea = rectUnion(paintedArea, rect);
+        }
+    }
+    repaintOnly = false;
+
+    drawn = false;
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        drawn = drawn || itemDrawn[i];
+    }
+    drawnBounds = bounds;
+    return rectUnion(erasedArea, paintedArea);
+}
+
+void ListWidget::erase(Display* display, uint16_t background) {
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        if (itemDrawn[i]) {
+            const DirtyRect& old = itemDrawnRects[i];
+            display->fillRect(old.x, old.y, old.w, old.h, background);
+            itemDrawn[i] = false;
+        }
+    }
+    drawn = false;
+}
+
+void ListWidget::forget() {
+    Widget::forget();
+    for (int i = 0; i < MAX_LIST_ITEMS; i++) {
+        itemDrawn[i] = false;
+    }
+}
+
+//============================================================================
+// PROGRESS BAR
+//============================================================================
+
+ProgressBar::ProgressBar(int x, int y, int w, int h, uint16_t outlineColor) : Widget(x, y, w, h) {
+    value = 0;
+    maximum = 1;
+    borderColor = outlineColor;
+    fillColor = TFT_GREEN;
+}
+
+void ProgressBar::setValue(int current, int max) {
+    if (value != current || maximum != max) {
+        value = current;
+        maximum = max;
+        dirty = true;
+    }
+}
+
+void ProgressBar::setFillColor(uint16_t color) {
+    if (fillColor != color) {
+        fillColor = color;
+        dirty = true;
+    }
+}
+
+void ProgressBar::draw(Display* display, uint16_t background) {
+    int x = bounds.x, y = bounds.y, w = bounds.w, h = bounds.h;
+    display->drawRect(x, y, w, h, borderColor);
+
+    // Filled part, then background for the rest of the inside
+    int fillW = 0;
+    if (value > 0 && maximum > 0) {
+        fillW = constrain((w * min(value, maximum)) / maximum - 2, 0, w - 2);
+        display->fillRect(x + 1, y + 1, fillW, h - 2, fillColor);
+    }
+    display->fillRect(x + 1 + fillW, y + 1, w - 2 - fillW, h - 2, background);
+}
@@ -0,0 +1,248 @@
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include "../graphics/Display.h"
+#include "../utils/FixedString.h"
+
+// Retained-mode UI: screens are built once from widgets, then the code only
+// changes widget state (text, colour, selection, value). Each render() call
+// repaints just the widgets whose state changed, erasing what they covered
+// before. Widgets sit in Panels; siblings draw in the order they were added
+// and a widget that repaints also refreshes later siblings on top of it.
+
+#define MAX_PANEL_CHILDREN 24
+#define MAX_LIST_ITEMS 8
+#define MAX_CURSOR_STOPS 8
+// Longest label or list item in characters, held inline (the screen is
+// narrower than this even at text size 1)
+#define WIDGET_TEXT_MAX 47
+
+typedef FixedString<WIDGET_TEXT_MAX + 1> WidgetText;
+
+class Widget {
+protected:
+    DirtyRect bounds;       // Where the widget draws now
+    DirtyRect drawnBounds;  // Where it was last drawn (what to erase)
+    bool visible;
+    bool dirty;
+    bool drawn;
+    bool repaintOnly;       // Redraw over the top without erasing first
+    DirtyRect erasedArea;   // What the last render() erased (w = 0 if nothing)
+    DirtyRect paintedArea;  // What the last render() drew
+
+    void setBounds(int x, int y, int w, int h);
+
+    // Paint the widget at bounds. The area is background unless the widget
+    // reports coversBounds(), in which case it paints every pixel itself.
+    virtual void draw(Display* display, uint16_t background) = 0;
+    virtual bool coversBounds(uint16_t background) const { return false; }
+
+public:
+    Widget(int x, int y, int w, int h);
+    virtual ~Widget() = default;
+
+    void moveTo(int x, int y);
+    void setVisible(bool show);
+    bool isVisible() const { return visible; }
+    const DirtyRect& getBounds() const { return bounds; }
+
+    // Force a repaint on the next render()
+    virtual void invalidate() { dirty = true; }
+    virtual bool needsRender() const { return dirty; }
+
+    // Repaint if needed. Returns the area touched (w = 0 if nothing).
+    virtual DirtyRect render(Display* display, uint16_t background);
+    // Fill whatever is on screen with the background
+    virtual void erase(Display* display, uint16_t background);
+    // The screen under the widget was wiped: draw fresh next time
+    virtual void forget();
+
+    // Something was painted over this widget: draw it again on top, without
+    // erasing (ignored if the widget has its own changes pending)
+    void requestRepaintOnly();
+    const DirtyRect& lastErased() const { return erasedArea; }
+    const DirtyRect& lastPainted() const { return paintedArea; }
+};
+
+// Container. A filled panel paints its background (and optional 1px border)
+// and redraws all children when it is invalidated; an unfilled one just
+// hosts children on its parent's background.
+//
+// A panel can also own the whole screen (show()/hide()). Switching from one
+// shown panel to another only erases the old panel's widgets instead of
+// clearing the screen, so a screen built with show() must draw everything
+// through widgets. If anything cleared the display in between, show()
+// falls back to a full clear. Top-level panels that only cover part of the
+// screen (e.g. a menu strip) just call render(display) every frame.
+class Panel : public Widget {
+private:
+    Widget* children[MAX_PANEL_CHILDREN];
+    int childCount;
+    uint16_t background;
+    uint16_t borderColor;
+    bool hasBorder;
+    bool filled;
+    bool shown;
+    uint32_t drawnAtClear;  // Display clear count at the last top-level render
+
+    static Panel* screenOwner;
+
+protected:
+    void draw(Display* display, uint16_t parentBackground) override;
+    bool coversBounds(uint16_t parentBackground) const override { return filled; }
+
+public:
+    Panel(int x, int y, int w, int h, uint16_t backgroundColor = TFT_BLACK);
+
+    void add(Widget* child);
+    void setFilled(bool fill);
+    void setBorder(uint16_t color);
+    void clearBorder();
+    void setBackground(uint16_t color);
+    uint16_t getBackground() const { return background; }
+
+    void invalidate() override;
+    bool needsRender() const override;
+    DirtyRect render(Display* display, uint16_t parentBackground) override;
+    // Top-level render: also notices when the display was cleared since the
+    // last one and repaints everything
+    DirtyRect render(Display* display);
+    void erase(Display* display, uint16_t parentBackground) override;
+    void forget() override;
+
+    // Whole-screen panels
+    void show(Display* display);
+    void hide(Display* display);
+    bool isShown() const { return shown; }
+};
+
+// One line of text (TFT_eSPI GLCD font). Never wraps; clipped at the edge.
+class Label : public Widget {
+protected:
+    WidgetText text;
+    uint16_t color;
+    uint8_t size;
+
+    void updateBounds();
+    void draw(Display* display, uint16_t background) override;
+    bool coversBounds(uint16_t background) const override { return color != background; }
+
+public:
+    Label(int x = 0, int y = 0, const char* labelText = "", uint16_t textColor = TFT_WHITE, uint8_t textSize = 1);
+
+    void setText(const char* labelText);
+    void setText(FlashString labelText) { setText(labelText.c_str()); }
+    template <size_t N>
+    void setText(const FixedString<N>& labelText) { setText(labelText.c_str()); }
+    void setColor(uint16_t textColor);
+    void setSize(uint8_t textSize);
+    template <typename T>
+    void set(const T& labelText, uint16_t textColor) { setText(labelText); setColor(textColor); }
+    const char* getText() const { return text.c_str(); }
+};
+
+// A glyph (">" by default) that jumps between preset stops, e.g. one per
+// menu entry. ListWidget::layoutCursor() fills the stops from its layout.
+class Cursor : public Label {
+private:
+    int stopX[MAX_CURSOR_STOPS];
+    int stopY[MAX_CURSOR_STOPS];
+    int stopCount;
+    int selected;
+
+public:
+    Cursor(const char* glyph = ">", uint16_t glyphColor = TFT_WHITE, uint8_t glyphSize = 1);
+
+    void setStop(int index, int x, int y);
+    void setStopCount(int count);
+    int getStopCount() const { return stopCount; }
+    // Jump to a stop; out-of-range hides the cursor
+    void select(int index);
+    int getSelected() const { return selected; }
+};
+
+// Evenly spaced text items (vertical, horizontal or both via stepX/stepY).
+// Only items whose text, colour or highlight changed are repainted.
+class ListWidget : public Widget {
+private:
+    WidgetText items[MAX_LIST_ITEMS];
+    uint16_t colors[MAX_LIST_ITEMS];
+    bool itemDirty[MAX_LIST_ITEMS];
+    bool itemDrawn[MAX_LIST_ITEMS];
+    DirtyRect itemDrawnRects[MAX_LIST_ITEMS];
+    int count;
+    int originX, originY;   // First item; bounds grow to cover all items
+    int stepX, stepY;
+    uint8_t size;
+
+    // Optional highlight: selected item drawn in a filled box
+    int selected;
+    bool boxHighlight;
+    int boxW, boxH;
+    uint16_t boxColor, boxTextColor;
+
+    DirtyRect itemRect(int index) const;
+    void updateBounds();
+    void drawItem(Display* display, int index, uint16_t background);
+
+protected:
+    void draw(Display* display, uint16_t background) override;
+
+public:
+    ListWidget(int x, int y, int itemStepX, int itemStepY, uint8_t textSize = 1);
+
+    void setCount(int itemCount);
+    int getCount() const { return count; }
+    void setItem(int index, const char* text, uint16_t color = TFT_WHITE);
+    void setItem(int index, FlashString text, uint16_t color = TFT_WHITE) { setItem(index, text.c_str(), color); }
+    template <size_t N>
+    void setItem(int index, const FixedString<N>& text, uint16_t color = TFT_WHITE) {
+        setItem(index, text.c_str(), color);
+    }
+    void setHighlightBox(int w, int h, uint16_t color, uint16_t textColor);
+    void select(int index);
+
+    int itemX(int index) const { return originX + index * stepX; }
+    int itemY(int index) const { return originY + index * stepY; }
+    // Point a cursor's stops at the items, offset from each item's origin
+    void layoutCursor(Cursor& cursor, int offsetX, int offsetY) const;
+
+    void invalidate() override;
+    bool needsRender() const override;
+    DirtyRect render(Display* display, uint16_t background) override;
+    void erase(Display* display, uint16_t background) override;
+    void forget() override;
+};
+
+// Outlined bar filled in proportion to value / maximum
+class ProgressBar : public Widget {
+private:
+    int value;
+    int maximum;
+    uint16_t borderColor;
+    uint16_t fillColor;
+
+protected:
+    void draw(Display* display, uint16_t background) override;
+    bool coversBounds(uint16_t background) const override { return true; }
+
+public:
+    ProgressBar(int x, int y, int w, int h, uint16_t outlineColor = TFT_WHITE);
+
+    void setValue(int current, int max);
+    void setFillColor(uint16_t color);
+};
+
+// An area painted by code outside the widget tree (sprite layer, combat
+// text box). Draws nothing itself; it only puts the area on its screen
+// panel so hide() erases it along with the widgets.
+class Canvas : public Widget {
+protected:
+    void draw(Display* display, uint16_t background) override {}
+    bool coversBounds(uint16_t background) const override { return true; }
+
+public:
+    Canvas(int x, int y, int w, int h) : Widget(x, y, w, h) {}
+};
+
+#endif
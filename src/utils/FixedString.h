@@ -0,0 +1,145 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// Heap-free text for the game's hot paths, in place of Arduino String.
+//
+// FlashString - immutable names and descriptions. Just a pointer to text
+//   that lives for the whole program, in practice a string literal (on the
+//   ESP32 literals sit in flash-mapped .rodata), so copying one copies a
+//   word and nothing is ever allocated or freed.
+//
+//     FlashString name = "Fireball";
+//     LOG_INFO(SPELL, "%s", name.c_str());
+//
+// FixedString<N> - dynamic text built at run time, held inline in an
+//   N-byte buffer (N - 1 characters). Appends past the end are cut off,
+//   never reallocated.
+//
+//     FixedString<32> line;
+//     line.appendf("HP: %d/%d", hp, maxHP);
+//     display->drawText(line.c_str(), x, y, TFT_WHITE);
+
+class FlashString {
+private:
+    const char* text;
+
+public:
+    constexpr FlashString() : text("") {}
+    constexpr FlashString(const char* staticText) : text(staticText ? staticText : "") {}
+
+    const char* c_str() const { return text; }
+    size_t length() const { return strlen(text); }
+    bool isEmpty() const { return text[0] == '\0'; }
+
+    bool operator==(const char* other) const { return strcmp(text, other) == 0; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool operator==(const FlashString& other) const { return *this == other.text; }
+    bool operator!=(const FlashString& other) const { return !(*this == other.text); }
+};
+
+template <size_t N>
+class FixedString {
+private:
+    char text[N];
+    size_t used;
+
+public:
+    FixedString() { clear(); }
+    FixedString(const char* initial) {
+        clear();
+        append(initial);
+    }
+
+    // printf into a fresh string
+    __attribute__((format(printf, 1, 2))) static FixedString format(const char* fmt, ...) {
+        FixedString result;
+        va_list args;
+        va_start(args, fmt);
+        result.vappendf(fmt, args);
+        va_end(args);
+        return result;
+    }
+
+    const char* c_str() const { return text; }
+    size_t length() const { return used; }
+    static size_t capacity() { return N - 1; }
+    bool isEmpty() const { return used == 0; }
+    char operator[](size_t index) const { return index < used ? text[index] : '\0'; }
+
+    void clear() {
+        used = 0;
+        text[0] = '\0';
+    }
+
+    // Keeps the first count characters
+    void truncate(size_t count) {
+        if (count < used) {
+            used = count;
+            text[used] = '\0';
+        }
+    }
+
+    FixedString& append(const char* more) {
+        if (!more) return *this;
+        while (*more && used < N - 1) {
+            text[used++] = *more++;
+        }
+        text[used] = '\0';
+        return *this;
+    }
+
+    // At most count characters of more
+    FixedString& append(const char* more, size_t count) {
+        if (!more) return *this;
+        while (count-- > 0 && *more && used < N - 1) {
+            text[used++] = *more++;
+        }
+        text[used] = '\0';
+        return *this;
+    }
+
+    FixedString& append(char c) {
+        if (c != '\0' && used < N - 1) {
+            text[used++] = c;
+            text[used] = '\0';
+        }
+        return *this;
+    }
+
+    __attribute__((format(printf, 2, 3))) FixedString& appendf(const char* fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+        vappendf(fmt, args);
+        va_end(args);
+        return *this;
+    }
+
+    FixedString& vappendf(const char* fmt, va_list args) {
+        int written = vsnprintf(text + used, N - used, fmt, args);
+        if (written > 0) {
+            size_t room = N - 1 - used;
+            used += (size_t)written < room ? (size_t)written : room;
+        }
+        return *this;
+    }
+
+    FixedString& operator=(const char* other) {
+        clear();
+        return append(other);
+    }
+    FixedString& operator+=(const char* more) { return append(more); }
+    FixedString& operator+=(const FlashString& more) { return append(more.c_str()); }
+    FixedString& operator+=(char c) { return append(c); }
+    template <size_t M>
+    FixedString& operator+=(const FixedString<M>& more) { return append(more.c_str()); }
+
+    bool operator==(const char* other) const { return strcmp(text, other) == 0; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include "Rng.h"
+
+// Streams before the first startRun()/seedRun() come from this seed
+#define RNG_DEFAULT_SEED 0x5EED
+
+struct RngStreams {
+    uint32_t runSeed;
+    Rng streams[RNG_STREAM_COUNT];
+    bool seedQueued;
+    uint32_t queuedSeed;
+
+    RngStreams() {
+        runSeed = RNG_DEFAULT_SEED;
+        seedQueued = false;
+        queuedSeed = 0;
+        for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+            streams[i].seed(runSeed, i);
+        }
+    }
+};
+
+static thread_local RngStreams rngStreams;
+
+static inline uint32_t rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void Rng::seed(uint32_t seed, uint32_t stream) {
+    uint64_t x = ((uint64_t)stream << 32) | seed;
+    uint64_t a = splitMix64(x);
+    uint64_t b = splitMix64(x);
+    state[0] = (uint32_t)a;
+    state[1] = (uint32_t)(a >> 32);
+    state[2] = (uint32_t)b;
+    state[3] = (uint32_t)(b >> 32);
+    // All-zero state would only ever return zero
+    if ((state[0] | state[1] | state[2] | state[3]) == 0) state[0] = 1;
+}
+
+// xoshiro128** 1.1 (Blackman & Vigna)
+uint32_t Rng::next() {
+    uint32_t result = rotl(state[1] * 5, 7) * 9;
+    uint32_t t = state[1] << 9;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+
+    return result;
+}
+
+// Lemire's multiply-shift with rejection
+long Rng::range(long low, long high) {
+    if (high <= low) return low;
+    uint32_t span = (uint32_t)(high - low);
+
+    uint64_t m = (uint64_t)next() * span;
+    uint32_t fraction = (uint32_t)m;
+    if (fraction < span) {
+        uint32_t threshold = (0u - span) % span;
+        while (fraction < threshold) {
+            m = (uint64_t)next() * span;
+            fraction = (uint32_t)m;
+        }
+    }
+    return low + (long)(m >> 32);
+}
+
+//============================================================================
+// RUN SEEDING
+//============================================================================
+
+uint32_t Rng::startRun() {
+#ifdef RNG_RUN_SEED
+    uint32_t runSeed = (uint32_t)(RNG_RUN_SEED);
+#else
+    uint32_t runSeed = esp_random();
+#endif
+    if (rngStreams.seedQueued) {
+        runSeed = rngStreams.queuedSeed;
+        rngStreams.seedQueued = false;
+    }
+    seedRun(runSeed);
+    return runSeed;
+}
+
+void Rng::queueRunSeed(uint32_t runSeed) {
+    rngStreams.queuedSeed = runSeed;
+    rngStreams.seedQueued = true;
+}
+
+void Rng::seedRun(uint32_t runSeed) {
+    rngStreams.runSeed = runSeed;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        rngStreams.streams[i].seed(runSeed, i);
+    }
+}
+
+uint32_t Rng::getRunSeed() {
+    return rngStreams.runSeed;
+}
+
+Rng& Rng::stream(RngStream which) {
+    return rngStreams.streams[which];
+}
@@ -0,0 +1,50 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <Arduino.h>
+
+// Game random numbers. Every run has one 32-bit seed; each subsystem draws
+// from its own stream derived from it, so e.g. an extra enemy AI roll
+// doesn't change which rooms the floor generates next. The generator is
+// xoshiro128** and all arithmetic is fixed-width integer math, so the same
+// seed replays the same dungeon on the ESP32 and in the host tools.
+//
+//   int roll = Rng::roll(RNG_COMBAT, 1, 101);   // 1-100, like random(1, 101)
+//
+// Streams are per thread, which lets the host simulators run games in
+// parallel; the device only ever uses them from loop().
+//
+// Build with -D RNG_RUN_SEED=<n> to give every run the same seed (e.g. to
+// replay a seed from a bug report on the device).
+
+enum RngStream : uint8_t {
+    RNG_COMBAT,     // Enemy AI
+    RNG_FLOOR,      // Room types and enemy picks
+    RNG_LOOT,       // Treasure rolls and scroll drops
+    RNG_STREAM_COUNT
+};
+
+class Rng {
+private:
+    uint32_t state[4];
+
+public:
+    // Seeds from (seed, stream) through SplitMix64
+    void seed(uint32_t seed, uint32_t stream);
+    uint32_t next();
+    // Uniform in [low, high), without modulo bias; low if the range is empty
+    long range(long low, long high);
+
+    // Run seeding; picks a fresh seed from the hardware RNG unless
+    // RNG_RUN_SEED is set. Returns the seed so it can be logged/recorded.
+    static uint32_t startRun();
+    static void seedRun(uint32_t runSeed);
+    // The next startRun() uses this seed instead (input replay)
+    static void queueRunSeed(uint32_t runSeed);
+    static uint32_t getRunSeed();
+
+    static Rng& stream(RngStream which);
+    static long roll(RngStream which, long low, long high) { return stream(which).range(low, high); }
+};
+
+#endif
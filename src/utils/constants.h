@@ -160,6 +160,7 @@
 #define SPELL_SYNERGY_BONUS 5       // Bonus damage for spell synergies
 #define SHIELD_DECAY_RATE   1       // How fast magical shields decay
 #define MAX_SPELL_EFFECTS   10      // Maximum active spell effects
+#define EFFECT_WHEEL_SLOTS  8       // Turns the effect timer wheel spans (longer effects lap it)
 
 // ==============================================
 // UI LAYOUT CONSTANTS
@@ -186,7 +187,17 @@
 // ==============================================
 
 #define SERIAL_BAUD_RATE    115200
-#define MAIN_LOOP_DELAY_MS  10      // Your current delay
+
+// Main loop frame scheduling (see game/FrameScheduler.h)
+#define FRAME_PERIOD_MS         10      // Target loop period (work + sleep)
+#define FRAME_IDLE_AFTER_MS     1000    // No pixels pushed and no button held this long = idle
+#define FRAME_IDLE_TICK_MS      100     // Loop period once idle
+// Spend idle ticks in light sleep, woken by the buttons. Off unless the
+// build sets it (the release env does): light sleep drops the USB-CDC
+// console, so logs and DebugConsole commands stop once the game idles.
+#ifndef FRAME_LIGHT_SLEEP
+#define FRAME_LIGHT_SLEEP       0
+#endif
 
 // Memory management
 #define MAX_COMBAT_LOG_ENTRIES  10
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Convert a PNG into a compressed ImageAsset header for the game.
+
+The image is quantised to RGB565, given a palette of up to 256 colours
+and stored as palette indices, run-length encoded one row at a time
+(see src/graphics/ImageAsset.h for the byte format). Fully transparent
+pixels (alpha < 128) map to a reserved palette entry that the renderer
+skips.
+
+Only the Python standard library is needed (PNG decoding uses zlib).
+
+    tools/img2asset.py assets/images/victory.png src/graphics/VictoryScreen.h \\
+        --name victory --guard VICTORY_SCREEN_H
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Packet header: bit 7 set = run of (n & 0x7F) + 1 copies of the next
+# index byte, clear = n + 1 literal index bytes follow.
+MAX_PACKET = 128
+
+
+def read_png(path):
+    """Return (width, height, rows) where rows is a list of (r, g, b, a) lists."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("%s is not a PNG file" % path)
+
+    pos = len(PNG_SIGNATURE)
+    header = None
+    palette = []
+    palette_alpha = []
+    idat = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            palette_alpha = list(body)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if header is None:
+        raise ValueError("%s has no IHDR chunk" % path)
+    width, height, depth, color_type, _, _, interlace = header
+    if depth != 8 or interlace != 0:
+        raise ValueError("only 8-bit, non-interlaced PNGs are supported")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None:
+        raise ValueError("unsupported PNG colour type %d" % color_type)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    offset = 0
+    for _ in range(height):
+        filter_type = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        unfilter(line, previous, filter_type, channels)
+        rows.append(to_rgba(line, width, color_type, palette, palette_alpha))
+        previous = line
+    return width, height, rows
+
+
+def unfilter(line, previous, filter_type, bpp):
+    for i in range(len(line)):
+        left = line[i - bpp] if i >= bpp else 0
+        up = previous[i]
+        upper_left = previous[i - bpp] if i >= bpp else 0
+        if filter_type == 1:
+            line[i] = (line[i] + left) & 0xFF
+        elif filter_type == 2:
+            line[i] = (line[i] + up) & 0xFF
+        elif filter_type == 3:
+            line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+        elif filter_type == 4:
+            p = left + up - upper_left
+            pa, pb, pc = abs(p - left), abs(p - up), abs(p - upper_left)
+            if pa <= pb and pa <= pc:
+                predictor = left
+            elif pb <= pc:
+                predictor = up
+            else:
+                predictor = upper_left
+            line[i] = (line[i] + predictor) & 0xFF
+
+
+def to_rgba(line, width, color_type, palette, palette_alpha):
+    pixels = []
+    for x in range(width):
+        if color_type == 0:
+            g = line[x]
+            pixels.append((g, g, g, 255))
+        elif color_type == 2:
+            pixels.append(tuple(line[x * 3:x * 3 + 3]) + (255,))
+        elif color_type == 3:
+            index = line[x]
+            alpha = palette_alpha[index] if index < len(palette_alpha) else 255
+            pixels.append(palette[index] + (alpha,))
+        elif color_type == 4:
+            g, a = line[x * 2], line[x * 2 + 1]
+            pixels.append((g, g, g, a))
+        else:
+            pixels.append(tuple(line[x * 4:x * 4 + 4]))
+    return pixels
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def build_palette(rows):
+    """Map every pixel to a palette index. Returns (palette, index_rows, transparent_index)."""
+    transparent = any(a < 128 for row in rows for (_, _, _, a) in row)
+    palette = []
+    lookup = {}
+    if transparent:
+        # Index 0 is reserved for "no pixel"; its colour is never drawn
+        palette.append(0)
+    index_rows = []
+    for row in rows:
+        indices = []
+        for r, g, b, a in row:
+            if a < 128:
+                indices.append(0)
+                continue
+            color = rgb565(r, g, b)
+            if color not in lookup:
+                lookup[color] = len(palette)
+                palette.append(color)
+            indices.append(lookup[color])
+        index_rows.append(indices)
+    if len(palette) > 256:
+        raise ValueError("image has %d colours after RGB565 quantisation, max is 256" % len(palette))
+    return palette, index_rows, (0 if transparent else -1)
+
+
+def encode_row(indices):
+    """RLE-encode one row; packets never cross a row boundary."""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < MAX_PACKET:
+            run += 1
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+        else:
+            literal.extend(indices[i:i + run])
+        i += run
+    flush_literal()
+    return out
+
+
+def format_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(path, name, guard, include, source, width, height, palette, data, transparent):
+    macro = name.upper()
+    raw_size = width * height * 2
+    text = []
+    text.append("// Generated by tools/img2asset.py from %s - do not edit." % source)
+    text.append("// %dx%d, %d colours, %d bytes of RLE data (%d bytes as raw RGB565)"
+                % (width, height, len(palette), len(data), raw_size))
+    text.append("#ifndef %s" % guard)
+    text.append("#define %s" % guard)
+    text.append("")
+    text.append('#include "%s"' % include)
+    text.append("")
+    text.append("#define %s_IMAGE_WIDTH %d" % (macro, width))
+    text.append("#define %s_IMAGE_HEIGHT %d" % (macro, height))
+    text.append("")
+    text.append("const uint16_t PROGMEM %sPalette[] = {" % name)
+    text.append(format_array(palette, 8, "0x%04X"))
+    text.append("};")
+    text.append("")
+    text.append("const uint8_t PROGMEM %sData[] = {" % name)
+    text.append(format_array(list(data), 16, "0x%02X"))
+    text.append("};")
+    text.append("")
+    text.append("const ImageAsset %sImage = {" % name)
+    text.append("  %d, %d, %d, %d," % (width, height, len(palette), transparent))
+    text.append("  %sPalette," % name)
+    text.append("  %sData," % name)
+    text.append("  sizeof(%sData)" % name)
+    text.append("};")
+    text.append("")
+    text.append("#endif")
+    text.append("")
+    with open(path, "w") as f:
+        f.write("\n".join(text))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="source PNG")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("--name", required=True, help="C identifier prefix, e.g. victory")
+    parser.add_argument("--guard", help="include guard (default <NAME>_IMAGE_H)")
+    parser.add_argument("--include", default="../graphics/ImageAsset.h",
+                        help="path the header uses to include ImageAsset.h")
+    args = parser.parse_args()
+
+    width, height, rows = read_png(args.input)
+    palette, index_rows, transparent = build_palette(rows)
+    data = bytearray()
+    for indices in index_rows:
+        data.extend(encode_row(indices))
+
+    guard = args.guard or "%s_IMAGE_H" % args.name.upper()
+    source = os.path.relpath(args.input).replace(os.sep, "/")
+    write_header(args.output, args.name, guard, args.include, source,
+                 width, height, palette, data, transparent)
+    print("%s: %dx%d, %d colours, %d -> %d bytes"
+          % (args.output, width, height, len(palette), width * height * 2, len(data)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
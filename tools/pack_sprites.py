@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Pack the text-art sprites in assets/sprites into one atlas in flash.
+
+Each sprite is a .txt grid with one character per pixel, using the shared
+colour legend in palette.txt ('.' is transparent). Sprites are shelf-packed
+into a single 8-bit indexed sheet and written out as a C++ source file that
+defines `gameSprites` (see src/graphics/SpriteAtlas.h). Frames are named
+after their file, so "enemies/goblin.bmp" finds the sprite from goblin.txt.
+
+    tools/pack_sprites.py assets/sprites src/graphics/SpriteAtlasData.cpp \\
+        [--preview atlas.png]
+"""
+
+import argparse
+import glob
+import os
+import struct
+import sys
+import zlib
+
+ATLAS_WIDTH = 96
+TRANSPARENT = "."
+
+
+def rgb565(value):
+    r, g, b = (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def read_palette(path):
+    """Return list of (char, rgb888). Index 0 is reserved for transparency."""
+    legend = [(TRANSPARENT, 0)]
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            char, color = line.split()
+            if len(char) != 1 or char == TRANSPARENT:
+                raise ValueError("%s:%d: bad palette character %r" % (path, number, char))
+            legend.append((char, int(color, 16)))
+    if len(legend) > 256:
+        raise ValueError("palette has more than 255 colours")
+    return legend
+
+
+def read_sprite(path, lookup):
+    rows = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if line.startswith("#"):
+                continue
+            row = []
+            for column, char in enumerate(line):
+                if char not in lookup:
+                    raise ValueError("%s:%d:%d: %r is not in the palette" % (path, number, column + 1, char))
+                row.append(lookup[char])
+            rows.append(row)
+    while rows and not rows[-1]:
+        rows.pop()
+    if not rows:
+        raise ValueError("%s is empty" % path)
+    width = len(rows[0])
+    if any(len(row) != width for row in rows):
+        raise ValueError("%s: all rows must be %d characters wide" % (path, width))
+    return width, len(rows), rows
+
+
+def pack(sprites):
+    """Shelf-pack sprites (tallest first). Returns frames, atlas height."""
+    order = sorted(sprites, key=lambda s: (-s[2], s[0]))
+    frames = []
+    x = y = shelf_height = 0
+    for name, width, height, rows in order:
+        if width > ATLAS_WIDTH:
+            raise ValueError("%s is wider than the atlas (%d)" % (name, ATLAS_WIDTH))
+        if x + width > ATLAS_WIDTH:
+            y += shelf_height
+            x = shelf_height = 0
+        frames.append((name, x, y, width, height, rows))
+        x += width
+        shelf_height = max(shelf_height, height)
+    return frames, y + shelf_height
+
+
+def write_png(path, width, height, pixels, legend):
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for x in range(width):
+            index = pixels[y * width + x]
+            color = legend[index][1] if index else 0x303030
+            raw.extend(((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF))
+
+    def chunk(kind, body):
+        data = struct.pack(">I", len(body)) + kind + body
+        return data + struct.pack(">I", zlib.crc32(kind + body) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def write_source(path, source_dir, legend, frames, height, pixels):
+    lines = []
+    lines.append("// Generated by tools/pack_sprites.py from %s - do not edit." % source_dir)
+    lines.append("// %dx%d atlas, %d frames, %d colours" % (ATLAS_WIDTH, height, len(frames), len(legend)))
+    lines.append('#include "SpriteAtlas.h"')
+    lines.append("")
+    lines.append("static const uint16_t PROGMEM spritePalette[] = {")
+    colors = [rgb565(color) for _, color in legend]
+    for i in range(0, len(colors), 8):
+        lines.append("  " + ", ".join("0x%04X" % c for c in colors[i:i + 8]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t PROGMEM spritePixels[] = {")
+    for y in range(height):
+        row = pixels[y * ATLAS_WIDTH:(y + 1) * ATLAS_WIDTH]
+        for i in range(0, len(row), 24):
+            lines.append("  " + ", ".join("%d" % v for v in row[i:i + 24]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const SpriteFrame spriteFrames[] = {")
+    for name, x, y, width, frame_height, _ in sorted(frames):
+        lines.append('  {"%s", %d, %d, %d, %d},' % (name, x, y, width, frame_height))
+    lines.append("};")
+    lines.append("")
+    lines.append("const SpriteAtlas gameSprites = {")
+    lines.append("  %d, %d, %d, 0," % (ATLAS_WIDTH, height, len(legend)))
+    lines.append("  spritePalette,")
+    lines.append("  spritePixels,")
+    lines.append("  spriteFrames,")
+    lines.append("  %d" % len(frames))
+    lines.append("};")
+    lines.append("")
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("sprites", help="directory with palette.txt and *.txt sprites")
+    parser.add_argument("output", help="C++ source to write")
+    parser.add_argument("--preview", help="also write the packed atlas as a PNG")
+    args = parser.parse_args()
+
+    legend = read_palette(os.path.join(args.sprites, "palette.txt"))
+    lookup = {char: index for index, (char, _) in enumerate(legend)}
+
+    sprites = []
+    for path in sorted(glob.glob(os.path.join(args.sprites, "*.txt"))):
+        name = os.path.splitext(os.path.basename(path))[0]
+        if name == "palette":
+            continue
+        width, height, rows = read_sprite(path, lookup)
+        sprites.append((name, width, height, rows))
+
+    frames, height = pack(sprites)
+    pixels = [0] * (ATLAS_WIDTH * height)
+    for _, x, y, width, frame_height, rows in frames:
+        for row in range(frame_height):
+            pixels[(y + row) * ATLAS_WIDTH + x:(y + row) * ATLAS_WIDTH + x + width] = rows[row]
+
+    source_dir = os.path.relpath(args.sprites).replace(os.sep, "/")
+    write_source(args.output, source_dir, legend, frames, height, pixels)
+    if args.preview:
+        write_png(args.preview, ATLAS_WIDTH, height, pixels, legend)
+    print("%s: %d frames in a %dx%d atlas (%d bytes)"
+          % (args.output, len(frames), ATLAS_WIDTH, height, len(pixels)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())